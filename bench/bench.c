@@ -0,0 +1,409 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#ifdef __riscv
+/* LiteX / SoC specific includes */
+#include <libbase/uart.h>
+#include <generated/soc.h>
+#else
+#include <time.h>
+#endif
+
+/* WolfSSL cryptography includes */
+#include <wolfssl/wolfcrypt/user_settings.h>
+#include <wolfssl/wolfcrypt/settings.h>
+#include <wolfssl/wolfcrypt/types.h>
+#include <wolfssl/wolfcrypt/random.h>
+#include <wolfssl/wolfcrypt/error-crypt.h>
+#include <wolfssl/wolfcrypt/sha3.h>
+#include <wolfssl/wolfcrypt/mlkem.h>
+#include <wolfssl/wolfcrypt/wc_mlkem.h>
+#include <wolfssl/wolfcrypt/dilithium.h>
+#include <wolfssl/wolfcrypt/chacha20_poly1305.h>
+
+/*
+ * PQC kernel benchmark. Times the wolfcrypt operations the DTLS client
+ * spends its handshake in, one JSON object per line between
+ * "=== BENCH JSON ===" and "=== BENCH END ===":
+ *
+ *   {"target":"vexriscv","unit":"cycles","hz":100000000,"flags":"-Os"}
+ *   {"name":"mlkem512_keygen","iters":4,"per_op":123456}
+ *   {"name":"chacha20_poly1305_1200","iters":16,"per_op":9876,"bytes":1200,"per_kb":8427}
+ *
+ * The same file builds for the simulator (bench/Makefile) and natively
+ * (make -C bench host), scripts/bench-compare.py diffs two runs.
+ */
+
+#ifndef BENCH_FLAGS
+#define BENCH_FLAGS ""              // Compiler/user_settings flags, set by the Makefile
+#endif
+
+/* Iterations of each public key operation, kernels run 16 times as often. */
+#ifndef BENCH_ITERS
+#ifdef __riscv
+#define BENCH_ITERS 4
+#else
+#define BENCH_ITERS 200
+#endif
+#endif
+#define BENCH_KERNEL_ITERS  (BENCH_ITERS * 16)
+
+/* Record sizes for ChaCha20-Poly1305, 1200 is the client's CHUNK_SIZE. */
+static const word32 aead_sizes[] = { 64, 256, 512, 1024, 1200 };
+#define AEAD_MAX_SZ 1200
+
+/*
+ * Deterministic RNG, as in boot/main.c.
+ */
+int CustomRngGenerateBlock(byte *output, word32 sz){
+    for (word32 i = 0; i < sz; i++)
+        output[i] = (byte)(i * 37 + 123);
+    return 0;
+}
+
+/*
+ * Cycle counter: rdcycle on the VexRiscv, the TSC on x86 hosts and
+ * nanoseconds elsewhere.
+ */
+#if defined(__riscv)
+#define BENCH_TARGET  "vexriscv"
+#define BENCH_UNIT    "cycles"
+#define BENCH_HZ      CONFIG_CLOCK_FREQUENCY
+uint64_t read_cycle64(void){
+    uint32_t hi, lo, hi2;
+    do{
+        asm volatile("rdcycleh %0" : "=r"(hi));
+        asm volatile("rdcycle  %0" : "=r"(lo));
+        asm volatile("rdcycleh %0" : "=r"(hi2));
+    }
+    while (hi != hi2);
+    return ((uint64_t)hi << 32) | lo;
+}
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_TARGET  "host"
+#define BENCH_UNIT    "tsc"
+#define BENCH_HZ      0             // TSC rate is not known here
+uint64_t read_cycle64(void){
+    return __rdtsc();
+}
+#else
+#define BENCH_TARGET  "host"
+#define BENCH_UNIT    "ns"
+#define BENCH_HZ      1000000000
+uint64_t read_cycle64(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+/*
+ * for WolfSSL USER_TICKS, returns time in seconds.
+ */
+unsigned int LowResTimer(void)
+{
+    return 0;
+}
+
+static int failures = 0;
+
+/* Prints one result line, per_kb only for byte oriented benchmarks. */
+static void bench_result(const char *name, int iters, uint64_t cycles,
+                         word32 bytes)
+{
+    printf("{\"name\":\"%s\",\"iters\":%d,\"per_op\":%llu", name, iters,
+           (unsigned long long)(cycles / (uint64_t)iters));
+    if (bytes > 0)
+        printf(",\"bytes\":%lu,\"per_kb\":%llu", (unsigned long)bytes,
+               (unsigned long long)((cycles * 1024) / ((uint64_t)iters * bytes)));
+    printf("}\n");
+}
+
+static void bench_error(const char *name, int ret)
+{
+    printf("{\"name\":\"%s\",\"error\":%d}\n", name, ret);
+    failures++;
+}
+
+/*
+ * ML-KEM-512 key generation, encapsulation and decapsulation.
+ */
+static void bench_mlkem(WC_RNG *rng)
+{
+    static MlKemKey key;
+    static byte ct[WC_ML_KEM_512_CIPHER_TEXT_SIZE];
+    byte ss[WC_ML_KEM_SS_SZ];
+    byte ss_dec[WC_ML_KEM_SS_SZ];
+    uint64_t start, total;
+    int ret, i;
+
+    ret = wc_MlKemKey_Init(&key, WC_ML_KEM_512, NULL, INVALID_DEVID);
+    if (ret != 0){
+        bench_error("mlkem512_keygen", ret);
+        return;
+    }
+
+    total = 0;
+    for (i = 0; i < BENCH_ITERS && ret == 0; i++){
+        start = read_cycle64();
+        ret = wc_MlKemKey_MakeKey(&key, rng);
+        total += read_cycle64() - start;
+    }
+    if (ret != 0)
+        bench_error("mlkem512_keygen", ret);
+    else
+        bench_result("mlkem512_keygen", BENCH_ITERS, total, 0);
+
+    total = 0;
+    for (i = 0; i < BENCH_ITERS && ret == 0; i++){
+        start = read_cycle64();
+        ret = wc_MlKemKey_Encapsulate(&key, ct, ss, rng);
+        total += read_cycle64() - start;
+    }
+    if (ret != 0)
+        bench_error("mlkem512_encaps", ret);
+    else
+        bench_result("mlkem512_encaps", BENCH_ITERS, total, 0);
+
+    total = 0;
+    for (i = 0; i < BENCH_ITERS && ret == 0; i++){
+        start = read_cycle64();
+        ret = wc_MlKemKey_Decapsulate(&key, ss_dec, ct, sizeof(ct));
+        total += read_cycle64() - start;
+        /* Decapsulating the last ciphertext must give its shared secret */
+        if (ret == 0 && XMEMCMP(ss_dec, ss, sizeof(ss)) != 0)
+            ret = WC_KEY_MISMATCH_E;
+    }
+    if (ret != 0)
+        bench_error("mlkem512_decaps", ret);
+    else
+        bench_result("mlkem512_decaps", BENCH_ITERS, total, 0);
+
+    wc_MlKemKey_Free(&key);
+}
+
+/*
+ * ML-DSA-44 signing and verification of a 64 byte message. Signing takes a
+ * varying number of rejection rounds, each iteration signs another message.
+ */
+static void bench_mldsa(WC_RNG *rng)
+{
+    static dilithium_key key;
+    static byte sig[DILITHIUM_LEVEL2_SIG_SIZE];
+    byte msg[64];
+    word32 sigSz = 0;
+    uint64_t start, total;
+    int ret, i, res = 0;
+
+    memset(msg, 0x3c, sizeof(msg));
+    ret = wc_dilithium_init(&key);
+    if (ret == 0)
+        ret = wc_dilithium_set_level(&key, WC_ML_DSA_44);
+    if (ret == 0)
+        ret = wc_dilithium_make_key(&key, rng);
+    if (ret != 0){
+        bench_error("mldsa44_sign", ret);
+        wc_dilithium_free(&key);
+        return;
+    }
+
+    total = 0;
+    for (i = 0; i < BENCH_ITERS && ret == 0; i++){
+        msg[0] = (byte)i;
+        sigSz = sizeof(sig);
+        start = read_cycle64();
+        ret = wc_dilithium_sign_msg(msg, sizeof(msg), sig, &sigSz, &key, rng);
+        total += read_cycle64() - start;
+    }
+    if (ret != 0)
+        bench_error("mldsa44_sign", ret);
+    else
+        bench_result("mldsa44_sign", BENCH_ITERS, total, 0);
+
+    total = 0;
+    for (i = 0; i < BENCH_ITERS && ret == 0; i++){
+        start = read_cycle64();
+        ret = wc_dilithium_verify_msg(sig, sigSz, msg, sizeof(msg), &res, &key);
+        total += read_cycle64() - start;
+        if (ret == 0 && res != 1)
+            ret = SIG_VERIFY_E;
+    }
+    if (ret != 0)
+        bench_error("mldsa44_verify", ret);
+    else
+        bench_result("mldsa44_verify", BENCH_ITERS, total, 0);
+
+    wc_dilithium_free(&key);
+}
+
+/*
+ * SHAKE128/256 squeezed one rate block at a time, as the ML-KEM matrix and
+ * the ML-DSA expansion use them.
+ */
+static void bench_shake(void)
+{
+    static byte block[WC_SHA3_128_COUNT * 8];
+    byte seed[34];
+    wc_Shake shake;
+    uint64_t start;
+    int i;
+
+    memset(seed, 0x5a, sizeof(seed));
+
+    wc_InitShake128(&shake, NULL, INVALID_DEVID);
+    wc_Shake128_Absorb(&shake, seed, sizeof(seed));
+    start = read_cycle64();
+    for (i = 0; i < BENCH_KERNEL_ITERS; i++)
+        wc_Shake128_SqueezeBlocks(&shake, block, 1);
+    bench_result("shake128_block", BENCH_KERNEL_ITERS, read_cycle64() - start,
+                 WC_SHA3_128_COUNT * 8);
+    wc_Shake128_Free(&shake);
+
+    wc_InitShake256(&shake, NULL, INVALID_DEVID);
+    wc_Shake256_Absorb(&shake, seed, sizeof(seed));
+    start = read_cycle64();
+    for (i = 0; i < BENCH_KERNEL_ITERS; i++)
+        wc_Shake256_SqueezeBlocks(&shake, block, 1);
+    bench_result("shake256_block", BENCH_KERNEL_ITERS, read_cycle64() - start,
+                 WC_SHA3_256_COUNT * 8);
+    wc_Shake256_Free(&shake);
+}
+
+/*
+ * ChaCha20-Poly1305 encryption of one record, per record size.
+ */
+static void bench_aead(void)
+{
+    static byte in[AEAD_MAX_SZ];
+    static byte out[AEAD_MAX_SZ];
+    byte key[CHACHA20_POLY1305_AEAD_KEYSIZE];
+    byte iv[CHACHA20_POLY1305_AEAD_IV_SIZE];
+    byte aad[13];
+    byte tag[CHACHA20_POLY1305_AEAD_AUTHTAG_SIZE];
+    char name[32];
+    uint64_t start;
+    int ret = 0, i;
+
+    memset(key, 0x11, sizeof(key));
+    memset(iv, 0x22, sizeof(iv));
+    memset(aad, 0x33, sizeof(aad));
+    memset(in, 'A', sizeof(in));
+
+    for (word32 s = 0; s < sizeof(aead_sizes) / sizeof(aead_sizes[0]); s++){
+        word32 sz = aead_sizes[s];
+
+        snprintf(name, sizeof(name), "chacha20_poly1305_%lu", (unsigned long)sz);
+        start = read_cycle64();
+        for (i = 0; i < BENCH_KERNEL_ITERS && ret == 0; i++)
+            ret = wc_ChaCha20Poly1305_Encrypt(key, iv, aad, sizeof(aad), in,
+                                              sz, out, tag);
+        if (ret != 0){
+            bench_error(name, ret);
+            return;
+        }
+        bench_result(name, BENCH_KERNEL_ITERS, read_cycle64() - start, sz);
+    }
+}
+
+#ifdef WOLFSSL_BENCH_KERNELS
+/*
+ * NTT kernels on one polynomial. The input is restored before each call so
+ * the coefficients stay in range, only the kernel itself is timed.
+ */
+static void bench_ntt(void)
+{
+    static sword16 kin[MLKEM_N], ka[MLKEM_N], kb[MLKEM_N];
+    static sword32 din[DILITHIUM_N], da[DILITHIUM_N];
+    uint64_t start, total;
+    int i;
+
+    for (i = 0; i < MLKEM_N; i++)
+        kin[i] = (sword16)((i * 1663) % 3329 - 1664);
+    for (i = 0; i < DILITHIUM_N; i++)
+        din[i] = (sword32)((i * 1048573) % 8380417 - 4190208);
+
+    total = 0;
+    for (i = 0; i < BENCH_KERNEL_ITERS; i++){
+        memcpy(ka, kin, sizeof(ka));
+        start = read_cycle64();
+        mlkem_bench_ntt(ka);
+        total += read_cycle64() - start;
+    }
+    bench_result("mlkem_ntt", BENCH_KERNEL_ITERS, total, 0);
+
+    total = 0;
+    for (i = 0; i < BENCH_KERNEL_ITERS; i++){
+        memcpy(ka, kin, sizeof(ka));
+        start = read_cycle64();
+        mlkem_bench_invntt(ka);
+        total += read_cycle64() - start;
+    }
+    bench_result("mlkem_invntt", BENCH_KERNEL_ITERS, total, 0);
+
+    start = read_cycle64();
+    for (i = 0; i < BENCH_KERNEL_ITERS; i++)
+        mlkem_bench_basemul_mont(kb, kin, kin);
+    bench_result("mlkem_basemul_mont", BENCH_KERNEL_ITERS,
+                 read_cycle64() - start, 0);
+
+    total = 0;
+    for (i = 0; i < BENCH_KERNEL_ITERS; i++){
+        memcpy(da, din, sizeof(da));
+        start = read_cycle64();
+        dilithium_bench_ntt(da);
+        total += read_cycle64() - start;
+    }
+    bench_result("mldsa_ntt", BENCH_KERNEL_ITERS, total, 0);
+
+    total = 0;
+    for (i = 0; i < BENCH_KERNEL_ITERS; i++){
+        memcpy(da, din, sizeof(da));
+        start = read_cycle64();
+        dilithium_bench_invntt(da);
+        total += read_cycle64() - start;
+    }
+    bench_result("mldsa_invntt", BENCH_KERNEL_ITERS, total, 0);
+}
+#endif /* WOLFSSL_BENCH_KERNELS */
+
+int main(void)
+{
+    WC_RNG rng;
+
+#ifdef __riscv
+    uart_init();
+#endif
+    printf("\n=== PQC Benchmark ===\n");
+
+    wolfCrypt_Init();
+    if (wc_InitRng(&rng) != 0){
+        printf("ERROR: RNG init failed.\n");
+        goto END;
+    }
+
+    printf("=== BENCH JSON ===\n");
+    printf("{\"target\":\"%s\",\"unit\":\"%s\",\"hz\":%lu,\"flags\":\"%s\"}\n",
+           BENCH_TARGET, BENCH_UNIT, (unsigned long)BENCH_HZ, BENCH_FLAGS);
+#ifdef WOLFSSL_BENCH_KERNELS
+    bench_ntt();
+#endif
+    bench_shake();
+    bench_aead();
+    bench_mlkem(&rng);
+    bench_mldsa(&rng);
+    printf("=== BENCH END ===\n");
+    if (failures > 0)
+        printf("%d benchmark(s) failed\n", failures);
+
+    wc_FreeRng(&rng);
+    wolfCrypt_Cleanup();
+
+END:
+#ifdef __riscv
+    while (1)
+        ;
+#endif
+    return failures != 0;
+}
@@ -8,6 +8,7 @@
 #include <libbase/console.h>    
 #include <generated/csr.h>      
 #include <generated/soc.h>      
+#include <generated/mem.h>      
 #include <libliteeth/udp.h>     
 
 /* WolfSSL cryptography and SSL/TLS includes */
@@ -26,6 +27,9 @@ typedef wc_Sha3 wc_Shake;       // Typedef required for PQC algorithms
 #include "certs/client_key.h"   // Client private key
 #include "certs/CA_der.h"       // CA Certificate
 #include "mem_profile.h"        // Memory profiling
+#ifdef CYCLE_TRACE
+#include "trace.h"              // Handshake stage spans
+#endif
 
 /*  
  * Custom RNG (Random Number Generator)
@@ -67,6 +71,26 @@ unsigned int LowResTimer(void)
     return cycles_to_ms(read_cycle64()) / 1000;
 }
 
+#ifdef WOLFSSL_DTLS13_RTT
+/* 
+ * for the WolfSSL DTLS 1.3 retransmission timer, returns time in milliseconds.
+ */
+unsigned int DtlsTimerMs(void)
+{
+    return cycles_to_ms(read_cycle64());
+}
+#endif
+
+#ifdef WOLFSSL_TICKET_USER_TIME
+/* 
+ * for WolfSSL session tickets without ASN time, returns time in milliseconds.
+ */
+sword64 TimeNowInMilliseconds(void)
+{
+    return (sword64)cycles_to_ms(read_cycle64());
+}
+#endif
+
 /*                           */
 /* GLOBAL METRICS & COUNTERS */
 /*                           */
@@ -88,9 +112,15 @@ uint32_t total_bytes_tx = 0;
 uint32_t total_bytes_rx = 0;
 uint32_t handshake_tx_bytes = 0;
 uint32_t handshake_rx_bytes = 0;
+uint32_t tx_frames_done = 0;     // Frames the MAC has finished sending
+uint32_t tx_slot_busy = 0;       // Sends deferred because every TX slot was in flight
+uint32_t rx_frames = 0;          // Frames drained from the MAC and acknowledged
+uint32_t rx_batch_max = 0;       // Most frames drained by one interrupt
+uint32_t rx_backpressure = 0;    // Frames left in their MAC slot because the queue was full
+uint32_t rx_queue_hwm = 0;       // Most datagrams waiting for WolfSSL at once
 uint32_t data_cycles = 0;
 uint8_t in_handshake = 0;        // Flag to track if we are in handshake phase
-uint8_t handshake_ms = 0;
+uint32_t handshake_ms = 0;
 
 /* Throughput test configuration */
 #define THROUGHPUT_TEST_SIZE (50 * 1024) // Total data to send in test
@@ -113,9 +143,56 @@ static const uint16_t HOST_DST_PORT = 4444;  // Port on the Server side
 /* RX RING BUFFER */
 /*                */
 
+#define MAX_PACKET_SIZE 1500
+
+#ifdef WOLFSSL_ZERO_COPY_RX
+/*  Zero-copy RX: the ISR only records where the datagram sits in the ethmac RX SRAM
+    and leaves the slot un-acknowledged. WolfSSL decrypts in place from the slot and
+    hands it back through EmbedReceiveRelease(). Frames behind it wait in the MAC's
+    own slot FIFO (size it with litex_sim --ethernet-rx-slots). */
+typedef struct
+{
+    uint32_t slot;          // ethmac RX slot holding the frame
+    uint32_t offset;        // UDP payload offset inside the slot
+    uint32_t len;           // UDP payload length
+    uint8_t lent;           // 1 while WolfSSL is using the slot
+    volatile uint8_t ready; // 1 if the descriptor holds a frame
+#ifdef DTLS_SESSIONS
+    uint8_t session;        // Session the datagram was addressed to
+#endif
+#ifdef WOLFSSL_DTLS_CID
+    uint32_t src_ip;        // Where the datagram came from
+    uint16_t src_port;
+#endif
+} RxDescriptor;
+
+static RxDescriptor rx_desc;
+
+#define RX_SLOT_BASE(slot) ((uint8_t *)(ETHMAC_BASE + ETHMAC_SLOT_SIZE * (slot)))
+
+/* Hands the held slot back to the MAC and unmasks the RX event again. */
+static void rx_slot_release(void)
+{
+    rx_desc.ready = 0;
+    rx_desc.lent = 0;
+    rx_frames++; // Held frames are counted once acknowledged
+    udp_rx_release();
+    ethmac_sram_writer_ev_enable_write(1);
+}
+
+/* Drops a frame nobody has started reading; a slot lent to WolfSSL stays put. */
+void flush_rx_queue(void){
+    unsigned int old_ie = irq_getie();
+    irq_setie(0);
+
+    if (rx_desc.ready && !rx_desc.lent)
+        rx_slot_release();
+
+    irq_setie(old_ie);
+}
+#else
 /*  Ring Buffer for buffering incoming UDP packets from the ISR and
     it decouples the high-speed Interrupt Handler from the slower WolfSSL read loop. */
-#define MAX_PACKET_SIZE 1500
 #define RX_QUEUE_DEPTH 16
 
 typedef struct
@@ -124,8 +201,15 @@ typedef struct
     uint32_t len;
     uint32_t read_offset;   // Tracks how much WolfSSL has read from this packet
     volatile uint8_t ready; // 1 if packet contains data, 0 if empty
+#ifdef WOLFSSL_DTLS_CID
+    uint32_t src_ip;        // Where the datagram came from
+    uint16_t src_port;
+#endif
 } PacketSlot;
 
+static volatile uint8_t rx_queued = 0;  // Entries holding a datagram
+
+#ifndef DTLS_SESSIONS
 static PacketSlot rx_queue[RX_QUEUE_DEPTH];
 static volatile uint8_t write_idx = 0;
 static volatile uint8_t read_idx = 0;
@@ -141,17 +225,256 @@ void flush_rx_queue(void){
     }
     write_idx = 0;
     read_idx = 0;
+    rx_queued = 0;
+
+    /* A frame held back while the queue was full is stale as well */
+    if (udp_rx_held()){
+        rx_frames++; // Acknowledged here, not by the ISR
+        udp_rx_release();
+        ethmac_sram_writer_ev_enable_write(1);
+    }
     irq_setie(old_ie); // Restore IRQ
 }
+#endif /* DTLS_SESSIONS */
+
+/* A queue entry was freed: offer the frame held in its MAC slot again.
+   Unmasking the pending RX event re-enters the ISR as soon as IRQs are on. */
+static void rx_queue_resume(void)
+{
+    unsigned int old_ie = irq_getie();
+    irq_setie(0);
+
+    if (udp_rx_held()){
+        udp_rx_retry();
+        ethmac_sram_writer_ev_enable_write(1);
+    }
+
+    irq_setie(old_ie);
+}
+#endif /* WOLFSSL_ZERO_COPY_RX */
+
+#ifdef DTLS_SESSIONS
+/*                  */
+/* SESSION DEMUXING */
+/*                  */
+
+/*  DTLS_SESSIONS handshakes run side by side. Session i talks from port
+    SOC_SRC_PORT + i to a server listening on HOST_DST_PORT + i, the ISR sorts
+    datagrams to their session by (source IP, source port, destination port). */
+#ifndef SESSION_RX_DEPTH
+#define SESSION_RX_DEPTH 4
+#endif
+
+enum { SESS_IDLE, SESS_HANDSHAKE, SESS_DONE, SESS_FAILED };
+
+typedef struct
+{
+    WOLFSSL *ssl;
+    uint8_t id;
+    volatile uint8_t state;
+    uint8_t want_write;     // Last step stopped on a full TX ring
+#ifdef WOLFSSL_PQC_NONBLOCK
+    uint8_t pending;        // Last step stopped between PQC slices
+#endif
+    uint16_t local_port;
+    uint16_t peer_port;
+    uint32_t steps;         // wolfSSL_connect calls
+    uint64_t busy_clks;     // Cycles spent inside wolfSSL_connect
+    uint64_t start_clks;
+    uint64_t end_clks;
+#ifndef WOLFSSL_ZERO_COPY_RX
+    PacketSlot rxq[SESSION_RX_DEPTH];
+    volatile uint8_t rx_write;
+    volatile uint8_t rx_read;
+    volatile uint8_t rx_count; // Entries of rxq holding a datagram
+#endif
+} DtlsSession;
+
+static DtlsSession sessions[DTLS_SESSIONS];
+static uint32_t sched_ready = 0;   // Steps given to a session with input waiting
+static uint32_t sched_polls = 0;   // Steps with no input anywhere, for timeouts
+
+/* Finds the session a datagram belongs to, NULL if nobody is waiting for it. */
+static DtlsSession *session_lookup(uint32_t src_ip, uint16_t src_port, uint16_t dst_port)
+{
+    if (src_ip != host_ip)
+        return NULL;
+
+    for (int i = 0; i < DTLS_SESSIONS; i++){
+        DtlsSession *s = &sessions[i];
+        if (s->state == SESS_HANDSHAKE && s->local_port == dst_port && s->peer_port == src_port)
+            return s;
+    }
+    return NULL;
+}
+
+/* 1 if a datagram for the session is waiting to be read. */
+static int session_has_input(DtlsSession *s)
+{
+#ifdef WOLFSSL_ZERO_COPY_RX
+    return rx_desc.ready && !rx_desc.lent && rx_desc.session == s->id;
+#else
+    return s->rxq[s->rx_read].ready;
+#endif
+}
+
+/* Drops what is queued for one session, the other sessions keep their input. */
+static void session_flush_rx(DtlsSession *s)
+{
+    unsigned int old_ie = irq_getie();
+    irq_setie(0);
+
+#ifdef WOLFSSL_ZERO_COPY_RX
+    if (rx_desc.ready && !rx_desc.lent && rx_desc.session == s->id)
+        rx_slot_release();
+#else
+    for (int i = 0; i < SESSION_RX_DEPTH; i++){
+        s->rxq[i].ready = 0;
+        s->rxq[i].read_offset = 0;
+    }
+    rx_queued -= s->rx_count;
+    s->rx_count = 0;
+    s->rx_write = 0;
+    s->rx_read = 0;
+#endif
+
+    irq_setie(old_ie);
+
+#ifndef WOLFSSL_ZERO_COPY_RX
+    rx_queue_resume(); // A frame held back may have been waiting for this queue
+#endif
+}
+#endif /* DTLS_SESSIONS */
+
+#if defined(WOLFSSL_DTLS_CID) && !defined(DTLS_SESSIONS)
+/*               */
+/* CONNECTION ID */
+/*               */
+
+/*  With a connection ID the server puts our CID in every record it sends once
+    the handshake is done, so its records stay recognisable when a NAT in
+    between hands out a new address or port. The ISR only checks the CID, the
+    new address replaces the peer once WolfSSL has authenticated a record
+    from it (cid_peer_update). */
+#define CID_LEN 4
+
+static uint8_t cid_rx[CID_LEN];           // CID the server sends to us
+static volatile uint8_t cid_rx_len = 0;   // Set once the CID is negotiated
+static volatile uint32_t peer_ip;         // Server address records are accepted from
+static volatile uint16_t peer_port;
+static uint32_t last_src_ip;              // Source of the datagram WolfSSL read last
+static uint16_t last_src_port;
+static uint32_t cid_move_ip;              // Authenticated new peer address, not applied yet
+static uint16_t cid_move_port;
+static uint8_t cid_move_pending = 0;
+static uint32_t cid_rebinds = 0;          // Peer address changes
+static volatile uint32_t cid_rejected = 0; // Datagrams from elsewhere without our CID
+
+/* 1 if a datagram may be queued: it comes from the current peer, or it
+   starts with a record carrying our CID. */
+static int cid_peer_accepts(uint32_t src_ip, uint16_t src_port, const uint8_t *data, uint32_t length)
+{
+    if (src_ip == peer_ip && src_port == peer_port)
+        return 1;
+    if (cid_rx_len == 0)
+        return 0;
+
+    const unsigned char *cid = wolfSSL_dtls_cid_parse(data, length, cid_rx_len);
+    if (cid == NULL || memcmp(cid, cid_rx, cid_rx_len) != 0){
+        cid_rejected++;
+        return 0;
+    }
+    return 1;
+}
+
+/* Called after every wolfSSL_read. When it returned data, the datagram it
+   was read from came through the CID check and decrypted, so if it arrived
+   from a new address the server has moved: send there from now on. The ARP
+   lookup for a new address polls the MAC for the reply, which cannot get
+   past a held RX frame, so the move waits for a read with no frame held. */
+static void cid_peer_update(int authenticated)
+{
+    if (authenticated){
+        cid_move_ip = last_src_ip;
+        cid_move_port = last_src_port;
+        cid_move_pending = (last_src_ip != peer_ip || last_src_port != peer_port);
+    }
+    if (!cid_move_pending)
+        return;
+
+    unsigned int old_ie = irq_getie();
+    irq_setie(0);
+    if (cid_move_ip != peer_ip){
+        if (udp_rx_held()){
+            irq_setie(old_ie);
+            return;
+        }
+        if (!udp_arp_resolve(cid_move_ip)){
+            cid_move_pending = 0;
+            udp_arp_resolve(peer_ip); // Keep sending to the old address
+            irq_setie(old_ie);
+            printf("[CID] No ARP reply from the new peer address\n");
+            return;
+        }
+    }
+    peer_ip = cid_move_ip;
+    peer_port = cid_move_port;
+    cid_move_pending = 0;
+    irq_setie(old_ie);
+
+    cid_rebinds++;
+    printf("[CID] Peer moved to port %u\n", (unsigned)peer_port);
+}
+
+/* Negotiates a CID in the handshake. */
+static void cid_setup(WOLFSSL *ssl)
+{
+    uint8_t cid[CID_LEN];
+
+    CustomRngGenerateBlock(cid, sizeof(cid));
+    if (wolfSSL_dtls_cid_use(ssl) != WOLFSSL_SUCCESS ||
+        wolfSSL_dtls_cid_set(ssl, cid, sizeof(cid)) != WOLFSSL_SUCCESS)
+        printf("DTLS Connection ID not available\n");
+
+    cid_rx_len = 0;
+    cid_move_pending = 0;
+    peer_ip = host_ip;
+    peer_port = HOST_DST_PORT;
+}
+
+/* Arms the ISR check once the handshake has settled the CID. */
+static void cid_start(WOLFSSL *ssl)
+{
+    unsigned int sz = 0;
+
+    if (wolfSSL_dtls_cid_get_rx_size(ssl, &sz) != WOLFSSL_SUCCESS || sz == 0 || sz > CID_LEN){
+        printf("DTLS Connection ID: not negotiated\n");
+        return;
+    }
+    wolfSSL_dtls_cid_get_rx(ssl, cid_rx, sizeof(cid_rx));
+    cid_rx_len = (uint8_t)sz;
+    printf("DTLS Connection ID: %u bytes\n", sz);
+}
+#endif /* WOLFSSL_DTLS_CID && !DTLS_SESSIONS */
 
 /*                   */
 /* INTERRUPT HANDLER */
 /*                   */
 
-/*Runs immediately when the Ethernet hardware raises an interrupt.*/
+/*Runs immediately when the Ethernet hardware raises an interrupt.
+  Drains every frame the MAC has received, not just one per interrupt. */
 void eth_irq_handler(void)
 {
-    udp_service();
+    uint32_t n = (uint32_t)udp_drain();
+
+    rx_frames += n;
+    if (n > rx_batch_max)
+        rx_batch_max = n;
+
+    /* A held frame keeps the writer event pending, mask it until the slot is
+       released (zero-copy) or the queue has room again (backpressure). */
+    if (udp_rx_held())
+        ethmac_sram_writer_ev_enable_write(0);
 }
 
 /*                            */
@@ -172,54 +495,176 @@ int my_verify_cb(int preverify, WOLFSSL_X509_STORE_CTX *store)
     return preverify;
 }
 
+#ifdef WOLFSSL_ZERO_COPY_RX
 /* Called by udp_service() inside the ISR context,
-   it filters packets and pushes them into the Ring Buffer. */
-static void my_udp_rx(uint32_t src_ip, uint16_t src_port, uint16_t dst_port, void *data, uint32_t length)
+   it filters packets and records the slot descriptor (no copy). */
+static int my_udp_rx_zc(uint32_t src_ip, uint16_t src_port, uint16_t dst_port, uint32_t slot, void *data, uint32_t length)
 {
+#ifdef DTLS_SESSIONS
+    DtlsSession *sess = session_lookup(src_ip, src_port, dst_port);
+    if (sess == NULL)
+        return 0;
+#elif defined(WOLFSSL_DTLS_CID)
+    if (!cid_peer_accepts(src_ip, src_port, data, length))
+        return 0;
+#else
     if (src_ip != host_ip || src_port != HOST_DST_PORT)
-        return;
+        return 0;
+#endif
 
     if (length > MAX_PACKET_SIZE)
-        return;
+        return 0;
+
+    rx_desc.slot = slot;
+    rx_desc.offset = (uint32_t)((uint8_t *)data - RX_SLOT_BASE(slot));
+    rx_desc.len = length;
+    rx_desc.lent = 0;
+#ifdef DTLS_SESSIONS
+    rx_desc.session = sess->id;
+#endif
+#ifdef WOLFSSL_DTLS_CID
+    rx_desc.src_ip = src_ip;
+    rx_desc.src_port = src_port;
+#endif
+    rx_desc.ready = 1;
 
-    if (rx_queue[write_idx].ready){
-        return;
+#ifdef DEBUG
+    printf("[IO-IRQ] Holding packet in ethmac slot %ld (%ld bytes)\n", slot, length);
+#endif
+
+    return 1; // Keep the frame in its slot
+}
+#else
+/* Called by udp_service() inside the ISR context,
+   it filters packets and pushes them into the Ring Buffer.
+   When the ring is full the frame stays in its ethmac slot (backpressure)
+   and is offered again once EmbedReceive frees an entry. */
+static int my_udp_rx(uint32_t src_ip, uint16_t src_port, uint16_t dst_port, uint32_t slot, void *data, uint32_t length)
+{
+#ifdef DTLS_SESSIONS
+    DtlsSession *sess = session_lookup(src_ip, src_port, dst_port);
+    if (sess == NULL)
+        return 0;
+    PacketSlot *entry = &sess->rxq[sess->rx_write];
+#else
+#ifdef WOLFSSL_DTLS_CID
+    if (!cid_peer_accepts(src_ip, src_port, data, length))
+        return 0;
+#else
+    if (src_ip != host_ip || src_port != HOST_DST_PORT)
+        return 0;
+#endif
+    PacketSlot *entry = &rx_queue[write_idx];
+#endif
+
+    if (length > MAX_PACKET_SIZE)
+        return 0;
+
+    if (entry->ready){
+        rx_backpressure++;
+        return 1; // Hold the frame in the MAC
     }
 
-    memcpy(rx_queue[write_idx].data, data, length); // Copy data to software buffer
-    rx_queue[write_idx].len = length;
-    rx_queue[write_idx].read_offset = 0;
-    rx_queue[write_idx].ready = 1;
+    memcpy(entry->data, data, length); // Copy data to software buffer
+    entry->len = length;
+    entry->read_offset = 0;
+#ifdef WOLFSSL_DTLS_CID
+    entry->src_ip = src_ip;
+    entry->src_port = src_port;
+#endif
+    entry->ready = 1;
     
+#ifdef DTLS_SESSIONS
+#ifdef DEBUG
+    printf("[IO-IRQ] Queued packet for session %d at slot %d (%ld bytes)\n", sess->id, sess->rx_write, length);
+#endif
+    sess->rx_write = (sess->rx_write + 1) % SESSION_RX_DEPTH;
+    sess->rx_count++;
+#else
 #ifdef DEBUG
     printf("[IO-IRQ] Queued packet at slot %d (%ld bytes)\n", write_idx, length);
 #endif
-
     write_idx = (write_idx + 1) % RX_QUEUE_DEPTH; // Advance write pointer
+#endif
+    if (++rx_queued > rx_queue_hwm)
+        rx_queue_hwm = rx_queued;
+    return 0;
+}
+#endif /* WOLFSSL_ZERO_COPY_RX */
+
+/* Called by udp_service() inside the ISR context when the MAC has sent
+   queued frames, their TX slots are free again. */
+static void my_udp_tx_done(uint32_t frames)
+{
+    tx_frames_done += frames;
+}
+
+/* Waits for the MAC to send every frame still queued in the TX ring. */
+static void wait_tx_idle(void)
+{
+    uint32_t pending;
+    do {
+        unsigned int old_ie = irq_getie();
+        irq_setie(0);
+        pending = udp_tx_pending();
+        irq_setie(old_ie);
+    } while (pending);
+}
+
+/* Writes a message, retried while every TX slot is in flight. */
+static int write_msg(WOLFSSL *ssl, const char *msg)
+{
+    int ret;
+    do {
+        ret = wolfSSL_write(ssl, msg, strlen(msg));
+    } while (ret <= 0 && wolfSSL_get_error(ssl, ret) == WOLFSSL_ERROR_WANT_WRITE);
+    return ret;
 }
 
 /* Sends data over UDP. */
 static int EmbedSend(WOLFSSL *ssl, char *buf, int sz, void *ctx)
 {
-    /* 1. Flush Queue: Sending a new state, ignore old retransmissions. */
-    if (sz > 0)
-        flush_rx_queue();
+#ifdef DTLS_SESSIONS
+    DtlsSession *sess = (DtlsSession *)ctx;
+    uint16_t src_port = sess->local_port;
+    uint16_t dst_port = sess->peer_port;
+#else
+    uint16_t src_port = SOC_SRC_PORT;
+#ifdef WOLFSSL_DTLS_CID
+    uint16_t dst_port = peer_port;
+#else
+    uint16_t dst_port = HOST_DST_PORT;
+#endif
+#endif
 
-    /* 2. Disable interrupts here bcoz,'udp_send' manipulates the Ethernet
+    /* 1. Disable interrupts here bcoz,'udp_send' manipulates the Ethernet
        TX buffer descriptors. If an interrupt fires here 
        (triggering eth_irq_handler -> udp_service),
        the ISR might try to send an ARP reply, corrupting the shared TX state. */
     unsigned int old_ie = irq_getie();
     irq_setie(0);
 
-    uint8_t *tx_buf = (uint8_t *)udp_get_tx_buffer();
+    uint8_t *tx_buf = (uint8_t *)udp_try_tx_buffer();
 
     int ret = sz;
     if (tx_buf == NULL)    {
-        ret = WOLFSSL_CBIO_ERR_WANT_WRITE;  // Hardware buffer busy
+        ret = WOLFSSL_CBIO_ERR_WANT_WRITE;  // All TX slots in flight, retry later
+        tx_slot_busy++;
     }else{
-        memcpy(tx_buf, buf, sz);  // Copy data to hardware buffer and fire
-        udp_send(SOC_SRC_PORT, HOST_DST_PORT, sz);
+        /* 2. Flush Queue: Sending a new state, ignore old retransmissions.
+           Only once the datagram really goes out, a WANT_WRITE keeps them. */
+        if (sz > 0) {
+#ifdef DTLS_SESSIONS
+            session_flush_rx(sess);
+#else
+            flush_rx_queue();
+#endif
+        }
+
+        /* Records built in the lent slot (WOLFSSL_ZERO_COPY_TX) are already in place */
+        if ((uint8_t *)buf != tx_buf)
+            memmove(tx_buf, buf, sz);  // Copy data to hardware buffer and fire
+        udp_send(src_port, dst_port, sz);
         
         if (in_handshake) // Track metrics
             handshake_tx_bytes += sz;
@@ -230,15 +675,100 @@ static int EmbedSend(WOLFSSL *ssl, char *buf, int sz, void *ctx)
     return ret;
 }
 
+#ifdef WOLFSSL_ZERO_COPY_TX
+/* Lends the current ethmac TX slot to WolfSSL so records are encrypted straight into it.
+   EmbedSend then only fills in the headers. The slot stays reserved (no ARP/ICMP
+   replies) until it is sent or EmbedSendRelease hands it back. While every slot is
+   in flight WolfSSL builds the record in its own buffer instead. */
+static byte *EmbedSendGetBuffer(WOLFSSL *ssl, int *sz, void *ctx)
+{
+    (void)ssl;
+    (void)ctx;
+
+    unsigned int old_ie = irq_getie();
+    irq_setie(0);
+    byte *tx_buf = (byte *)udp_reserve_tx_buffer();
+    irq_setie(old_ie);
+
+    if (tx_buf == NULL)
+        return NULL;
+    *sz = (int)udp_get_tx_buffer_size();
+    return tx_buf;
+}
+
+/* Called by WolfSSL when it stops using the lent slot. An unsent slot (error path,
+   record moved to a grown buffer) is unreserved so ARP/ICMP replies resume. */
+static void EmbedSendRelease(WOLFSSL *ssl, byte *buf, void *ctx)
+{
+    (void)ssl;
+    (void)ctx;
+
+    unsigned int old_ie = irq_getie();
+    irq_setie(0);
+    udp_unreserve_tx_buffer(buf);
+    irq_setie(old_ie);
+}
+#endif
+
+#ifdef WOLFSSL_ZERO_COPY_RX
+/* Lends the held ethmac RX slot to WolfSSL, which decrypts the datagram in place. */
+static int EmbedReceiveZeroCopy(WOLFSSL *ssl, byte **buf, void *ctx)
+{
+    if (!rx_desc.ready || rx_desc.lent)
+        return WOLFSSL_CBIO_ERR_WANT_READ;
+#ifdef DTLS_SESSIONS
+    if (rx_desc.session != ((DtlsSession *)ctx)->id)
+        return WOLFSSL_CBIO_ERR_WANT_READ; // Another session's datagram
+#endif
+
+    rx_desc.lent = 1;
+    *buf = RX_SLOT_BASE(rx_desc.slot) + rx_desc.offset;
+#if defined(WOLFSSL_DTLS_CID) && !defined(DTLS_SESSIONS)
+    last_src_ip = rx_desc.src_ip;
+    last_src_port = rx_desc.src_port;
+#endif
+
+    if (in_handshake) // Track metrics
+        handshake_rx_bytes += rx_desc.len;
+
+    return rx_desc.len;
+}
+
+/* Called by WolfSSL once every record in the datagram has been consumed. */
+static void EmbedReceiveRelease(WOLFSSL *ssl, byte *buf, void *ctx)
+{
+    unsigned int old_ie = irq_getie();
+    irq_setie(0);
+
+    rx_slot_release();
+
+    irq_setie(old_ie);
+}
+#endif /* WOLFSSL_ZERO_COPY_RX */
+
 /* Reads data from our Ring Buffer (not directly from HW). */
 static int EmbedReceive(WOLFSSL *ssl, char *buf, int sz, void *ctx)
 {
+#ifdef WOLFSSL_ZERO_COPY_RX
+    /* Only reached if WolfSSL still has unread input; the zero-copy path does the rest. */
+    return WOLFSSL_CBIO_ERR_WANT_READ;
+#else
+#ifdef DTLS_SESSIONS
+    DtlsSession *sess = (DtlsSession *)ctx;
+    PacketSlot *slot = &sess->rxq[sess->rx_read];
+#else
     PacketSlot *slot = &rx_queue[read_idx];
+#endif
     
     if (!slot->ready){
         return WOLFSSL_CBIO_ERR_WANT_READ;
     }
 
+#if defined(WOLFSSL_DTLS_CID) && !defined(DTLS_SESSIONS)
+    last_src_ip = slot->src_ip;
+    last_src_port = slot->src_port;
+#endif
+
     uint32_t remaining = slot->len - slot->read_offset; // Calculating how much data is left in this packet
     int copy_len = (sz < remaining) ? sz : remaining;
 
@@ -246,14 +776,25 @@ static int EmbedReceive(WOLFSSL *ssl, char *buf, int sz, void *ctx)
     slot->read_offset += copy_len;
 
     if (slot->read_offset >= slot->len){
+        unsigned int old_ie = irq_getie();
+        irq_setie(0);
         slot->ready = 0;
+#ifdef DTLS_SESSIONS
+        sess->rx_read = (sess->rx_read + 1) % SESSION_RX_DEPTH;
+        sess->rx_count--;
+#else
         read_idx = (read_idx + 1) % RX_QUEUE_DEPTH;
+#endif
+        rx_queued--;
+        irq_setie(old_ie);
+        rx_queue_resume();
     }
 
     if (in_handshake) // Track metrics
         handshake_rx_bytes += copy_len;
         
     return copy_len;
+#endif /* WOLFSSL_ZERO_COPY_RX */
 }
 
 /*           */
@@ -285,17 +826,141 @@ void print_performance_report(void)
     }else{
         printf("    b. Efficiency (Handshake Phase): N/A (Handshake time is zero)\n");
     }
+    printf("    c. TX Ring: %lu frames sent, %lu sends deferred with all %d slots in flight\n",
+           (unsigned long)tx_frames_done, (unsigned long)tx_slot_busy, ETHMAC_TX_SLOTS);
+    printf("    d. RX Drain: %lu frames, up to %lu per interrupt, %lu held back, %lu dropped by the MAC\n",
+           (unsigned long)rx_frames, (unsigned long)rx_batch_max,
+           (unsigned long)rx_backpressure, (unsigned long)udp_rx_dropped());
+#ifndef WOLFSSL_ZERO_COPY_RX
+    printf("         - RX queue high-water mark: %lu of %d\n", (unsigned long)rx_queue_hwm, RX_QUEUE_DEPTH);
+#endif
+}
+
+#ifdef WOLFSSL_MLKEM_KEY_REUSE
+/* ML-KEM key pair reuse and matrix cache counters. Keygen cycles saved are
+   estimated from one timed keygen, only run when a pair was actually reused. */
+void print_mlkem_reuse_report(WOLFSSL_CTX *ctx)
+{
+    word32 generated = 0, reused = 0;
+    word32 hits = 0, misses = 0;
+
+    wolfSSL_CTX_GetMlKemKeyReuseStats(ctx, &generated, &reused);
+    printf("ML-KEM Key Reuse:\n");
+    printf("    a. Key pairs generated: %lu, key shares reused: %lu\n", (unsigned long)generated, (unsigned long)reused);
+#if !defined(SESSION_RESUME) && !defined(DTLS_SESSIONS)
+    printf("       (one handshake per boot, build with RESUME=1 or SESSIONS=<n> to reuse a pair)\n");
+#endif
+
+    if (reused > 0){
+        MlKemKey *key = wc_MlKemKey_New(WC_ML_KEM_512, NULL, INVALID_DEVID);
+        WC_RNG rng;
+
+        if (key != NULL && wc_InitRng(&rng) == 0){
+            uint64_t start = read_cycle64();
+            wc_MlKemKey_MakeKey(key, &rng);
+            uint64_t keygen_cycles = read_cycle64() - start;
+            printf("    b. Keygen cycles saved: ~%llu (%lu x %llu)\n", keygen_cycles * reused, (unsigned long)reused, keygen_cycles);
+            wc_FreeRng(&rng);
+        }
+        wc_MlKemKey_Delete(key, &key);
+    }
+
+#ifdef WOLFSSL_MLKEM_MATRIX_CACHE
+    wc_MlKemMatrixCache_GetStats(&hits, &misses);
+    printf("    c. Matrix cache: %lu hits, %lu misses\n", (unsigned long)hits, (unsigned long)misses);
+#endif
+    (void)hits;
+    (void)misses;
+}
+#endif /* WOLFSSL_MLKEM_KEY_REUSE */
+
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+/* Enables the cache with CERT_CACHE_KEY, given in hex at build time, as the
+   key of its entry MACs. The RNG here is not an entropy source, so it can't
+   provide one. */
+static void cert_cache_setup(WOLFSSL_CERT_MANAGER *cm)
+{
+    static const char hex[] = CERT_CACHE_KEY;
+    byte key[32];
+    word32 len = (word32)(sizeof(hex) - 1) / 2;
+    int ret = BAD_FUNC_ARG;
+
+    if (sizeof(hex) - 1 == len * 2 && len <= sizeof(key)){
+        ret = WOLFSSL_SUCCESS;
+        for (word32 i = 0; i < len * 2 && ret == WOLFSSL_SUCCESS; i++){
+            char c = hex[i];
+            int v = (c >= '0' && c <= '9') ? c - '0' :
+                    (c >= 'a' && c <= 'f') ? c - 'a' + 10 :
+                    (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+            if (v < 0)
+                ret = BAD_FUNC_ARG;
+            else if (i & 1)
+                key[i / 2] |= (byte)v;
+            else
+                key[i / 2] = (byte)(v << 4);
+        }
+    }
+    if (ret == WOLFSSL_SUCCESS)
+        ret = wolfSSL_CertManagerSetVerifiedCertCacheKey(cm, key, len);
+    if (ret == WOLFSSL_SUCCESS)
+        ret = wolfSSL_CertManagerSetVerifiedCertCache(cm, CERT_CACHE_AGE);
+    wc_ForceZero(key, sizeof(key));
+    if (ret != WOLFSSL_SUCCESS)
+        printf("Verified certificate cache not enabled (%d), check CERT_CACHE_KEY\n", ret);
+}
+
+/* Peer certificates whose signature check was skipped or performed. */
+void print_cert_cache_report(WOLFSSL_CTX *ctx)
+{
+    word32 hits = 0, misses = 0;
+
+    wolfSSL_CertManagerGetVerifiedCertCacheStats(wolfSSL_CTX_GetCertManager(ctx), &hits, &misses);
+    printf("Verified Certificate Cache:\n");
+    printf("    a. Signature checks skipped: %lu, performed: %lu\n", (unsigned long)hits, (unsigned long)misses);
+}
+#endif /* WOLFSSL_VERIFIED_CERT_CACHE */
+
+#ifdef WOLFSSL_DTLS13_RTT
+/* Round trip estimate behind the retransmission timer. */
+void print_rtt_report(WOLFSSL *ssl)
+{
+    word32 srtt = 0, rttvar = 0, rto = 0, samples = 0, timeouts = 0;
+
+    wolfSSL_GetDtls13RttStats(ssl, &srtt, &rttvar, &rto, &samples, &timeouts);
+    printf("DTLS Retransmission Timer:\n");
+    printf("    a. SRTT: %lu ms, RTTVAR: %lu ms (%lu samples)\n", (unsigned long)srtt, (unsigned long)rttvar, (unsigned long)samples);
+    printf("    b. RTO: %lu ms, timer expired %lu times\n", (unsigned long)rto, (unsigned long)timeouts);
+}
+#endif /* WOLFSSL_DTLS13_RTT */
+
+#ifdef WOLFSSL_PQC_NONBLOCK
+/* How the ML-DSA and ML-KEM work was cut up, and the longest connect call. */
+void print_pqc_nonblock_report(WOLFSSL *ssl, uint64_t max_step_clks)
+{
+    word32 steps = 0, yields = 0;
+
+    wolfSSL_GetPqcNonBlockStats(ssl, &steps, &yields);
+    printf("Non-blocking PQC (%lu cycle slices):\n", (unsigned long)PQC_NONBLOCK_CYCLES);
+    printf("    a. Steps: %lu, returned to the caller %lu times\n", (unsigned long)steps, (unsigned long)yields);
+    printf("    b. Longest wolfSSL_connect call: %lu ms (%llu cycles)\n", cycles_to_ms(max_step_clks), max_step_clks);
 }
+#endif /* WOLFSSL_PQC_NONBLOCK */
 
 /*            */
 /* MAIN LOGIC */
 /*            */
 
-/* The core state machine: Init -> Load Certs -> Handshake -> Data Test -> Report. */
-void run_dtls_client(void)
+/* Init -> Load Certs -> Verification setup, shared by every session. */
+static WOLFSSL_CTX *client_ctx_new(void)
 {
     // 1. Initialize WolfSSL with memory tracking
+#ifdef HEAP_ARENAS
+    if (mem_arena_init() != 0)
+        printf("Heap arenas incomplete, falling back to malloc\n");
+    wolfSSL_SetAllocators(ArenaMalloc, ArenaFree, ArenaRealloc);
+#else
     wolfSSL_SetAllocators(TrackMalloc, TrackFree, TrackRealloc);
+#endif
     wolfSSL_Init();
     #ifdef DEBUG
     wolfSSL_Debugging_ON();
@@ -304,15 +969,25 @@ void run_dtls_client(void)
     // 2. Create Context for DTLS 1.3
     WOLFSSL_CTX *ctx = wolfSSL_CTX_new(wolfDTLSv1_3_client_method());
     if (!ctx)
-        return;
+        return NULL;
 
     if (wolfSSL_CTX_set_cipher_list(ctx, "TLS13-CHACHA20-POLY1305-SHA256") != WOLFSSL_SUCCESS) {
         printf("Failed to set cipher list!\n");
     }
+#ifdef WOLFSSL_MLKEM_KEY_REUSE
+    // Same ML-KEM key pair for MLKEM_REUSE_USES handshakes, at most 10 minutes
+    wolfSSL_CTX_SetMlKemKeyReuse(ctx, MLKEM_REUSE_USES, 600);
+#endif
 
     // 3. Register Custom IO Callbacks
     wolfSSL_SetIORecv(ctx, EmbedReceive);
     wolfSSL_SetIOSend(ctx, EmbedSend);
+#ifdef WOLFSSL_ZERO_COPY_RX
+    wolfSSL_CTX_SetIORecvZeroCopy(ctx, EmbedReceiveZeroCopy, EmbedReceiveRelease);
+#endif
+#ifdef WOLFSSL_ZERO_COPY_TX
+    wolfSSL_CTX_SetIOSendZeroCopy(ctx, EmbedSendGetBuffer, EmbedSendRelease);
+#endif
 
     /* 
      * CERTIFICATE LOADING
@@ -347,23 +1022,108 @@ void run_dtls_client(void)
 
     // Check the server's cert against our CA, Check Server MUST send a cert.
     wolfSSL_CTX_set_verify(ctx, WOLFSSL_VERIFY_PEER | WOLFSSL_VERIFY_FAIL_IF_NO_PEER_CERT, my_verify_cb);
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+    // Trust a verified server certificate for CERT_CACHE_AGE seconds
+    cert_cache_setup(wolfSSL_CTX_GetCertManager(ctx));
+#endif
 
-    // Create SSL Object
-    WOLFSSL *ssl = wolfSSL_new(ctx);
-    // Set Post-Quantum Key Exchange (ML-KEM / Kyber)
-    wolfSSL_UseKeyShare(ssl, WOLFSSL_KYBER_LEVEL1);
+#ifdef WOLFSSL_MLKEM_KEY_POOL
+    // Generate the ML-KEM key shares now so ClientHello does not run keygen
+    uint64_t pool_start = read_cycle64();
+    while (wolfSSL_CTX_MlKemKeyPool_Generate(ctx, WOLFSSL_KYBER_LEVEL1) == 1)
+        ;
+    uint64_t pool_cycles = read_cycle64() - pool_start;
+    printf(" -> %d ML-KEM key share(s) pregenerated in %lu ms (%llu cycles).\n", wolfSSL_CTX_MlKemKeyPool_Count(ctx), cycles_to_ms(pool_cycles), pool_cycles);
+#endif
 
-    printf("Starting Handshake...\n");
+    return ctx;
+}
 
-    flush_rx_queue(); // Clear queue before we begin handshake to avoid stale packets
+#ifndef DTLS_SESSIONS
+#ifdef WOLFSSL_PQC_NONBLOCK
+static uint64_t pqc_max_step_clks = 0;  // Longest single wolfSSL_connect call
+#endif
 
-    uint64_t hs_start_clocks = read_cycle64();
-    
+/* wolfSSL_read that follows the server to a new address once a record
+   from there has decrypted (WOLFSSL_DTLS_CID). */
+static int client_read(WOLFSSL *ssl, void *buf, int sz)
+{
+    int ret = wolfSSL_read(ssl, buf, sz);
+#ifdef WOLFSSL_DTLS_CID
+    cid_peer_update(ret > 0);
+#endif
+    return ret;
+}
+
+#ifdef SESSION_RESUME
+#define TICKET_WAIT_MS 2000 // How long to wait for NewSessionTicket
+
+/* The session of the first handshake, kept for the reconnect. There is no
+   SPI flash in the sim SoC, so the store lives in RAM. */
+static WOLFSSL_SESSION *stored_session = NULL;
+static uint8_t ticket_received = 0;
+
+/* Called by WolfSSL while it takes a NewSessionTicket apart. The session is
+   only complete once the message has been processed, so just note it. */
+static int session_ticket_cb(WOLFSSL *ssl, const unsigned char *ticket, int len, void *ctx)
+{
+    (void)ssl;
+    (void)ticket;
+    (void)ctx;
+
+    if (len > 0)
+        ticket_received = 1;
+    return 0;
+}
+
+/* Reads until the server's NewSessionTicket has arrived or TICKET_WAIT_MS
+   has passed, then keeps a reference to the session. */
+static void store_session_ticket(WOLFSSL *ssl)
+{
+    char buf[64];
+    uint64_t start = read_cycle64();
+
+    while (!ticket_received && cycles_to_ms(read_cycle64() - start) < TICKET_WAIT_MS){
+        int ret = client_read(ssl, buf, sizeof(buf));
+        if (ret <= 0){
+            int err = wolfSSL_get_error(ssl, ret);
+            if (err != WOLFSSL_ERROR_WANT_READ && err != WOLFSSL_ERROR_WANT_WRITE)
+                break;
+        }
+    }
+
+    if (!ticket_received){
+        printf("No session ticket received, reconnect skipped\n");
+        return;
+    }
+    stored_session = wolfSSL_get1_session(ssl);
+    printf("Session ticket stored\n");
+}
+#endif
+
+/* Runs wolfSSL_connect until the handshake is done or fails, with the
+   handshake arenas selected. */
+static void client_handshake(WOLFSSL *ssl)
+{
     in_handshake = 1;
+#ifdef HEAP_ARENAS
+    mem_arena_select(MEM_ARENA_HANDSHAKE);
+#endif
+#ifdef CYCLE_TRACE
+    int trace_tok = trace_begin(TRACE_HANDSHAKE); // Root of the library spans
+#endif
 
     // --- HANDSHAKE LOOP ---
     while (1){
+#ifdef WOLFSSL_PQC_NONBLOCK
+        uint64_t step_start = read_cycle64();
+        int ret = wolfSSL_connect(ssl);
+        uint64_t step_clks = read_cycle64() - step_start;
+        if (step_clks > pqc_max_step_clks)
+            pqc_max_step_clks = step_clks;
+#else
         int ret = wolfSSL_connect(ssl);
+#endif
 
         if (ret == WOLFSSL_SUCCESS){
             printf("=======================================\n");
@@ -373,15 +1133,144 @@ void run_dtls_client(void)
         int err = wolfSSL_get_error(ssl, ret);
 
         if (err == WOLFSSL_ERROR_WANT_READ || err == WOLFSSL_ERROR_WANT_WRITE){
+#ifdef WOLFSSL_DTLS13_RTT
+            if (err == WOLFSSL_ERROR_WANT_READ && wolfSSL_dtls13_rtx_timer_expired(ssl))
+                wolfSSL_dtls_got_timeout(ssl); // Resend our flight or ACK what arrived
+#endif
             continue;
         }
+#ifdef WOLFSSL_PQC_NONBLOCK
+        if (err == WC_PENDING_E){
+            continue; // Slice used up, the next call carries on
+        }
+#endif
 
         char errstr[80];
         wc_ErrorString(err, errstr);
         printf("Err: %d %s\n", err, errstr);
         break;
     }
+#ifdef CYCLE_TRACE
+    trace_end(trace_tok);
+#endif
     in_handshake = 0;
+#ifdef HEAP_ARENAS
+    // Long-lived blocks went to the session arena by type, so both handshake
+    // arenas must be empty now; any block left is listed and keeps it alive.
+    mem_arena_select(MEM_ARENA_SESSION);
+    int hs_live = mem_arena_release(MEM_ARENA_SCRATCH);
+    hs_live += mem_arena_release(MEM_ARENA_HANDSHAKE);
+    if (hs_live > 0)
+        printf("Handshake arena: %d block(s) outlive the handshake\n", hs_live);
+    else
+        printf("Handshake arena: released\n");
+#endif
+}
+
+#ifdef WOLFSSL_DTLS_CID
+#define REPLY_WAIT_MS 2000 // How long to wait for the server's answer
+
+/* Reads the server's answer to the first message. If a NAT moved the
+   server's side meanwhile, its CID-tagged records are followed here. */
+static void wait_server_reply(WOLFSSL *ssl)
+{
+    char reply[80];
+    uint64_t start = read_cycle64();
+
+    while (cycles_to_ms(read_cycle64() - start) < REPLY_WAIT_MS){
+        int ret = client_read(ssl, reply, sizeof(reply) - 1);
+        if (ret > 0){
+            reply[ret] = '\0';
+            printf("MSG received: %s\n", reply);
+            return;
+        }
+        int err = wolfSSL_get_error(ssl, ret);
+        if (err != WOLFSSL_ERROR_WANT_READ && err != WOLFSSL_ERROR_WANT_WRITE)
+            break;
+    }
+    printf("No reply from the server\n");
+}
+
+/* CID state at the end of the run. */
+static void print_cid_report(void)
+{
+    printf("DTLS Connection ID:\n");
+    printf("    a. Negotiated: %s (%u bytes)\n", cid_rx_len ? "yes" : "no", (unsigned)cid_rx_len);
+    printf("    b. Peer address changes: %lu, datagrams without our CID: %lu\n", (unsigned long)cid_rebinds, (unsigned long)cid_rejected);
+}
+#endif
+
+#ifdef SESSION_RESUME
+/* Reconnects with the stored ticket. The PSK comes from the ticket and a
+   fresh ML-KEM share is still exchanged (psk_dhe_ke), so the server sends
+   no certificate chain and the ML-DSA checks are skipped. */
+static void resume_session(WOLFSSL_CTX *ctx)
+{
+    WOLFSSL *ssl = wolfSSL_new(ctx);
+    wolfSSL_UseKeyShare(ssl, WOLFSSL_KYBER_LEVEL1);
+#ifdef WOLFSSL_DTLS_CID
+    cid_setup(ssl);
+#endif
+    if (wolfSSL_set_session(ssl, stored_session) != WOLFSSL_SUCCESS)
+        printf("Stored session rejected, doing a full handshake\n");
+
+    printf("Reconnecting with session ticket...\n");
+    flush_rx_queue();
+    dilith_start_clks = dilith_end_clks = 0;
+
+    uint64_t hs_start_clocks = read_cycle64();
+    client_handshake(ssl);
+    uint64_t hs_end_clocks = read_cycle64();
+
+    if (wolfSSL_is_init_finished(ssl)){
+#ifdef WOLFSSL_DTLS_CID
+        cid_start(ssl);
+#endif
+        printf("Session resumed: %s\n", wolfSSL_session_reused(ssl) ? "yes" : "no");
+        printf("Time taken (full handshake): %lu ms\n", (unsigned long)handshake_ms);
+        printf("Time taken (resumed handshake): %lu ms (%llu cycles)\n", cycles_to_ms(hs_end_clocks - hs_start_clocks), hs_end_clocks - hs_start_clocks);
+        printf("Time taken (Peer cert verification): %lu ms\n", cycles_to_ms(dilith_end_clks - dilith_start_clks));
+
+        char *msg = "RISC-V Simulation complete (resumed)\n";
+        write_msg(ssl, msg);
+    }
+
+    wolfSSL_free(ssl);
+    wolfSSL_SESSION_free(stored_session);
+    stored_session = NULL;
+}
+#endif
+
+/* The core state machine: Init -> Load Certs -> Handshake -> Data Test -> Report. */
+void run_dtls_client(void)
+{
+    WOLFSSL_CTX *ctx = client_ctx_new();
+    if (!ctx)
+        return;
+
+    // Create SSL Object
+    WOLFSSL *ssl = wolfSSL_new(ctx);
+    // Set Post-Quantum Key Exchange (ML-KEM / Kyber)
+    wolfSSL_UseKeyShare(ssl, WOLFSSL_KYBER_LEVEL1);
+#ifdef WOLFSSL_PQC_NONBLOCK
+    // Hand control back every PQC_NONBLOCK_CYCLES during ML-DSA/ML-KEM work
+    if (wolfSSL_UsePqcNonBlock(ssl, PQC_NONBLOCK_CYCLES) != WOLFSSL_SUCCESS)
+        printf("Non-blocking PQC not available\n");
+#endif
+#ifdef SESSION_RESUME
+    wolfSSL_set_SessionTicket_cb(ssl, session_ticket_cb, NULL);
+#endif
+#ifdef WOLFSSL_DTLS_CID
+    cid_setup(ssl);
+#endif
+
+    printf("Starting Handshake...\n");
+
+    flush_rx_queue(); // Clear queue before we begin handshake to avoid stale packets
+
+    uint64_t hs_start_clocks = read_cycle64();
+    
+    client_handshake(ssl);
 
     // Handshake Metrics
     printf("Time taken (Peer cert verification): %lu ms (%llu cycles)\n", cycles_to_ms(dilith_end_clks - dilith_start_clks), dilith_end_clks - dilith_start_clks);
@@ -395,10 +1284,19 @@ void run_dtls_client(void)
         uint64_t hs_end_clocks = read_cycle64();
         printf("Time taken (handshake): %lu ms (%llu cycles)\n", cycles_to_ms(hs_end_clocks - hs_start_clocks), hs_end_clocks - hs_start_clocks);
         handshake_ms = cycles_to_ms(hs_end_clocks - hs_start_clocks);
+#ifdef WOLFSSL_DTLS_CID
+        cid_start(ssl);
+#endif
+#ifdef SESSION_RESUME
+        store_session_ticket(ssl); // Before the next write flushes the RX queue
+#endif
         
         char *msg = "RISC-V Simulation complete\n\n"; // Send initial completion message
-        wolfSSL_write(ssl, msg, strlen(msg));
+        write_msg(ssl, msg);
         printf("MSG sent: %s", msg);
+#ifdef WOLFSSL_DTLS_CID
+        wait_server_reply(ssl);
+#endif
     }
 
     client_end_clocks = read_cycle64();
@@ -429,35 +1327,370 @@ void run_dtls_client(void)
         bytes_to_send -= ret;
     }
 
+    wait_tx_idle(); // Count the frames still queued in the TX ring
     t_data_end = read_cycle64(); // Stop Timer
     data_cycles = t_data_end - t_data_start;
 
     // Final message after the throughput test
     char *msg = "RISC-V Simulation complete\n";
-    wolfSSL_write(ssl, msg, strlen(msg));
+    write_msg(ssl, msg);
 
     // PRINT THE REPORT
     print_performance_report();
+#ifdef WOLFSSL_MLKEM_KEY_REUSE
+    print_mlkem_reuse_report(ctx);
+#endif
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+    print_cert_cache_report(ctx);
+#endif
+#ifdef WOLFSSL_PQC_NONBLOCK
+    print_pqc_nonblock_report(ssl, pqc_max_step_clks);
+#endif
+#ifdef WOLFSSL_DTLS_CID
+    print_cid_report();
+#endif
+#ifdef WOLFSSL_DTLS13_RTT
+    print_rtt_report(ssl);
+#endif
 
     // Cleanup
     wolfSSL_free(ssl);
+#ifdef SESSION_RESUME
+    if (stored_session)
+        resume_session(ctx);
+#endif
+#ifdef HEAP_ARENAS
+    mem_arena_release(MEM_ARENA_SCRATCH);
+    mem_arena_release(MEM_ARENA_HANDSHAKE);
+    mem_arena_report();
+#endif
+#ifdef MEM_PROFILE
+    mem_profile_report();
+#endif
+#ifdef CYCLE_TRACE
+    trace_dump(); // Includes the resumed handshake
+#endif
+    wolfSSL_CTX_free(ctx);
+    wolfSSL_Cleanup();
+}
+#else
+/* Runs wolfSSL_connect once for a session and records how it stopped. */
+static void session_step(DtlsSession *s)
+{
+    uint64_t start = read_cycle64();
+
+    if (s->steps++ == 0)
+        s->start_clks = start;
+
+    int ret = wolfSSL_connect(s->ssl);
+    uint64_t now = read_cycle64();
+    s->busy_clks += now - start;
+
+    if (ret == WOLFSSL_SUCCESS){
+        s->state = SESS_DONE;
+        s->end_clks = now;
+        return;
+    }
+
+    int err = wolfSSL_get_error(s->ssl, ret);
+
+#ifdef WOLFSSL_PQC_NONBLOCK
+    s->pending = (err == WC_PENDING_E);
+    if (s->pending)
+        return;
+#endif
+    if (err == WOLFSSL_ERROR_WANT_READ || err == WOLFSSL_ERROR_WANT_WRITE){
+        s->want_write = (err == WOLFSSL_ERROR_WANT_WRITE);
+#ifdef WOLFSSL_DTLS13_RTT
+        if (!s->want_write && wolfSSL_dtls13_rtx_timer_expired(s->ssl))
+            wolfSSL_dtls_got_timeout(s->ssl);
+#endif
+        return;
+    }
+
+    char errstr[80];
+    wc_ErrorString(err, errstr);
+    printf("Session %d: Err: %d %s\n", s->id, err, errstr);
+    s->state = SESS_FAILED;
+    s->end_clks = now;
+}
+
+/* Cooperative round-robin over the unfinished sessions. A session with a
+   datagram waiting or a send to retry goes first, otherwise the next one in
+   turn is polled so its retransmissions still go out. A step runs until
+   WolfSSL needs more input, so one session's ML-KEM or ML-DSA work fills the
+   time the other sessions spend waiting for their server. */
+static void run_scheduler(void)
+{
+    int active = 0;
+    int next = 0;
+
+    for (int i = 0; i < DTLS_SESSIONS; i++)
+        if (sessions[i].state == SESS_HANDSHAKE)
+            active++;
+
+    while (active > 0){
+        DtlsSession *s = NULL;
+
+        for (int k = 0; k < DTLS_SESSIONS && s == NULL; k++){
+            DtlsSession *c = &sessions[(next + k) % DTLS_SESSIONS];
+            if (c->state == SESS_HANDSHAKE && (c->want_write || session_has_input(c)
+#ifdef WOLFSSL_PQC_NONBLOCK
+                    || c->pending
+#endif
+                    ))
+                s = c;
+        }
+        if (s != NULL){
+            sched_ready++;
+        }else{
+            for (int k = 0; k < DTLS_SESSIONS && s == NULL; k++){
+                DtlsSession *c = &sessions[(next + k) % DTLS_SESSIONS];
+                if (c->state == SESS_HANDSHAKE)
+                    s = c;
+            }
+            sched_polls++;
+        }
+
+        session_step(s);
+        next = (s->id + 1) % DTLS_SESSIONS;
+
+        if (s->state != SESS_HANDSHAKE){
+            session_flush_rx(s); // Nothing reads this session's input any more
+            active--;
+        }
+    }
+}
+
+/* Per-session handshake times and the aggregate handshake rate. */
+void print_session_report(uint64_t wall_cycles)
+{
+    uint32_t wall_ms = cycles_to_ms(wall_cycles);
+    uint64_t sum_cycles = 0;
+    int done = 0;
+
+    if (wall_ms == 0)  // Safety check
+        wall_ms = 1;
+
+    printf("Sessions:\n");
+    printf("    a. Per session:\n");
+    for (int i = 0; i < DTLS_SESSIONS; i++){
+        DtlsSession *s = &sessions[i];
+        uint64_t hs_cycles = (s->steps > 0) ? s->end_clks - s->start_clks : 0;
+
+        printf("         - %d (%u -> %u): %s in %lu ms, %lu steps, %lu ms inside wolfSSL_connect\n",
+               i, s->local_port, s->peer_port, (s->state == SESS_DONE) ? "done" : "failed",
+               (unsigned long)cycles_to_ms(hs_cycles), (unsigned long)s->steps,
+               (unsigned long)cycles_to_ms(s->busy_clks));
+        if (s->state == SESS_DONE){
+            sum_cycles += hs_cycles;
+            done++;
+        }
+    }
+
+    uint32_t rate100 = (uint32_t)((uint64_t)done * 100000 / wall_ms);      // Handshakes/s x100
+    uint32_t overlap100 = (uint32_t)(cycles_to_ms(sum_cycles) * 100 / wall_ms);
+    printf("    b. Handshakes: %d of %d completed in %lu ms, %lu.%02lu per second\n",
+           done, DTLS_SESSIONS, (unsigned long)wall_ms,
+           (unsigned long)(rate100 / 100), (unsigned long)(rate100 % 100));
+    printf("    c. Overlap (sum of handshake times / wall time): %lu.%02lux\n",
+           (unsigned long)(overlap100 / 100), (unsigned long)(overlap100 % 100));
+    printf("    d. Scheduler: %lu steps with input waiting, %lu polls\n",
+           (unsigned long)sched_ready, (unsigned long)sched_polls);
+}
+
+/* DTLS_SESSIONS handshakes at once: Init -> Load Certs -> Handshakes -> Report. */
+void run_dtls_sessions(void)
+{
+    WOLFSSL_CTX *ctx = client_ctx_new();
+    if (!ctx)
+        return;
+
+    for (int i = 0; i < DTLS_SESSIONS; i++){
+        DtlsSession *s = &sessions[i];
+
+        s->id = i;
+        s->local_port = SOC_SRC_PORT + i;
+        s->peer_port = HOST_DST_PORT + i;
+        s->ssl = wolfSSL_new(ctx);
+        if (s->ssl == NULL){
+            printf("Session %d: wolfSSL_new failed\n", i);
+            s->state = SESS_FAILED;
+            continue;
+        }
+        // Set Post-Quantum Key Exchange (ML-KEM / Kyber)
+        wolfSSL_UseKeyShare(s->ssl, WOLFSSL_KYBER_LEVEL1);
+#ifdef WOLFSSL_PQC_NONBLOCK
+        // Slices let the scheduler switch sessions inside ML-DSA/ML-KEM work
+        wolfSSL_UsePqcNonBlock(s->ssl, PQC_NONBLOCK_CYCLES);
+#endif
+        wolfSSL_SetIOReadCtx(s->ssl, s);
+        wolfSSL_SetIOWriteCtx(s->ssl, s);
+        s->state = SESS_HANDSHAKE;
+    }
+
+    printf("Starting %d Handshakes...\n", DTLS_SESSIONS);
+
+    uint64_t hs_start_clocks = read_cycle64();
+
+    in_handshake = 1;
+#ifdef HEAP_ARENAS
+    mem_arena_select(MEM_ARENA_HANDSHAKE);
+#endif
+
+#ifdef CYCLE_TRACE
+    int trace_tok = trace_begin(TRACE_HANDSHAKE); // Spans of all sessions nest in here
+#endif
+    run_scheduler();
+#ifdef CYCLE_TRACE
+    trace_end(trace_tok);
+#endif
+
+    in_handshake = 0;
+#ifdef HEAP_ARENAS
+    mem_arena_select(MEM_ARENA_SESSION);
+    int hs_live = mem_arena_release(MEM_ARENA_SCRATCH);
+    hs_live += mem_arena_release(MEM_ARENA_HANDSHAKE);
+    if (hs_live > 0)
+        printf("Handshake arena: %d block(s) outlive the handshakes\n", hs_live);
+    else
+        printf("Handshake arena: released\n");
+#endif
+    uint64_t hs_end_clocks = read_cycle64();
+    handshake_ms = cycles_to_ms(hs_end_clocks - hs_start_clocks);
+
+    printf("=======================================\n");
+    printf("RAM (Peak heap usage): %lu bytes\n", (unsigned long)g_heap_peak);
+    printf("RAM (Active session heap usage): %lu bytes\n", (unsigned long)g_heap_current);
+
+    char *msg = "RISC-V Simulation complete\n\n";
+    for (int i = 0; i < DTLS_SESSIONS; i++){
+        WOLFSSL *ssl = sessions[i].ssl;
+        if (sessions[i].state != SESS_DONE)
+            continue;
+        write_msg(ssl, msg);
+    }
+    wait_tx_idle();
+
+    client_end_clocks = read_cycle64();
+    printf("Time taken (whole client): %lu ms (%llu cycles)\n", cycles_to_ms(client_end_clocks - client_start_clocks), client_end_clocks - client_start_clocks);
+
+    // PRINT THE REPORT
+    print_session_report(hs_end_clocks - hs_start_clocks);
+    print_performance_report();
+#ifdef WOLFSSL_MLKEM_KEY_REUSE
+    print_mlkem_reuse_report(ctx);
+#endif
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+    print_cert_cache_report(ctx);
+#endif
+
+    // Cleanup
+    for (int i = 0; i < DTLS_SESSIONS; i++)
+        wolfSSL_free(sessions[i].ssl);
+#ifdef HEAP_ARENAS
+    mem_arena_release(MEM_ARENA_SCRATCH);
+    mem_arena_release(MEM_ARENA_HANDSHAKE);
+    mem_arena_report();
+#endif
+#ifdef MEM_PROFILE
+    mem_profile_report();
+#endif
+#ifdef CYCLE_TRACE
+    trace_dump();
+#endif
     wolfSSL_CTX_free(ctx);
     wolfSSL_Cleanup();
 }
+#endif /* DTLS_SESSIONS */
 
 /*             */
 /* ENTRY POINT */
 /*             */
 
+#ifdef BENCH_SHA3
+#define BENCH_SHA3_ITER  64
+
+/* Prints cycles per byte as a fixed point value with two decimals. */
+static void bench_report(const char *name, uint64_t cycles, uint32_t bytes)
+{
+    uint32_t cpb100 = (uint32_t)((cycles * 100) / bytes);
+    printf("  %-24s %6lu.%02lu cycles/byte (%llu cycles, %lu bytes)\n", name,
+           (unsigned long)(cpb100 / 100), (unsigned long)(cpb100 % 100),
+           cycles, (unsigned long)bytes);
+}
+
+/*
+ * Keccak throughput. The permutation alone (per 168-byte SHAKE128 rate
+ * block), SHAKE128 squeezing as done for the ML-KEM matrix and SHA3-256
+ * absorbing. Build with SHA3_C=1 for the generic C permutation.
+ */
+static void bench_sha3(void)
+{
+    static byte buf[WC_SHA3_128_COUNT * 8 * 4];
+    word64 state[25];
+    wc_Shake shake;
+    wc_Sha3 sha3;
+    byte digest[WC_SHA3_256_DIGEST_SIZE];
+    uint64_t start;
+    int i;
+
+#if defined(WOLFSSL_RISCV32_ASM) && !defined(WC_SHA3_NO_ASM)
+    printf("SHA3 benchmark (RV32 bit-interleaved Keccak)\n");
+#else
+    printf("SHA3 benchmark (generic C Keccak)\n");
+#endif
+
+    memset(state, 0, sizeof(state));
+    start = read_cycle64();
+    for (i = 0; i < BENCH_SHA3_ITER; i++)
+        BlockSha3(state);
+    bench_report("Keccak-f[1600]", read_cycle64() - start,
+                 BENCH_SHA3_ITER * WC_SHA3_128_COUNT * 8);
+
+    memset(buf, 0x5a, 34);
+    wc_InitShake128(&shake, NULL, INVALID_DEVID);
+    wc_Shake128_Absorb(&shake, buf, 34);
+    start = read_cycle64();
+    for (i = 0; i < BENCH_SHA3_ITER / 4; i++)
+        wc_Shake128_SqueezeBlocks(&shake, buf, 4);
+    bench_report("SHAKE128 squeeze", read_cycle64() - start,
+                 (BENCH_SHA3_ITER / 4) * sizeof(buf));
+    wc_Shake128_Free(&shake);
+
+    wc_InitSha3_256(&sha3, NULL, INVALID_DEVID);
+    start = read_cycle64();
+    for (i = 0; i < BENCH_SHA3_ITER / 4; i++)
+        wc_Sha3_256_Update(&sha3, buf, sizeof(buf));
+    wc_Sha3_256_Final(&sha3, digest);
+    bench_report("SHA3-256 absorb", read_cycle64() - start,
+                 (BENCH_SHA3_ITER / 4) * sizeof(buf));
+    wc_Sha3_256_Free(&sha3);
+}
+#endif /* BENCH_SHA3 */
+
 int main(void)
 {
+#ifdef MEM_PROFILE
+    mem_stack_paint(); // Before anything runs deeper than main
+#endif
     uart_init(); // 1. Basic Hardware Init
     printf("\n=== RISC-V IRQ Attached Boot ===\n");
 
+#ifdef BENCH_SHA3
+    bench_sha3();
+#endif
+
     eth_init();
+    printf("Ethernet FCS: %s\n", eth_hw_crc() ? "MAC" : "software CRC32");
 
     udp_start(my_mac, my_ip); // 2. Setup UDP stack
-    udp_set_callback(my_udp_rx);
+    udp_set_tx_callback(my_udp_tx_done);
+#ifdef WOLFSSL_ZERO_COPY_RX
+    udp_set_zc_callback(my_udp_rx_zc);
+#else
+    udp_set_zc_callback(my_udp_rx);
+#endif
 
     printf("Resolving ARP (Polling)...\n"); // 3. ARP Resolution (Polling Mode)
     if (udp_arp_resolve(host_ip) < 0){
@@ -478,19 +1711,27 @@ int main(void)
     /* B. Enable the SRAM WRITER Interrupt at the Hardware Block level */
     ethmac_sram_writer_ev_enable_write(1);
 
+    /* B2. SRAM READER (TX) completions free ring slots from the ISR */
+    ethmac_sram_reader_ev_pending_write(ethmac_sram_reader_ev_pending_read());
+    ethmac_sram_reader_ev_enable_write(1);
+
     /* C. Configure the CPU Interrupt Controller (VexRiscv) */
     irq_setmask(irq_getmask() | (1 << ETHMAC_INTERRUPT));
     irq_attach(ETHMAC_INTERRUPT, eth_irq_handler);
     irq_setie(1); // Enable Global Interrupts
 
-    printf("Interrupts Fully Enabled (RX Writer).\n");
+    printf("Interrupts Fully Enabled (RX Writer, TX Reader).\n");
 #else
     printf("Error: ETHMAC_INTERRUPT not defined.\n");
 #endif
 
     // 5. Run Application
     client_start_clocks = read_cycle64();
+#ifdef DTLS_SESSIONS
+    run_dtls_sessions();
+#else
     run_dtls_client();
+#endif
 
 END:
     while (1)
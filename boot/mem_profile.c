@@ -4,29 +4,282 @@
 #include <stdio.h>
 #include <stdint.h>        
 #include <generated/mem.h> 
+#include <wolfssl/wolfcrypt/types.h>
 
 volatile size_t g_heap_current = 0;
 volatile size_t g_heap_peak = 0;
 
+/*
+ * ALLOCATION PROFILE
+ *
+ * A profile header sits right in front of the payload of every block, after
+ * the allocator's own header. It holds the call site and requested size and
+ * links all live blocks, so the largest ones can be picked out at the peak.
+ * Walking them on every new peak would cost too much, the snapshot is
+ * taken at the first free after the heap reached a new peak, when the live
+ * blocks are still exactly those of the peak.
+ */
+#ifdef MEM_PROFILE
+typedef struct mem_prof_hdr {
+    void *site;                  /* return address of the XMALLOC caller */
+    struct mem_prof_hdr *prev;
+    struct mem_prof_hdr *next;
+    uint32_t size;               /* bytes requested */
+} mem_prof_hdr;
+
+#define PROF_HDR_SZ  sizeof(mem_prof_hdr)
+#define PROF_HDR(p)  ((mem_prof_hdr*)(p) - 1)
+
+typedef struct {
+    void    *site;
+    uint32_t allocs;
+    uint32_t bytes;
+} prof_site_t;
+
+typedef struct {
+    void    *site;
+    uint32_t size;
+} prof_block_t;
+
+void *mem_call_site = NULL;
+
+static mem_prof_hdr *prof_live = NULL;
+static uint32_t prof_hist[MEM_PROF_BUCKETS];
+static prof_site_t prof_sites[MEM_PROF_SITES];
+static uint32_t prof_sites_full = 0;    /* allocations from sites not counted */
+static prof_block_t prof_top[MEM_PROF_TOP];
+static int prof_top_count = 0;
+static size_t prof_top_heap = 0;        /* heap in use at the snapshot */
+static int prof_peak_dirty = 0;         /* new peak not yet snapshotted */
+
+/* Call site recorded by wolfSSL_Malloc/Realloc, else the allocator's
+   caller. Cleared so a later direct call does not inherit it. */
+static void *prof_take_site(void *caller) {
+    void *site = mem_call_site;
+    mem_call_site = NULL;
+    return site != NULL ? site : caller;
+}
+
+static int prof_bucket(size_t sz) {
+    int b = 0;
+    while (b < MEM_PROF_BUCKETS - 1 && sz >= ((size_t)16 << b))
+        b++;
+    return b;
+}
+
+static void prof_count_site(void *site, size_t sz) {
+    uint32_t h = (uint32_t)(((uintptr_t)site >> 1) % MEM_PROF_SITES);
+    int i;
+
+    for (i = 0; i < MEM_PROF_SITES; i++) {
+        prof_site_t *s = &prof_sites[(h + i) % MEM_PROF_SITES];
+        if (s->site == site || s->site == NULL) {
+            s->site = site;
+            s->allocs++;
+            s->bytes += (uint32_t)sz;
+            return;
+        }
+    }
+    prof_sites_full++;
+}
+
+/* Keep the MEM_PROF_TOP largest live blocks, largest first. */
+static void prof_snapshot(void) {
+    mem_prof_hdr *h;
+
+    prof_top_count = 0;
+    prof_top_heap = g_heap_current;
+    for (h = prof_live; h != NULL; h = h->next) {
+        int i = prof_top_count;
+        if (i == MEM_PROF_TOP) {
+            if (h->size <= prof_top[MEM_PROF_TOP - 1].size)
+                continue;
+            i--;
+        }
+        else {
+            prof_top_count++;
+        }
+        while (i > 0 && prof_top[i - 1].size < h->size) {
+            prof_top[i] = prof_top[i - 1];
+            i--;
+        }
+        prof_top[i].site = h->site;
+        prof_top[i].size = h->size;
+    }
+}
+
+/* After the allocator has accounted for the new block. */
+static void prof_alloc(void *p, size_t sz, void *site) {
+    mem_prof_hdr *h = PROF_HDR(p);
+
+    h->site = site;
+    h->size = (uint32_t)sz;
+    h->prev = NULL;
+    h->next = prof_live;
+    if (prof_live != NULL)
+        prof_live->prev = h;
+    prof_live = h;
+
+    prof_hist[prof_bucket(sz)]++;
+    prof_count_site(site, sz);
+    if (g_heap_current >= g_heap_peak)
+        prof_peak_dirty = 1;
+}
+
+/* Before the allocator takes the block out of g_heap_current. */
+static void prof_free(void *p) {
+    mem_prof_hdr *h = PROF_HDR(p);
+
+    if (prof_peak_dirty) {
+        prof_snapshot();
+        prof_peak_dirty = 0;
+    }
+    if (h->prev != NULL) h->prev->next = h->next;
+    else prof_live = h->next;
+    if (h->next != NULL)
+        h->next->prev = h->prev;
+}
+
+/* Block resized in place, after the allocator's accounting. */
+static void prof_resize(void *p, size_t sz) {
+    PROF_HDR(p)->size = (uint32_t)sz;
+    if (g_heap_current >= g_heap_peak)
+        prof_peak_dirty = 1;
+}
+
+/*
+ * STACK HIGH-WATER MARK
+ *
+ * The unused part of the stack between __stack_start and the current stack
+ * pointer is filled with a pattern once at boot. The deepest point the
+ * stack (interrupts included) has reached since is the lowest word that no
+ * longer holds the pattern.
+ */
+#define STACK_PAINT        0xA5A5A5A5u
+#define STACK_PAINT_GUARD  256   /* bytes below the live frame left alone */
+
+extern uint8_t __stack_start[];
+extern uint8_t __stack_end[];
+static int stack_painted = 0;
+
+void __attribute__((noinline)) mem_stack_paint(void) {
+    volatile uint8_t here;
+    uint32_t *p = (uint32_t*)__stack_start;
+    uint32_t *end = (uint32_t*)(((uintptr_t)&here - STACK_PAINT_GUARD) &
+                                ~(uintptr_t)3);
+
+    while (p < end)
+        *p++ = STACK_PAINT;
+    stack_painted = 1;
+}
+
+/* Bytes of stack used at the deepest point so far, 0 if not painted. */
+size_t mem_stack_used(void) {
+    uint32_t *p = (uint32_t*)__stack_start;
+
+    if (!stack_painted)
+        return 0;
+    while ((uint8_t*)p < __stack_end && *p == STACK_PAINT)
+        p++;
+    return (size_t)(__stack_end - (uint8_t*)p);
+}
+
+void mem_profile_report(void) {
+    uint32_t shown[MEM_PROF_SITES];
+    int i, j;
+
+    if (prof_peak_dirty) {
+        prof_snapshot(); // No free since the peak, the live blocks are it
+        prof_peak_dirty = 0;
+    }
+
+    printf("Heap Profile (addresses: addr2line -f -e boot.elf <addr>):\n");
+    printf("    allocation sizes:\n");
+    for (i = 0; i < MEM_PROF_BUCKETS; i++) {
+        if (prof_hist[i] == 0)
+            continue;
+        if (i == 0)
+            printf("        %6s..%-6lu: %lu\n", "0", 15UL,
+                (unsigned long)prof_hist[i]);
+        else if (i == MEM_PROF_BUCKETS - 1)
+            printf("        %6lu..%-6s: %lu\n", 16UL << (i - 1), "",
+                (unsigned long)prof_hist[i]);
+        else
+            printf("        %6lu..%-6lu: %lu\n", 16UL << (i - 1),
+                (16UL << i) - 1, (unsigned long)prof_hist[i]);
+    }
+
+    printf("    call sites by bytes allocated:\n");
+    memset(shown, 0, sizeof(shown));
+    for (j = 0; j < MEM_PROF_TOP; j++) {
+        int best = -1;
+        for (i = 0; i < MEM_PROF_SITES; i++) {
+            if (prof_sites[i].site == NULL || shown[i])
+                continue;
+            if (best < 0 || prof_sites[i].bytes > prof_sites[best].bytes)
+                best = i;
+        }
+        if (best < 0)
+            break;
+        shown[best] = 1;
+        printf("        0x%08lx: %lu bytes in %lu allocation(s)\n",
+            (unsigned long)(uintptr_t)prof_sites[best].site,
+            (unsigned long)prof_sites[best].bytes,
+            (unsigned long)prof_sites[best].allocs);
+    }
+    if (prof_sites_full > 0)
+        printf("        (%lu allocation(s) from sites beyond the table)\n",
+            (unsigned long)prof_sites_full);
+
+    printf("    largest live blocks at the peak (%lu bytes in use):\n",
+        (unsigned long)prof_top_heap);
+    for (i = 0; i < prof_top_count; i++)
+        printf("        0x%08lx: %lu bytes\n",
+            (unsigned long)(uintptr_t)prof_top[i].site,
+            (unsigned long)prof_top[i].size);
+
+    if (stack_painted)
+        printf("Stack: %lu of %lu bytes used at the deepest point\n",
+            (unsigned long)mem_stack_used(),
+            (unsigned long)(__stack_end - __stack_start));
+}
+#else
+#define PROF_HDR_SZ  0
+#endif /* MEM_PROFILE */
+
 /* 
  * HEAP TRACKER
  */
+/* Block size in front of the payload (and the profile header if enabled). */
+#ifdef MEM_PROFILE
+#define TRACK_HDR  ((sizeof(size_t) + PROF_HDR_SZ + 7) & ~(size_t)7)
+#else
+#define TRACK_HDR  sizeof(size_t)
+#endif
+#define TRACK_SIZE(p)  (*(size_t*)((uint8_t*)(p) - TRACK_HDR))
+
 void* TrackMalloc(size_t sz) {
-    size_t total_sz = sz + sizeof(size_t);
+    size_t total_sz = sz + TRACK_HDR;
     size_t *ptr = (size_t *)malloc(total_sz);
     if (ptr) {
+        void *p = (uint8_t*)ptr + TRACK_HDR;
         *ptr = sz;
         g_heap_current += sz;
         if (g_heap_current > g_heap_peak) g_heap_peak = g_heap_current;
-        return (void*)(ptr + 1); 
+#ifdef MEM_PROFILE
+        prof_alloc(p, sz, prof_take_site(__builtin_return_address(0)));
+#endif
+        return p;
     }
     return NULL;
 }
 
 void TrackFree(void* p) {
     if (p) {
-        size_t *ptr = (size_t *)p;
-        size_t *header = ptr - 1;
+        size_t *header = (size_t *)((uint8_t*)p - TRACK_HDR);
+#ifdef MEM_PROFILE
+        prof_free(p);
+#endif
         g_heap_current -= *header;
         free(header); 
     }
@@ -35,8 +288,407 @@ void TrackFree(void* p) {
 void* TrackRealloc(void* p, size_t sz) {
     void* new_p = TrackMalloc(sz);
     if (new_p && p) {
-        memcpy(new_p, p, sz); 
+        size_t old_sz = TRACK_SIZE(p);
+        memcpy(new_p, p, old_sz < sz ? old_sz : sz);
         TrackFree(p);
     }
     return new_p;
 }
+
+/*
+ * ARENA ALLOCATOR
+ *
+ * Each arena is a fixed region taken from the heap once at boot and managed
+ * as an address ordered first-fit free list. Blocks are placed by lifetime,
+ * from the DYNAMIC_TYPE_* XMALLOC passes through WOLFSSL_MEM_TYPE(): the
+ * SSL object, keys, ciphers, session and ticket live in the session arena,
+ * everything else allocated while the handshake runs in the handshake (or,
+ * when large, scratch) arena. Keeping them apart means the short-lived
+ * handshake blocks cannot fragment the long-lived ones, and once the
+ * handshake is over its arenas are empty and are reset as a whole. Blocks
+ * that do not fit their arena fall back to malloc and are counted as
+ * overflow. Used with make HEAP_ARENAS=1 only, as the regions are taken
+ * from the heap whether they are used or not.
+ */
+
+#define ARENA_ALIGN      8
+#define ARENA_MAGIC      0xA7E40000u
+#define ARENA_MAGIC_MASK 0xFFFF0000u
+#define ARENA_ID_HEAP    0xFFu   /* block came from malloc */
+#define ARENA_ID(tag)    ((tag) & 0xFFu)
+#define ARENA_TYPE(tag)  (((tag) >> 8) & 0xFFu)
+#define ARENA_TYPE_NONE  0xFFu   /* allocated without a DYNAMIC_TYPE_* */
+
+/* 8 byte header in front of every block, followed by the profile header
+   with MEM_PROFILE. A free block keeps the pointer to the next free block
+   right after the first 8 bytes. */
+typedef struct arena_block {
+    uint32_t size;               /* payload bytes */
+    uint32_t tag;                /* ARENA_MAGIC | type << 8 | arena id */
+    struct arena_block *next;    /* free blocks only */
+} arena_block;
+
+#define ARENA_HDR        (2 * sizeof(uint32_t) + PROF_HDR_SZ)
+#define ARENA_MIN_SPLIT  (ARENA_HDR + ARENA_ALIGN)
+
+typedef struct mem_arena {
+    uint8_t     *base;
+    size_t       size;
+    arena_block *free_list;
+    size_t       used;           /* payload bytes handed out */
+    size_t       peak;
+    uint32_t     live;           /* blocks handed out */
+    uint32_t     resets;
+} mem_arena;
+
+static const size_t arena_sizes[MEM_ARENA_COUNT] = {
+    MEM_ARENA_SESSION_SZ, MEM_ARENA_HANDSHAKE_SZ, MEM_ARENA_SCRATCH_SZ
+};
+static const char *const arena_names[MEM_ARENA_COUNT] = {
+    "session", "handshake", "scratch"
+};
+
+static mem_arena arenas[MEM_ARENA_COUNT];
+static int arena_current = MEM_ARENA_SESSION;
+int mem_alloc_type = -1;   /* set by XMALLOC through WOLFSSL_MEM_TYPE() */
+static uint32_t overflow_blocks = 0;
+static size_t overflow_peak = 0;
+static size_t overflow_used = 0;
+
+#define ARENA_PAYLOAD(b)  ((void*)((uint8_t*)(b) + ARENA_HDR))
+#define ARENA_HEADER(p)   ((arena_block*)((uint8_t*)(p) - ARENA_HDR))
+#define ARENA_END(b)      ((uint8_t*)(b) + ARENA_HDR + (b)->size)
+
+static void heap_account(long delta) {
+    g_heap_current += delta;
+    if (g_heap_current > g_heap_peak) g_heap_peak = g_heap_current;
+}
+
+/* DYNAMIC_TYPE_* recorded by XMALLOC/XREALLOC, cleared so a later direct
+   call does not inherit it. */
+static int arena_take_type(void) {
+    int type = mem_alloc_type;
+    mem_alloc_type = -1;
+    return type;
+}
+
+/* Blocks of these types stay with the SSL object after the handshake, or
+   with the context. Anything not allocated through XMALLOC is kept there
+   too, as its lifetime is not known. */
+static int arena_long_lived(int type) {
+    switch (type) {
+    case -1:
+    case DYNAMIC_TYPE_CTX:
+    case DYNAMIC_TYPE_SSL:
+    case DYNAMIC_TYPE_METHOD:
+    case DYNAMIC_TYPE_CERT_MANAGER:
+    case DYNAMIC_TYPE_CA:
+    case DYNAMIC_TYPE_SIGNER:
+    case DYNAMIC_TYPE_CERT:
+    case DYNAMIC_TYPE_SUITES:
+    case DYNAMIC_TYPE_CIPHER:       /* record protection keys */
+    case DYNAMIC_TYPE_RNG:
+    case DYNAMIC_TYPE_SOCKADDR:
+    case DYNAMIC_TYPE_TLSX:         /* connection ID, PSK, ticket */
+    case DYNAMIC_TYPE_SESSION:
+    case DYNAMIC_TYPE_SESSION_TICK:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/* Whole region as a single free block. */
+static void arena_reset(mem_arena *a) {
+    arena_block *b = (arena_block*)a->base;
+
+    b->size = (uint32_t)(a->size - ARENA_HDR);
+    b->tag = 0;
+    b->next = NULL;
+    a->free_list = b;
+    a->used = 0;
+    a->live = 0;
+}
+
+/* Put a block back in the free list, merging with free neighbours. */
+static void arena_insert_free(mem_arena *a, arena_block *b) {
+    arena_block *prev = NULL;
+    arena_block *cur = a->free_list;
+
+    while (cur != NULL && cur < b) {
+        prev = cur;
+        cur = cur->next;
+    }
+    b->tag = 0;
+    b->next = cur;
+    if (cur != NULL && ARENA_END(b) == (uint8_t*)cur) {
+        b->size += ARENA_HDR + cur->size;
+        b->next = cur->next;
+    }
+    if (prev != NULL && ARENA_END(prev) == (uint8_t*)b) {
+        prev->size += ARENA_HDR + b->size;
+        prev->next = b->next;
+    }
+    else if (prev != NULL) {
+        prev->next = b;
+    }
+    else {
+        a->free_list = b;
+    }
+}
+
+/* Cut the tail beyond need bytes off an allocated block, if worth it. */
+static void arena_trim(mem_arena *a, arena_block *b, uint32_t need) {
+    if (b->size - need >= ARENA_MIN_SPLIT) {
+        arena_block *rest = (arena_block*)((uint8_t*)b + ARENA_HDR + need);
+        rest->size = b->size - need - ARENA_HDR;
+        b->size = need;
+        arena_insert_free(a, rest);
+    }
+}
+
+static void* arena_alloc(int id, uint32_t need, uint32_t type) {
+    mem_arena *a = &arenas[id];
+    arena_block *prev = NULL;
+    arena_block *b = a->free_list;
+
+    while (b != NULL && b->size < need) {
+        prev = b;
+        b = b->next;
+    }
+    if (b == NULL)
+        return NULL;
+
+    if (b->size - need >= ARENA_MIN_SPLIT) {
+        arena_block *rest = (arena_block*)((uint8_t*)b + ARENA_HDR + need);
+        rest->size = b->size - need - ARENA_HDR;
+        rest->tag = 0;
+        rest->next = b->next;
+        b->size = need;
+        b->next = rest;
+    }
+    if (prev != NULL) prev->next = b->next;
+    else a->free_list = b->next;
+
+    b->tag = ARENA_MAGIC | (type << 8) | (uint32_t)id;
+    a->live++;
+    a->used += b->size;
+    if (a->used > a->peak) a->peak = a->used;
+    heap_account((long)b->size);
+    return ARENA_PAYLOAD(b);
+}
+
+static void* heap_alloc(uint32_t need, uint32_t type) {
+    arena_block *b = (arena_block*)malloc(ARENA_HDR + need);
+    if (b == NULL)
+        return NULL;
+    b->size = need;
+    b->tag = ARENA_MAGIC | (type << 8) | ARENA_ID_HEAP;
+    overflow_blocks++;
+    overflow_used += need;
+    if (overflow_used > overflow_peak) overflow_peak = overflow_used;
+    heap_account((long)need);
+    return ARENA_PAYLOAD(b);
+}
+
+/* Carve the arenas out of the heap. Returns 0 on success. An arena that
+   cannot be allocated stays empty and its blocks come from malloc. */
+int mem_arena_init(void) {
+    int ret = 0;
+    int i;
+
+    for (i = 0; i < MEM_ARENA_COUNT; i++) {
+        mem_arena *a = &arenas[i];
+        memset(a, 0, sizeof(*a));
+        a->base = (uint8_t*)malloc(arena_sizes[i]);
+        if (a->base == NULL) {
+            ret = -1;
+            continue;
+        }
+        a->size = arena_sizes[i] & ~(size_t)(ARENA_ALIGN - 1);
+        arena_reset(a);
+    }
+    arena_current = MEM_ARENA_SESSION;
+    return ret;
+}
+
+/* Make id the arena short-lived blocks come from: MEM_ARENA_HANDSHAKE while
+   a handshake runs, else MEM_ARENA_SESSION. Returns the previous arena. */
+int mem_arena_select(int id) {
+    int prev = arena_current;
+    if (id >= 0 && id < MEM_ARENA_COUNT)
+        arena_current = id;
+    return prev;
+}
+
+/* End an arena's lifetime: the whole region becomes one free block again.
+   A block still live would be handed out twice, so instead of resetting
+   the blocks left behind are listed with their DYNAMIC_TYPE_*, which then
+   belongs in arena_long_lived(). Returns the number of blocks still live
+   (0 when released). */
+int mem_arena_release(int id) {
+    mem_arena *a;
+    uint8_t *p;
+
+    if (id < 0 || id >= MEM_ARENA_COUNT)
+        return -1;
+    a = &arenas[id];
+    if (a->base == NULL)
+        return 0;
+    if (a->live != 0) {
+        for (p = a->base; p < a->base + a->size; p = ARENA_END((arena_block*)p)) {
+            arena_block *b = (arena_block*)p;
+            if ((b->tag & ARENA_MAGIC_MASK) == ARENA_MAGIC)
+                printf("    %s arena: %lu bytes of type %lu live\n",
+                    arena_names[id], (unsigned long)b->size,
+                    (unsigned long)ARENA_TYPE(b->tag));
+        }
+        return (int)a->live;
+    }
+    arena_reset(a);
+    a->resets++;
+    return 0;
+}
+
+void mem_arena_report(void) {
+    int i;
+
+    printf("Heap Arenas:\n");
+    for (i = 0; i < MEM_ARENA_COUNT; i++) {
+        mem_arena *a = &arenas[i];
+        printf("    %-9s: peak %lu / %lu bytes, %lu bytes in %lu block(s) live, %lu release(s)\n",
+            arena_names[i], (unsigned long)a->peak, (unsigned long)a->size,
+            (unsigned long)a->used, (unsigned long)a->live,
+            (unsigned long)a->resets);
+    }
+    printf("    overflow : peak %lu bytes, %lu block(s) from malloc\n",
+        (unsigned long)overflow_peak, (unsigned long)overflow_blocks);
+}
+
+void* ArenaMalloc(size_t sz) {
+    int type = arena_take_type();
+    int id = MEM_ARENA_SESSION;
+    uint32_t tag_type;
+    uint32_t need;
+    void *p = NULL;
+
+    if (sz > 0xFFFFFFF0u)
+        return NULL;
+    need = (uint32_t)((sz + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1));
+    if (need == 0)
+        need = ARENA_ALIGN;
+    tag_type = (type < 0 || type >= (int)ARENA_TYPE_NONE) ?
+        ARENA_TYPE_NONE : (uint32_t)type;
+
+    if (arena_current == MEM_ARENA_HANDSHAKE && !arena_long_lived(type)) {
+        id = MEM_ARENA_HANDSHAKE;
+        if (sz >= MEM_ARENA_SCRATCH_MIN)
+            p = arena_alloc(MEM_ARENA_SCRATCH, need, tag_type);
+    }
+    if (p == NULL)
+        p = arena_alloc(id, need, tag_type);
+    if (p == NULL)
+        p = heap_alloc(need, tag_type);
+#ifdef MEM_PROFILE
+    if (p != NULL)
+        prof_alloc(p, sz, prof_take_site(__builtin_return_address(0)));
+#endif
+    return p;
+}
+
+void ArenaFree(void* p) {
+    arena_block *b;
+    uint32_t id;
+
+    if (p == NULL)
+        return;
+    b = ARENA_HEADER(p);
+    if ((b->tag & ARENA_MAGIC_MASK) != ARENA_MAGIC) {
+        printf("ArenaFree: bad block %p\n", p);
+        return;
+    }
+    id = ARENA_ID(b->tag);
+#ifdef MEM_PROFILE
+    prof_free(p);
+#endif
+    g_heap_current -= b->size;
+    if (id == ARENA_ID_HEAP) {
+        overflow_used -= b->size;
+        b->tag = 0;
+        free(b);
+        return;
+    }
+    arenas[id].used -= b->size;
+    arenas[id].live--;
+    arena_insert_free(&arenas[id], b);
+}
+
+void* ArenaRealloc(void* p, size_t sz) {
+    arena_block *b;
+    uint32_t need;
+    uint32_t id;
+    int type;
+    void *new_p;
+
+    if (p == NULL)
+        return ArenaMalloc(sz);
+    /* Keep the type for the ArenaMalloc() below if it has to move. */
+    type = arena_take_type();
+    if (sz == 0) {
+        ArenaFree(p);
+        return NULL;
+    }
+    b = ARENA_HEADER(p);
+    if ((b->tag & ARENA_MAGIC_MASK) != ARENA_MAGIC || sz > 0xFFFFFFF0u)
+        return NULL;
+#ifdef MEM_PROFILE
+    /* Keep the site for the ArenaMalloc() below if it has to move. */
+    mem_call_site = prof_take_site(__builtin_return_address(0));
+#endif
+    id = ARENA_ID(b->tag);
+    need = (uint32_t)((sz + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1));
+
+    /* In place, unless a handshake block becomes a long-lived one. */
+    if (id != ARENA_ID_HEAP &&
+            (id == MEM_ARENA_SESSION || !arena_long_lived(type))) {
+        mem_arena *a = &arenas[id];
+        uint32_t old = b->size;
+
+        /* Grow into a free block directly after this one. */
+        if (need > b->size) {
+            arena_block *prev = NULL;
+            arena_block *cur = a->free_list;
+            while (cur != NULL && (uint8_t*)cur < ARENA_END(b)) {
+                prev = cur;
+                cur = cur->next;
+            }
+            if (cur != NULL && (uint8_t*)cur == ARENA_END(b) &&
+                    b->size + ARENA_HDR + cur->size >= need) {
+                if (prev != NULL) prev->next = cur->next;
+                else a->free_list = cur->next;
+                b->size += ARENA_HDR + cur->size;
+            }
+        }
+        /* Shrink, or trim what was taken from the neighbour, in place. */
+        if (need <= b->size) {
+            arena_trim(a, b, need);
+            a->used += b->size;
+            a->used -= old;
+            if (a->used > a->peak) a->peak = a->used;
+            heap_account((long)b->size - (long)old);
+#ifdef MEM_PROFILE
+            mem_call_site = NULL;
+            prof_resize(p, sz);
+#endif
+            return p;
+        }
+    }
+
+    mem_alloc_type = type;
+    new_p = ArenaMalloc(sz);
+    if (new_p != NULL) {
+        memcpy(new_p, p, b->size < need ? b->size : need);
+        ArenaFree(p);
+    }
+    return new_p;
+}
@@ -14,4 +14,57 @@ void* TrackMalloc(size_t sz);
 void  TrackFree(void* p);
 void* TrackRealloc(void* p, size_t sz);
 
+/* --- Arena Allocator --- */
+/* Lifetimes the heap is split into with make HEAP_ARENAS=1, chosen per block
+   from its DYNAMIC_TYPE_*. Blocks are freed individually as usual,
+   mem_arena_release() resets an emptied arena and lists what outlives it. */
+#define MEM_ARENA_SESSION    0  /* CTX, SSL object, keys, session and ticket */
+#define MEM_ARENA_HANDSHAKE  1  /* other blocks allocated during the handshake */
+#define MEM_ARENA_SCRATCH    2  /* large handshake temporaries */
+#define MEM_ARENA_COUNT      3
+
+#ifndef MEM_ARENA_SESSION_SZ
+#define MEM_ARENA_SESSION_SZ    (96 * 1024)
+#endif
+#ifndef MEM_ARENA_HANDSHAKE_SZ
+#define MEM_ARENA_HANDSHAKE_SZ  (192 * 1024)
+#endif
+#ifndef MEM_ARENA_SCRATCH_SZ
+#define MEM_ARENA_SCRATCH_SZ    (128 * 1024)
+#endif
+/* Handshake allocations of at least this size go to the scratch arena */
+#ifndef MEM_ARENA_SCRATCH_MIN
+#define MEM_ARENA_SCRATCH_MIN   2048
+#endif
+
+int   mem_arena_init(void);
+int   mem_arena_select(int id);
+int   mem_arena_release(int id);
+void  mem_arena_report(void);
+
+void* ArenaMalloc(size_t sz);
+void  ArenaFree(void* p);
+void* ArenaRealloc(void* p, size_t sz);
+
+/* --- Allocation Profile (make MEM_PROFILE=1) --- */
+/* Every block records the address it was allocated from. Reports a size
+   histogram, the call sites by bytes allocated, the largest blocks live at
+   the heap peak and how deep the stack has been used. */
+#ifdef MEM_PROFILE
+#ifndef MEM_PROF_TOP
+#define MEM_PROF_TOP        10  /* largest live blocks kept at the peak */
+#endif
+#ifndef MEM_PROF_SITES
+#define MEM_PROF_SITES      128 /* call sites counted */
+#endif
+#define MEM_PROF_BUCKETS    14  /* <16, 16..31, ... 32K..64K-1, >=64K bytes */
+
+/* Set through WOLFSSL_MEM_CALL_SITE() by wolfSSL_Malloc/Realloc */
+extern void *mem_call_site;
+
+void   mem_profile_report(void);
+void   mem_stack_paint(void);
+size_t mem_stack_used(void);
+#endif
+
 #endif // MEM_PROFILE_H
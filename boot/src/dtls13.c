@@ -673,6 +673,91 @@ static void Dtls13RtxRecordUnlink(WOLFSSL* ssl, Dtls13RtxRecord** prevNext,
     *prevNext = r->next;
 }
 
+#ifdef WOLFSSL_DTLS13_RTT
+/* The retransmission timer runs on WOLFSSL_DTLS13_TIMER_MS(). Its timeout
+ * follows RFC 6298: SRTT and RTTVAR are updated from the time between sending
+ * a flight and the first sign the peer got it, an ACK or the first message of
+ * its next flight. Following Karn's algorithm a flight that was retransmitted
+ * gives no sample, and every expiry doubles the timeout until the next
+ * sample. */
+
+static void Dtls13RttArmTimer(WOLFSSL* ssl)
+{
+    ssl->dtls13Rtx.timerStart = WOLFSSL_DTLS13_TIMER_MS();
+}
+
+static void Dtls13RttFlightSent(WOLFSSL* ssl)
+{
+    ssl->dtls13Rtx.flightSent = WOLFSSL_DTLS13_TIMER_MS();
+    ssl->dtls13Rtx.timerStart = ssl->dtls13Rtx.flightSent;
+    ssl->dtls13Rtx.rttPending = 1;
+}
+
+/* RTO = SRTT + max(G, 4 * RTTVAR), the clock granularity G is 1 ms */
+static void Dtls13RttSetRto(Dtls13Rtx* rtx)
+{
+    word32 rto;
+
+    rto = rtx->srtt + ((rtx->rttvar > 0) ? 4 * rtx->rttvar : 1);
+    if (rto < DTLS13_RTO_MIN_MS)
+        rto = DTLS13_RTO_MIN_MS;
+    if (rto > DTLS13_RTO_MAX_MS)
+        rto = DTLS13_RTO_MAX_MS;
+    rtx->rto = rto;
+}
+
+static void Dtls13RttSample(WOLFSSL* ssl)
+{
+    Dtls13Rtx* rtx = &ssl->dtls13Rtx;
+    word32 rtt, delta;
+
+    if (!rtx->rttPending)
+        return;
+    rtx->rttPending = 0;
+
+    rtt = WOLFSSL_DTLS13_TIMER_MS() - rtx->flightSent;
+    if (!rtx->rttValid) {
+        rtx->srtt = rtt;
+        rtx->rttvar = rtt / 2;
+        rtx->rttValid = 1;
+    }
+    else {
+        delta = (rtx->srtt > rtt) ? rtx->srtt - rtt : rtt - rtx->srtt;
+        rtx->rttvar = (3 * rtx->rttvar + delta) / 4;
+        rtx->srtt = (7 * rtx->srtt + rtt) / 8;
+    }
+    rtx->rttSamples++;
+    Dtls13RttSetRto(rtx);
+
+    ssl->ctx->dtls13Srtt = rtx->srtt;
+    ssl->ctx->dtls13Rttvar = rtx->rttvar;
+    ssl->ctx->dtls13RttValid = 1;
+}
+
+/* Starts the timer of a new connection from the context's latest estimate. */
+void Dtls13RttInit(WOLFSSL* ssl)
+{
+    Dtls13Rtx* rtx = &ssl->dtls13Rtx;
+
+    if (!ssl->ctx->dtls13RttValid) {
+        rtx->rto = DTLS13_RTO_INIT_MS;
+        return;
+    }
+    rtx->srtt = ssl->ctx->dtls13Srtt;
+    rtx->rttvar = ssl->ctx->dtls13Rttvar;
+    rtx->rttValid = 1;
+    Dtls13RttSetRto(rtx);
+}
+
+static void Dtls13RttBackoff(WOLFSSL* ssl)
+{
+    Dtls13Rtx* rtx = &ssl->dtls13Rtx;
+
+    rtx->rto = (rtx->rto > DTLS13_RTO_MAX_MS / 2) ? DTLS13_RTO_MAX_MS :
+                                                    rtx->rto * 2;
+}
+#endif /* WOLFSSL_DTLS13_RTT */
+
 void Dtls13RtxFlushBuffered(WOLFSSL* ssl, byte keepNewSessionTicket)
 {
     Dtls13RtxRecord *r, **prevNext;
@@ -883,6 +968,11 @@ static int Dtls13RtxMsgRecvd(WOLFSSL* ssl, enum HandShakeType hs,
         if (hs == server_hello)
             Dtls13MaybeSaveClientHello(ssl);
 
+#ifdef WOLFSSL_DTLS13_RTT
+        /* the peer's next flight has started, so it got ours */
+        Dtls13RttSample(ssl);
+#endif
+
         /* In the handshake, receiving part of the next flight, acknowledge the
          * sent flight. */
         /* On the server side, receiving the last client flight does not ACK any
@@ -966,8 +1056,14 @@ static int Dtls13SendOneFragmentRtx(WOLFSSL* ssl,
         handshakeType, hashOutput, Dtls13SendNow(ssl, handshakeType));
 
     if (rtxRecord != NULL) {
-        if (ret == 0 || ret == WC_NO_ERR_TRACE(WANT_WRITE))
+        if (ret == 0 || ret == WC_NO_ERR_TRACE(WANT_WRITE)) {
+#ifdef WOLFSSL_DTLS13_RTT
+            /* the first record buffered starts a new flight */
+            if (ssl->dtls13Rtx.rtxRecords == NULL)
+                Dtls13RttFlightSent(ssl);
+#endif
             Dtls13RtxAddRecord(&ssl->dtls13Rtx, rtxRecord);
+        }
         else
             Dtls13FreeRtxBufferRecord(ssl, rtxRecord);
     }
@@ -1533,6 +1629,9 @@ int Dtls13RecordRecvd(WOLFSSL* ssl)
 
     if (!ssl->options.dtls13SendMoreAcks)
         ssl->dtls13FastTimeout = 1;
+#ifdef WOLFSSL_DTLS13_RTT
+    Dtls13RttArmTimer(ssl);
+#endif
 
     ret = Dtls13RtxAddAck(ssl, ssl->keys.curEpoch64, ssl->keys.curSeq);
     if (ret != 0)
@@ -1561,14 +1660,27 @@ static int Dtls13RtxSendBuffered(WOLFSSL* ssl)
     byte* output;
     int isLast;
     int sendSz;
-#ifndef NO_ASN_TIME
+#if !defined(NO_ASN_TIME) || defined(WOLFSSL_DTLS13_RTT)
     word32 now;
 #endif
     int ret;
 
     WOLFSSL_ENTER("Dtls13RtxSendBuffered");
 
-#ifndef NO_ASN_TIME
+#ifdef WOLFSSL_DTLS13_RTT
+    now = WOLFSSL_DTLS13_TIMER_MS();
+    if (now - ssl->dtls13Rtx.lastRtx < DTLS13_RTO_MIN_MS) {
+#ifdef WOLFSSL_DEBUG_TLS
+        WOLFSSL_MSG("Avoid too fast retransmission");
+#endif /* WOLFSSL_DEBUG_TLS */
+        return 0;
+    }
+
+    ssl->dtls13Rtx.lastRtx = now;
+    /* Karn: the flight's round trip can't be told apart from the copy's */
+    ssl->dtls13Rtx.rttPending = 0;
+    ssl->dtls13Rtx.timerStart = now;
+#elif !defined(NO_ASN_TIME)
     now = LowResTimer();
     if (now - ssl->dtls13Rtx.lastRtx < DTLS13_MIN_RTX_INTERVAL) {
 #ifdef WOLFSSL_DEBUG_TLS
@@ -1867,6 +1979,11 @@ static int _Dtls13HandshakeRecv(WOLFSSL* ssl, byte* input, word32 size,
     }
 
     usingAsyncCrypto = ssl->devId != INVALID_DEVID;
+#ifdef WOLFSSL_PQC_NONBLOCK
+    /* sliced PQC operations return WC_PENDING_E the same way */
+    if (ssl->dilithiumNb != NULL)
+        usingAsyncCrypto = 1;
+#endif
 
     /* store the message if any of the following: (a) incomplete message, (b)
      * out of order message or (c) if using async crypto. In (c) the processing
@@ -1889,6 +2006,17 @@ static int _Dtls13HandshakeRecv(WOLFSSL* ssl, byte* input, word32 size,
             return DTLS_TOO_MANY_FRAGMENTS_E;
         }
 
+#ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+        /* Expand the CA keys while the rest of the certificate chain is
+         * still on its way. */
+        if (handshakeType == certificate && !isComplete &&
+                !ssl->options.verifyNone) {
+            if (PrepareMlDsaSigners(SSL_CM(ssl)) < 0) {
+                WOLFSSL_MSG("Preparing ML-DSA CA keys failed");
+            }
+        }
+#endif
+
         *processedSize = idx + fragLength + ssl->keys.padSz;
         if (Dtls13NextMessageComplete(ssl))
             return Dtls13ProcessBufferedMessages(ssl);
@@ -2723,6 +2851,11 @@ int Dtls13RtxTimeout(WOLFSSL* ssl)
 {
     int ret = 0;
 
+#ifdef WOLFSSL_DTLS13_RTT
+    ssl->dtls13Rtx.timeouts++;
+    Dtls13RttArmTimer(ssl);
+#endif
+
     /* We don't want to send acks until we have done version
      * negotiation in the SH or have received a unified header in the
      * DTLS record. */
@@ -2750,6 +2883,9 @@ int Dtls13RtxTimeout(WOLFSSL* ssl)
     /* Increase timeout on long timeout */
     if (DtlsMsgPoolTimeout(ssl) != 0)
         return WOLFSSL_FATAL_ERROR;
+#ifdef WOLFSSL_DTLS13_RTT
+    Dtls13RttBackoff(ssl);
+#endif
 
     return Dtls13RtxSendBuffered(ssl);
 }
@@ -2812,6 +2948,9 @@ int DoDtls13Ack(WOLFSSL* ssl, const byte* input, word32 inputSize,
         WOLFSSL_MSG_EX("epoch %d seq %d", epoch, seq);
         Dtls13RtxRemoveRecord(ssl, epoch, seq);
     }
+#ifdef WOLFSSL_DTLS13_RTT
+    Dtls13RttSample(ssl);
+#endif
 
     /* last client flight was completely acknowledged by the server. Handshake
        is complete. */
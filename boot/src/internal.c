@@ -92,6 +92,47 @@ extern uint64_t dilith_end_clks;
  *      pair
  * WOLFSSL_DTLS_RECORDS_CAN_SPAN_DATAGRAMS:
  *     When defined, allows DTLS records to span across multiple datagrams.
+ * WOLFSSL_ZERO_COPY_RX:
+ *     Allows the DTLS input buffer to be lent by the I/O layer, see
+ *     wolfSSL_CTX_SetIORecvZeroCopy(). Records are decrypted in place in the
+ *     lent datagram, which is handed back once it has been consumed.
+ * WOLFSSL_ZERO_COPY_TX:
+ *     Allows DTLS records to be built directly in a send buffer lent by the
+ *     I/O layer, see wolfSSL_CTX_SetIOSendZeroCopy(). Saves the output buffer
+ *     allocation and the copy into the network buffer per datagram.
+ * WOLFSSL_MLKEM_KEY_REUSE:
+ *     Allows a client context to use the same ML-KEM key pair for a bounded
+ *     number of handshakes or seconds, see wolfSSL_CTX_SetMlKemKeyReuse().
+ *     Saves a key generation per handshake at the cost of forward secrecy
+ *     between the handshakes that share a key pair.
+ * WOLFSSL_MLKEM_KEY_POOL:
+ *     Allows a client context to hold up to WOLFSSL_MLKEM_KEY_POOL_SZ ML-KEM
+ *     key pairs generated ahead of time, see
+ *     wolfSSL_CTX_MlKemKeyPool_Generate(). ClientHello takes a key share from
+ *     the pool instead of running key generation.
+ * WOLFSSL_VERIFIED_CERT_CACHE:
+ *     Allows a certificate manager to remember up to
+ *     WOLFSSL_VERIFIED_CERT_CACHE_SZ peer certificates whose signature has
+ *     been checked, keyed by the SHA-256 of the DER encoding, see
+ *     wolfSSL_CertManagerSetVerifiedCertCache(). The same certificate seen on
+ *     a later handshake is parsed and name checked against the same CA but its
+ *     signature is not verified again. Each entry is protected with an
+ *     HMAC-SHA256 under a device secret given to
+ *     wolfSSL_CertManagerSetVerifiedCertCacheKey(), or a key from the RNG
+ *     when WOLFSSL_VERIFIED_CERT_CACHE_RNG_KEY says it is a real entropy
+ *     source. Without either the cache can't be enabled.
+ * WOLFSSL_PQC_NONBLOCK:
+ *     Allows a DTLS 1.3 client to run the ML-DSA certificate and
+ *     CertificateVerify checks and the ML-KEM decapsulation in slices of a
+ *     bounded number of cycles, see wolfSSL_UsePqcNonBlock(). Between slices
+ *     wolfSSL_connect() fails with WC_PENDING_E and the handshake message
+ *     stays buffered until the operation completes.
+ * WOLFSSL_DTLS13_RTT:
+ *     Runs the DTLS 1.3 retransmission timer on WOLFSSL_DTLS13_TIMER_MS(), a
+ *     millisecond clock supplied by the user, with the RFC 6298 SRTT/RTTVAR
+ *     estimator setting the timeout. The application polls
+ *     wolfSSL_dtls13_rtx_timer_expired() and calls wolfSSL_dtls_got_timeout()
+ *     when it returns 1.
  */
 
 #ifndef WOLFCRYPT_ONLY
@@ -2987,6 +3028,24 @@ void SSL_CtxResourceFree(WOLFSSL_CTX* ctx)
     }
     #endif
 #endif
+#ifdef WOLFSSL_MLKEM_KEY_REUSE
+    TLSX_KeyShare_FreeMlKemReuse(ctx);
+    #ifndef SINGLE_THREADED
+    if (ctx->mlkemReuseLockInit) {
+        wc_FreeMutex(&ctx->mlkemReuseLock);
+        ctx->mlkemReuseLockInit = 0;
+    }
+    #endif
+#endif
+#ifdef WOLFSSL_MLKEM_KEY_POOL
+    TLSX_KeyShare_FreeMlKemPool(ctx);
+    #ifndef SINGLE_THREADED
+    if (ctx->mlkemPoolLockInit) {
+        wc_FreeMutex(&ctx->mlkemPoolLock);
+        ctx->mlkemPoolLockInit = 0;
+    }
+    #endif
+#endif
 #if defined(WOLFSSL_TLS13) && defined(HAVE_ECH)
     FreeEchConfigs(ctx->echConfigs, ctx->heap);
     ctx->echConfigs = NULL;
@@ -7224,6 +7283,14 @@ int SetSSL_CTX(WOLFSSL* ssl, WOLFSSL_CTX* ctx, int writeDup)
     if (ssl->CBIOSend != SslBioSend)
 #endif
         ssl->CBIOSend = ctx->CBIOSend;
+#ifdef WOLFSSL_ZERO_COPY_RX
+    ssl->CBIORecvZeroCopy = ctx->CBIORecvZeroCopy;
+    ssl->CBIORecvRelease  = ctx->CBIORecvRelease;
+#endif
+#ifdef WOLFSSL_ZERO_COPY_TX
+    ssl->CBIOSendGetBuffer = ctx->CBIOSendGetBuffer;
+    ssl->CBIOSendRelease   = ctx->CBIOSendRelease;
+#endif
     ssl->verifyDepth = ctx->verifyDepth;
 
     return ret;
@@ -7996,6 +8063,9 @@ int InitSSL(WOLFSSL* ssl, WOLFSSL_CTX* ctx, int writeDup)
     ssl->dtls13DecryptEpoch = &ssl->dtls13Epochs[0];
     ssl->options.dtls13SendMoreAcks = WOLFSSL_DTLS13_SEND_MOREACK_DEFAULT;
     ssl->dtls13Rtx.rtxRecordTailPtr = &ssl->dtls13Rtx.rtxRecords;
+#ifdef WOLFSSL_DTLS13_RTT
+    Dtls13RttInit(ssl);
+#endif
 
 #ifdef WOLFSSL_RW_THREADED
     ret = wc_InitMutex(&ssl->dtls13Rtx.mutex);
@@ -8699,6 +8769,9 @@ void wolfSSL_ResourceFree(WOLFSSL* ssl)
     FreeKey(ssl, DYNAMIC_TYPE_FALCON, (void**)&ssl->peerFalconKey);
     ssl->peerFalconKeyPresent = 0;
 #endif
+#ifdef WOLFSSL_PQC_NONBLOCK
+    TLSX_FreePqcNonBlock(ssl);
+#endif
 #ifdef HAVE_PK_CALLBACKS
     #ifdef HAVE_ECC
         XFREE(ssl->buffers.peerEccDsaKey.buffer, ssl->heap, DYNAMIC_TYPE_ECC);
@@ -10988,10 +11061,27 @@ retry:
 }
 
 
+#ifdef WOLFSSL_ZERO_COPY_TX
+/* Hand the send buffer lent by the I/O layer back, sent or not. */
+static void ReleaseOutputBuffer(WOLFSSL* ssl)
+{
+    ssl->buffers.outputBuffer.borrowed = 0;
+    if (ssl->CBIOSendRelease != NULL)
+        ssl->CBIOSendRelease(ssl, ssl->buffers.outputBuffer.buffer,
+                             ssl->IOCB_WriteCtx);
+}
+#endif
+
 /* Switch dynamic output buffer back to static, buffer is assumed clear */
 void ShrinkOutputBuffer(WOLFSSL* ssl)
 {
     WOLFSSL_MSG("Shrinking output buffer");
+#ifdef WOLFSSL_ZERO_COPY_TX
+    /* a lent buffer belongs to the I/O layer, hand it back */
+    if (ssl->buffers.outputBuffer.borrowed)
+        ReleaseOutputBuffer(ssl);
+    else
+#endif
     XFREE(ssl->buffers.outputBuffer.buffer - ssl->buffers.outputBuffer.offset,
           ssl->heap, DYNAMIC_TYPE_OUT_BUFFER);
     ssl->buffers.outputBuffer.buffer = ssl->buffers.outputBuffer.staticBuffer;
@@ -11025,6 +11115,17 @@ void ShrinkInputBuffer(WOLFSSL* ssl, int forcedFree)
 
     ForceZero(ssl->buffers.inputBuffer.buffer,
         ssl->buffers.inputBuffer.bufferSize);
+#ifdef WOLFSSL_ZERO_COPY_RX
+    if (ssl->buffers.inputBuffer.borrowed) {
+        /* hand the datagram back to the I/O layer instead of freeing it */
+        ssl->buffers.inputBuffer.borrowed = 0;
+        if (ssl->CBIORecvRelease != NULL) {
+            ssl->CBIORecvRelease(ssl, ssl->buffers.inputBuffer.buffer,
+                                 ssl->IOCB_ReadCtx);
+        }
+    }
+    else
+#endif
     XFREE(ssl->buffers.inputBuffer.buffer - ssl->buffers.inputBuffer.offset,
           ssl->heap, DYNAMIC_TYPE_IN_BUFFER);
     ssl->buffers.inputBuffer.buffer = ssl->buffers.inputBuffer.staticBuffer;
@@ -11264,6 +11365,11 @@ static WC_INLINE int GrowOutputBuffer(WOLFSSL* ssl, int size)
                ssl->buffers.outputBuffer.length);
 
     if (ssl->buffers.outputBuffer.dynamicFlag) {
+    #ifdef WOLFSSL_ZERO_COPY_TX
+        if (ssl->buffers.outputBuffer.borrowed)
+            ReleaseOutputBuffer(ssl);
+        else
+    #endif
         XFREE(ssl->buffers.outputBuffer.buffer -
               ssl->buffers.outputBuffer.offset, ssl->heap,
               DYNAMIC_TYPE_OUT_BUFFER);
@@ -11283,6 +11389,37 @@ static WC_INLINE int GrowOutputBuffer(WOLFSSL* ssl, int size)
 }
 
 
+#if defined(WOLFSSL_ZERO_COPY_TX) && defined(WOLFSSL_DTLS)
+/* Start the next datagram in the send buffer lent by the I/O layer.
+ * Only done when nothing is pending, a partly built datagram stays where it is.
+ * Returns 0 when the lent buffer is in use, otherwise the caller grows. */
+static int BorrowOutputBuffer(WOLFSSL* ssl, int size)
+{
+    byte* buf;
+    int   bufSz = 0;
+
+    if (ssl->CBIOSendGetBuffer == NULL || !IsDtlsNotSctpMode(ssl))
+        return -1;
+    if (ssl->buffers.outputBuffer.dynamicFlag ||
+            ssl->buffers.outputBuffer.length != 0 ||
+            ssl->buffers.outputBuffer.idx != 0)
+        return -1;
+
+    buf = ssl->CBIOSendGetBuffer(ssl, &bufSz, ssl->IOCB_WriteCtx);
+    if (buf == NULL || bufSz < size)
+        return -1;
+
+    ssl->buffers.outputBuffer.buffer      = buf;
+    ssl->buffers.outputBuffer.bufferSize  = (word32)bufSz;
+    ssl->buffers.outputBuffer.offset      = 0;
+    ssl->buffers.outputBuffer.dynamicFlag = 1;
+    ssl->buffers.outputBuffer.borrowed    = 1;
+
+    return 0;
+}
+#endif /* WOLFSSL_ZERO_COPY_TX && WOLFSSL_DTLS */
+
+
 /* Grow the input buffer, should only be to read cert or big app data */
 int GrowInputBuffer(WOLFSSL* ssl, int size, int usedLength)
 {
@@ -11342,6 +11479,16 @@ int GrowInputBuffer(WOLFSSL* ssl, int size, int usedLength)
             ForceZero(ssl->buffers.inputBuffer.buffer,
                 ssl->buffers.inputBuffer.length);
         }
+    #ifdef WOLFSSL_ZERO_COPY_RX
+        if (ssl->buffers.inputBuffer.borrowed) {
+            ssl->buffers.inputBuffer.borrowed = 0;
+            if (ssl->CBIORecvRelease != NULL) {
+                ssl->CBIORecvRelease(ssl, ssl->buffers.inputBuffer.buffer,
+                                     ssl->IOCB_ReadCtx);
+            }
+        }
+        else
+    #endif
         XFREE(ssl->buffers.inputBuffer.buffer - ssl->buffers.inputBuffer.offset,
               ssl->heap, DYNAMIC_TYPE_IN_BUFFER);
     }
@@ -11405,6 +11552,10 @@ int CheckAvailableSize(WOLFSSL *ssl, int size)
     if ((ssl->buffers.outputBuffer.bufferSize -
              ssl->buffers.outputBuffer.length -
              ssl->buffers.outputBuffer.idx) < (word32)size) {
+    #if defined(WOLFSSL_ZERO_COPY_TX) && defined(WOLFSSL_DTLS)
+        if (BorrowOutputBuffer(ssl, size) == 0)
+            return 0;
+    #endif
         if (GrowOutputBuffer(ssl, size) < 0)
             return MEMORY_E;
     }
@@ -14874,6 +15025,12 @@ static int ProcessPeerCertParse(WOLFSSL* ssl, ProcPeerCertArgs* args,
 #ifdef WOLFSSL_SMALL_CERT_VERIFY
     int sigRet = 0;
 #endif
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+    byte certHash[WC_SHA256_DIGEST_SIZE];
+    byte caHash[SIGNER_DIGEST_SIZE];
+    int  certHashSet = 0;
+    int  certCached = 0;
+#endif
 
     if (ssl == NULL || args == NULL
     #ifndef WOLFSSL_SMALL_CERT_VERIFY
@@ -14914,6 +15071,59 @@ PRAGMA_GCC_DIAG_POP
     /* get certificate buffer */
     cert = &args->certs[args->certIdx];
 
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+    if (verify == VERIFY && SSL_CM(ssl)->verifiedMaxAge != 0) {
+    #ifdef WOLFSSL_PQC_NONBLOCK
+        VerifiedCertLookup* lookup = NULL;
+
+        /* the message is processed from the start after each verify slice,
+         * hash and look up each certificate only the first time */
+        if (ssl->dilithiumNb != NULL && args->certIdx < MAX_CHAIN_DEPTH) {
+            if (ssl->verifiedLookup == NULL) {
+                ssl->verifiedLookup = (VerifiedCertLookup*)XMALLOC(
+                    sizeof(VerifiedCertLookup) * MAX_CHAIN_DEPTH, ssl->heap,
+                    DYNAMIC_TYPE_TMP_BUFFER);
+                if (ssl->verifiedLookup != NULL) {
+                    XMEMSET(ssl->verifiedLookup, 0,
+                        sizeof(VerifiedCertLookup) * MAX_CHAIN_DEPTH);
+                }
+            }
+            if (ssl->verifiedLookup != NULL) {
+                lookup = &ssl->verifiedLookup[args->certIdx];
+            }
+        }
+        if (lookup != NULL && lookup->set) {
+            XMEMCPY(certHash, lookup->certHash, WC_SHA256_DIGEST_SIZE);
+            XMEMCPY(caHash, lookup->caHash, SIGNER_DIGEST_SIZE);
+            certHashSet = 1;
+            certCached = lookup->cached;
+        }
+        else
+    #endif
+        {
+            certHashSet = (wc_Sha256Hash(cert->buffer, cert->length,
+                                         certHash) == 0);
+            if (certHashSet &&
+                    CM_VerifiedCertFind(SSL_CM(ssl), certHash, caHash) == 1) {
+                certCached = 1;
+            }
+        #ifdef WOLFSSL_PQC_NONBLOCK
+            if (lookup != NULL && certHashSet) {
+                XMEMCPY(lookup->certHash, certHash, WC_SHA256_DIGEST_SIZE);
+                XMEMCPY(lookup->caHash, caHash, SIGNER_DIGEST_SIZE);
+                lookup->cached = (byte)certCached;
+                lookup->set = 1;
+            }
+        #endif
+        }
+        if (certCached) {
+            /* signature checked on an earlier handshake, CA and names are
+             * still checked in ParseCertRelative */
+            verify = VERIFY_NAME;
+        }
+    }
+#endif /* WOLFSSL_VERIFIED_CERT_CACHE */
+
 #ifdef WOLFSSL_SMALL_CERT_VERIFY
     if (verify == VERIFY) {
         /* for small cert verify, release decoded cert during signature check to
@@ -14928,8 +15138,22 @@ PRAGMA_GCC_DIAG_POP
         }
 
         /* perform cert parsing and signature check */
-        sigRet = wc_CheckCertSignature(cert->buffer, cert->length,
-                                         ssl->heap, SSL_CM(ssl));
+    #ifdef WOLFSSL_PQC_NONBLOCK
+        if (ssl->dilithiumNb != NULL) {
+            sigRet = CheckCertSignatureNonBlock(cert->buffer, cert->length,
+                                ssl->heap, SSL_CM(ssl), ssl->dilithiumNb);
+            if (sigRet == WC_NO_ERR_TRACE(MP_WOULDBLOCK)) {
+                /* verify slice used up, certificate is parsed again on the
+                 * next call and the verify continues where it stopped */
+                return WC_PENDING_E;
+            }
+        }
+        else
+    #endif
+        {
+            sigRet = wc_CheckCertSignature(cert->buffer, cert->length,
+                                             ssl->heap, SSL_CM(ssl));
+        }
         /* fail on errors here after the ParseCertRelative call, so dCert is populated */
 
         /* verify name only in ParseCertRelative below, signature check done */
@@ -15027,6 +15251,32 @@ PRAGMA_GCC_DIAG_POP
         ret = sigRet;
 #endif
 
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+    if (ret == 0 && certHashSet) {
+        const byte* caKeyHash = NULL;
+
+        if (args->dCert->ca != NULL) {
+        #ifndef NO_SKID
+            caKeyHash = args->dCert->ca->subjectKeyIdHash;
+        #else
+            caKeyHash = args->dCert->ca->subjectNameHash;
+        #endif
+        }
+        if (certCached && (caKeyHash == NULL ||
+                XMEMCMP(caKeyHash, caHash, SIGNER_DIGEST_SIZE) != 0)) {
+            /* issuer no longer resolves to the CA that was checked */
+            WOLFSSL_MSG("Cached certificate CA changed");
+            CM_VerifiedCertRemove(SSL_CM(ssl), certHash);
+            ret = ASN_NO_SIGNER_E;
+            WOLFSSL_ERROR_VERBOSE(ret);
+        }
+        else if (!certCached && caKeyHash != NULL) {
+            /* failing to cache only costs a verify next time */
+            (void)CM_VerifiedCertAdd(SSL_CM(ssl), certHash, caKeyHash);
+        }
+    }
+#endif /* WOLFSSL_VERIFIED_CERT_CACHE */
+
     if (pSubjectHash)
         *pSubjectHash = subjectHash;
     if (pAlreadySigner)
@@ -15298,6 +15548,7 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
 #endif
     byte* subjectHash = NULL;
     int alreadySigner = 0;
+    int traceTok = WOLFSSL_TRACE_BEGIN(TRACE_PEER_CERTS);
 
 #if defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2)
     int addToPendingCAs = 0;
@@ -15694,7 +15945,7 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
                         }
                     }
 #endif
-                #ifdef WOLFSSL_ASYNC_CRYPT
+                #if defined(WOLFSSL_ASYNC_CRYPT) || defined(WOLFSSL_PQC_NONBLOCK)
                     if (ret == WC_NO_ERR_TRACE(WC_PENDING_E))
                         goto exit_ppc;
                 #endif
@@ -16058,6 +16309,10 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
         {
             /* peer's, may not have one if blank client cert sent by TLSv1.2 */
             if (args->count > 0) {
+            #ifdef WOLFSSL_PQC_NONBLOCK
+                /* keep the start of the first slice */
+                if (ssl->error != WC_NO_ERR_TRACE(WC_PENDING_E))
+            #endif
                 dilith_start_clks = read_cycle64();
                 WOLFSSL_MSG("Verifying Peer's cert");
 
@@ -16092,7 +16347,7 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
                         }
                     }
 #endif
-            #ifdef WOLFSSL_ASYNC_CRYPT
+            #if defined(WOLFSSL_ASYNC_CRYPT) || defined(WOLFSSL_PQC_NONBLOCK)
                 if (ret == WC_NO_ERR_TRACE(WC_PENDING_E))
                     goto exit_ppc;
             #endif
@@ -17045,9 +17300,24 @@ exit_ppc:
         /* Mark message as not received so it can process again */
         ssl->msgsReceived.got_certificate = 0;
 
+        WOLFSSL_TRACE_END(traceTok);
         return ret;
     }
 #endif /* WOLFSSL_ASYNC_CRYPT || WOLFSSL_NONBLOCK_OCSP */
+#ifdef WOLFSSL_PQC_NONBLOCK
+    if (ret == WC_NO_ERR_TRACE(WC_PENDING_E)) {
+        /* The message stays buffered and is parsed from the start on the
+         * next call. Only the verify state survives, in ssl->dilithiumNb. */
+        ssl->msgsReceived.got_certificate = 0;
+    }
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+    else if (ssl->verifiedLookup != NULL) {
+        /* message done, the certificates of the next are looked up again */
+        XFREE(ssl->verifiedLookup, ssl->heap, DYNAMIC_TYPE_TMP_BUFFER);
+        ssl->verifiedLookup = NULL;
+    }
+#endif
+#endif
 
 #if defined(WOLFSSL_ASYNC_CRYPT) || defined(WOLFSSL_NONBLOCK_OCSP)
     /* Cleanup async */
@@ -17067,6 +17337,7 @@ exit_ppc:
 
     FreeKeyExchange(ssl);
 
+    WOLFSSL_TRACE_END(traceTok);
     return ret;
 }
 #endif
@@ -21749,6 +22020,73 @@ static int DoAlert(WOLFSSL* ssl, byte* input, word32* inOutIdx, int* type)
     return level;
 }
 
+#if defined(WOLFSSL_ZERO_COPY_RX) && defined(WOLFSSL_DTLS)
+/* Borrow the next datagram from the I/O layer and use it as the input buffer.
+ * Any previously lent datagram has been consumed and is handed back first.
+ * Records can't span datagrams so a datagram shorter than size is dropped. */
+static int GetInputDataZeroCopy(WOLFSSL *ssl, word32 size)
+{
+    byte* buf;
+    int   in;
+
+    if (ssl->buffers.inputBuffer.dynamicFlag)
+        ShrinkInputBuffer(ssl, NO_FORCED_FREE);
+    if (ssl->buffers.inputBuffer.dynamicFlag) {
+        /* application data still refers to the current buffer */
+        WOLFSSL_MSG("Zero-copy read with unconsumed input");
+        return BUFFER_ERROR;
+    }
+
+    for (;;) {
+        buf = NULL;
+        in = ssl->CBIORecvZeroCopy(ssl, &buf, ssl->IOCB_ReadCtx);
+        if (in == WC_NO_ERR_TRACE(WOLFSSL_CBIO_ERR_WANT_READ))
+            return WC_NO_ERR_TRACE(WANT_READ);
+    #ifdef WOLFSSL_DTLS13
+        if (in == WC_NO_ERR_TRACE(WOLFSSL_CBIO_ERR_TIMEOUT) &&
+                IsAtLeastTLSv1_3(ssl->version)) {
+            if (Dtls13RtxTimeout(ssl) < 0) {
+                WOLFSSL_MSG("Error trying to retransmit DTLS buffered message");
+                return WOLFSSL_FATAL_ERROR;
+            }
+            continue;
+        }
+    #endif /* WOLFSSL_DTLS13 */
+        if (in == WC_NO_ERR_TRACE(WOLFSSL_CBIO_ERR_CONN_CLOSE))
+            ssl->options.isClosed = 1;
+        if (in < 0 || buf == NULL) {
+            WOLFSSL_ERROR_VERBOSE(SOCKET_ERROR_E);
+            return SOCKET_ERROR_E;
+        }
+
+        if ((word32)in >= size)
+            break;
+
+        WOLFSSL_MSG("DTLS: Received partial record, ignoring");
+    #ifdef WOLFSSL_DTLS_DROP_STATS
+        ssl->replayDropCount++;
+    #endif /* WOLFSSL_DTLS_DROP_STATS */
+        if (ssl->CBIORecvRelease != NULL)
+            ssl->CBIORecvRelease(ssl, buf, ssl->IOCB_ReadCtx);
+    }
+
+    ssl->buffers.inputBuffer.buffer      = buf;
+    ssl->buffers.inputBuffer.bufferSize  = (word32)in;
+    ssl->buffers.inputBuffer.length      = (word32)in;
+    ssl->buffers.inputBuffer.idx         = 0;
+    ssl->buffers.inputBuffer.offset      = 0;
+    ssl->buffers.inputBuffer.dynamicFlag = 1;
+    ssl->buffers.inputBuffer.borrowed    = 1;
+
+#ifdef WOLFSSL_DEBUG_TLS
+    WOLFSSL_MSG("Data received (zero-copy)");
+    WOLFSSL_BUFFER(buf, (word32)in);
+#endif
+
+    return 0;
+}
+#endif /* WOLFSSL_ZERO_COPY_RX && WOLFSSL_DTLS */
+
 static int GetInputData(WOLFSSL *ssl, word32 size)
 {
     int inSz;
@@ -21767,6 +22105,10 @@ static int GetInputData(WOLFSSL *ssl, word32 size)
 
 #ifdef WOLFSSL_DTLS
     if (ssl->options.dtls && IsDtlsNotSctpMode(ssl)) {
+    #ifdef WOLFSSL_ZERO_COPY_RX
+        if (ssl->CBIORecvZeroCopy != NULL && usedLength == 0)
+            return GetInputDataZeroCopy(ssl, size);
+    #endif
         /* Add DTLS_MTU_ADDITIONAL_READ_BUFFER bytes so that we can operate with
          * slight difference in set MTU size on each peer */
 #ifdef WOLFSSL_DTLS_MTU
@@ -22267,7 +22609,7 @@ static int DoProcessReplyEx(WOLFSSL* ssl, int allowSocketErr)
     #if defined(HAVE_SECURE_RENEGOTIATION) || defined(WOLFSSL_DTLS13)
         && ssl->error != WC_NO_ERR_TRACE(APP_DATA_READY)
     #endif
-    #ifdef WOLFSSL_ASYNC_CRYPT
+    #if defined(WOLFSSL_ASYNC_CRYPT) || defined(WOLFSSL_PQC_NONBLOCK)
         && ssl->error != WC_NO_ERR_TRACE(WC_PENDING_E)
     #endif
     #ifdef WOLFSSL_NONBLOCK_OCSP
@@ -22291,7 +22633,8 @@ static int DoProcessReplyEx(WOLFSSL* ssl, int allowSocketErr)
     }
 #endif
 
-#if defined(WOLFSSL_DTLS) && defined(WOLFSSL_ASYNC_CRYPT)
+#if defined(WOLFSSL_DTLS) && \
+    (defined(WOLFSSL_ASYNC_CRYPT) || defined(WOLFSSL_PQC_NONBLOCK))
     /* process any pending DTLS messages - this flow can happen with async */
     if (ssl->dtls_rx_msg_list != NULL) {
         word32 pendingMsg = ssl->dtls_rx_msg_list_sz;
@@ -22953,7 +23296,7 @@ default:
                              * processing so let's move on. */
                         && (!ssl->options.dtls
                             || ret != WC_NO_ERR_TRACE(WANT_WRITE))
-#ifdef WOLFSSL_ASYNC_CRYPT
+#if defined(WOLFSSL_ASYNC_CRYPT) || defined(WOLFSSL_PQC_NONBLOCK)
                     /* In async case, on pending, move onto next message.
                      * Current message should have been DtlsMsgStore'ed and
                      * should be processed with DtlsMsgDrain */
@@ -23761,7 +24104,7 @@ int BuildMessage(WOLFSSL* ssl, byte* output, int outSz, const byte* input,
     BuildMsgArgs  lcl_args;
 #endif
 
-#ifdef WOLFSSL_DTLS_CID
+#if defined(WOLFSSL_DTLS_CID) && !defined(WOLFSSL_NO_TLS12)
     byte cidSz = 0;
 #endif
 
@@ -39730,12 +40073,18 @@ static int DoSessionTicket(WOLFSSL* ssl, const byte* input, word32* inOutIdx,
             }
         }
 #endif
+#ifndef NO_SESSION_CACHE
         if (sess == NULL) {
             ret = TlsSessionCacheGetAndRdLock(id, &sess, &freeCtx->row,
                     (byte)ssl->options.side);
             if (ret != 0)
                 sess = NULL;
         }
+#else
+        /* no cache to look stateful tickets up in */
+        (void)ret;
+        (void)id;
+#endif
         return sess;
     }
 
@@ -39753,7 +40102,13 @@ static int DoSessionTicket(WOLFSSL* ssl, const byte* input, word32* inOutIdx,
         }
         else
 #endif
+        {
+        #ifndef NO_SESSION_CACHE
             TlsSessionCacheUnlockRow(freeCtx->row);
+        #else
+            (void)freeCtx;
+        #endif
+        }
     }
 
     /* Parse ticket sent by client, returns callback return value. Doesn't
@@ -5806,6 +5806,46 @@ Signer* GetCAByName(void* vp, byte* hash)
 }
 #endif
 
+#ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+/* Prepare the public key of each ML-DSA CA for verification.
+ *
+ * Called while a Certificate message is still being received so that the
+ * expansion of each CA's key is done before the message is complete.
+ *
+ * @param [in] cm  Certificate manager.
+ * @return  Number of CAs with a prepared key on success.
+ * @return  Negative on error.
+ */
+int PrepareMlDsaSigners(WOLFSSL_CERT_MANAGER* cm)
+{
+    int ret = 0;
+    int cnt = 0;
+    Signer* signers;
+    word32  row;
+
+    if (cm == NULL)
+        return BAD_FUNC_ARG;
+
+    if (wc_LockMutex(&cm->caLock) != 0)
+        return BAD_MUTEX_E;
+
+    for (row = 0; row < CA_TABLE_SIZE && ret == 0; row++) {
+        signers = cm->caTable[row];
+        while (signers && ret == 0) {
+            ret = PrepareSignerMlDsaKey(signers, cm->heap);
+            if (ret == 0)
+                cnt++;
+            else if (ret == WC_NO_ERR_TRACE(NOT_COMPILED_IN))
+                ret = 0;
+            signers = signers->next;
+        }
+    }
+    wc_UnLockMutex(&cm->caLock);
+
+    return (ret == 0) ? cnt : ret;
+}
+#endif
+
 
 #ifdef WOLFSSL_TRUST_PEER_CERT
 /* add a trusted peer cert to linked list */
@@ -9981,6 +10021,57 @@ int wolfSSL_dtls13_use_quick_timeout(WOLFSSL* ssl)
     return ssl->dtls13FastTimeout;
 }
 
+#ifdef WOLFSSL_DTLS13_RTT
+/*
+ * This API returns 1 when the retransmission timer has run out and the user
+ * should call wolfSSL_dtls_got_timeout(). The timeout is the RFC 6298 RTO in
+ * milliseconds, a quarter of it while only ACKs are owed, as with
+ * wolfSSL_dtls13_use_quick_timeout().
+ */
+int wolfSSL_dtls13_rtx_timer_expired(WOLFSSL* ssl)
+{
+    word32 timeout;
+
+    if (ssl == NULL || !ssl->options.dtls || !IsAtLeastTLSv1_3(ssl->version))
+        return 0;
+    /* nothing to retransmit and nothing to acknowledge */
+    if (ssl->dtls13Rtx.rtxRecords == NULL &&
+            ssl->dtls13Rtx.seenRecords == NULL)
+        return 0;
+
+    timeout = ssl->dtls13Rtx.rto;
+    if (ssl->dtls13FastTimeout && ssl->dtls13Rtx.seenRecords != NULL)
+        timeout /= 4;
+
+    return (WOLFSSL_DTLS13_TIMER_MS() - ssl->dtls13Rtx.timerStart) >= timeout;
+}
+
+/*
+ * Gets the round trip estimate in milliseconds, the number of samples it is
+ * made of and how often the retransmission timer expired. Any pointer may be
+ * NULL.
+ */
+int wolfSSL_GetDtls13RttStats(WOLFSSL* ssl, word32* srtt, word32* rttvar,
+    word32* rto, word32* samples, word32* timeouts)
+{
+    if (ssl == NULL)
+        return BAD_FUNC_ARG;
+
+    if (srtt != NULL)
+        *srtt = ssl->dtls13Rtx.srtt;
+    if (rttvar != NULL)
+        *rttvar = ssl->dtls13Rtx.rttvar;
+    if (rto != NULL)
+        *rto = ssl->dtls13Rtx.rto;
+    if (samples != NULL)
+        *samples = ssl->dtls13Rtx.rttSamples;
+    if (timeouts != NULL)
+        *timeouts = ssl->dtls13Rtx.timeouts;
+
+    return WOLFSSL_SUCCESS;
+}
+#endif /* WOLFSSL_DTLS13_RTT */
+
 /*
  * When this is set, a DTLS 1.3 connection will send acks immediately when a
  * disruption is detected to shortcut timeouts. This results in potentially
@@ -226,6 +226,11 @@ void wolfSSL_CertManagerFree(WOLFSSL_CERT_MANAGER* cm)
             wc_FreeMutex(&cm->tpLock);
         #endif
 
+        #ifdef WOLFSSL_VERIFIED_CERT_CACHE
+            /* Dispose of key used to MAC verified certificates. */
+            ForceZero(cm->verifiedKey, sizeof(cm->verifiedKey));
+        #endif
+
             /* Dispose of reference count. */
             wolfSSL_RefFree(&cm->ref);
             /* Dispose of certificate manager memory. */
@@ -445,6 +450,10 @@ int wolfSSL_CertManagerUnloadCAs(WOLFSSL_CERT_MANAGER* cm)
     if (ret == WOLFSSL_SUCCESS) {
         /* Dispose of CA table. */
         FreeSignerTable(cm->caTable, CA_TABLE_SIZE, cm->heap);
+    #ifdef WOLFSSL_VERIFIED_CERT_CACHE
+        /* Certificates were verified against the CAs just removed. */
+        cm->verifiedCnt = 0;
+    #endif
 
         /* Unlock CA table. */
         wc_UnLockMutex(&cm->caLock);
@@ -530,6 +539,339 @@ int wolfSSL_CertManagerUnload_trust_peers(WOLFSSL_CERT_MANAGER* cm)
 }
 #endif /* WOLFSSL_TRUST_PEER_CERT */
 
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+/* Set the key of the HMAC-SHA256 that protects each verified certificate
+ * cache entry.
+ *
+ * Anyone who can write an entry with a valid MAC skips the signature check of
+ * that certificate, so the key must be a device secret that is not known
+ * outside the device. Cached entries are dropped.
+ *
+ * @param [in] cm     Certificate manager.
+ * @param [in] key    Secret key.
+ * @param [in] keySz  Size of key in bytes. 16 to 32.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when cm or key is NULL or keySz is out of range.
+ * @return  BAD_MUTEX_E when locking fails.
+ */
+int wolfSSL_CertManagerSetVerifiedCertCacheKey(WOLFSSL_CERT_MANAGER* cm,
+    const byte* key, word32 keySz)
+{
+    int ret = WOLFSSL_SUCCESS;
+
+    WOLFSSL_ENTER("wolfSSL_CertManagerSetVerifiedCertCacheKey");
+
+    /* Validate parameters. */
+    if ((cm == NULL) || (key == NULL) || (keySz < WC_SHA256_DIGEST_SIZE / 2) ||
+            (keySz > sizeof(cm->verifiedKey))) {
+        ret = BAD_FUNC_ARG;
+    }
+    /* Cache is protected with the CA table. */
+    if ((ret == WOLFSSL_SUCCESS) && (wc_LockMutex(&cm->caLock) != 0)) {
+        ret = BAD_MUTEX_E;
+    }
+    if (ret == WOLFSSL_SUCCESS) {
+        ForceZero(cm->verifiedKey, sizeof(cm->verifiedKey));
+        XMEMCPY(cm->verifiedKey, key, keySz);
+        cm->verifiedKeySz = (byte)keySz;
+        /* Entries were MACed under the previous key. */
+        cm->verifiedCnt = 0;
+        wc_UnLockMutex(&cm->caLock);
+    }
+
+    return ret;
+}
+
+/* Enable the cache of peer certificates whose signature has been verified.
+ *
+ * A certificate is found by the SHA-256 of its DER encoding so only a byte
+ * for byte identical certificate skips the signature check. The CA it was
+ * verified against must still be the one its issuer resolves to.
+ * Entries older than maxAge seconds are checked again.
+ * Each entry carries an HMAC-SHA256 and an entry that fails the check is
+ * dropped. The key is set with wolfSSL_CertManagerSetVerifiedCertCacheKey().
+ * Only when WOLFSSL_VERIFIED_CERT_CACHE_RNG_KEY is defined, because the RNG
+ * is seeded from a real entropy source, is a missing key generated here.
+ * Otherwise the cache is not enabled without a key: with a key known outside
+ * the device a forged entry would skip the signature check.
+ *
+ * @param [in] cm      Certificate manager.
+ * @param [in] maxAge  Seconds a verification is trusted for. 0 disables the
+ *                     cache and drops all entries.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when cm is NULL.
+ * @return  BAD_MUTEX_E when locking fails.
+ * @return  BAD_STATE_E when enabling and no key has been set.
+ * @return  Other negative when generating the MAC key fails.
+ */
+int wolfSSL_CertManagerSetVerifiedCertCache(WOLFSSL_CERT_MANAGER* cm,
+    word32 maxAge)
+{
+    int ret = WOLFSSL_SUCCESS;
+
+    WOLFSSL_ENTER("wolfSSL_CertManagerSetVerifiedCertCache");
+
+    /* Validate parameter. */
+    if (cm == NULL) {
+        ret = BAD_FUNC_ARG;
+    }
+    /* Cache is protected with the CA table. */
+    if ((ret == WOLFSSL_SUCCESS) && (wc_LockMutex(&cm->caLock) != 0)) {
+        ret = BAD_MUTEX_E;
+    }
+    if (ret == WOLFSSL_SUCCESS) {
+        if ((maxAge != 0) && (cm->verifiedKeySz == 0)) {
+        #ifdef WOLFSSL_VERIFIED_CERT_CACHE_RNG_KEY
+            WC_RNG rng;
+
+            /* Key for the MAC of each entry. */
+            ret = wc_InitRng_ex(&rng, cm->heap, INVALID_DEVID);
+            if (ret == 0) {
+                ret = wc_RNG_GenerateBlock(&rng, cm->verifiedKey,
+                    sizeof(cm->verifiedKey));
+                wc_FreeRng(&rng);
+            }
+            if (ret == 0) {
+                cm->verifiedKeySz = (byte)sizeof(cm->verifiedKey);
+                ret = WOLFSSL_SUCCESS;
+            }
+        #else
+            WOLFSSL_MSG("Verified certificate cache needs a key");
+            ret = BAD_STATE_E;
+        #endif
+        }
+        if (ret == WOLFSSL_SUCCESS) {
+            cm->verifiedMaxAge = maxAge;
+        }
+        if (maxAge == 0) {
+            cm->verifiedCnt = 0;
+        }
+        wc_UnLockMutex(&cm->caLock);
+    }
+
+    return ret;
+}
+
+/* Get the counts of signature checks skipped and performed.
+ *
+ * @param [in]  cm      Certificate manager.
+ * @param [out] hits    Number of certificates found in the cache.
+ * @param [out] misses  Number of certificates that had to be verified.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when cm, hits or misses is NULL.
+ */
+int wolfSSL_CertManagerGetVerifiedCertCacheStats(WOLFSSL_CERT_MANAGER* cm,
+    word32* hits, word32* misses)
+{
+    if ((cm == NULL) || (hits == NULL) || (misses == NULL)) {
+        return BAD_FUNC_ARG;
+    }
+
+    *hits = cm->verifiedHits;
+    *misses = cm->verifiedMisses;
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Remove entry at index from the verified certificate cache.
+ *
+ * Call with caLock held.
+ *
+ * @param [in] cm  Certificate manager.
+ * @param [in] i   Index of entry.
+ */
+static void cm_verified_cert_drop(WOLFSSL_CERT_MANAGER* cm, word32 i)
+{
+    cm->verifiedCnt--;
+    if (i < cm->verifiedCnt) {
+        XMEMMOVE(&cm->verified[i], &cm->verified[i + 1],
+            (cm->verifiedCnt - i) * sizeof(VerifiedCert));
+    }
+    ForceZero(&cm->verified[cm->verifiedCnt], sizeof(VerifiedCert));
+}
+
+/* Calculate the MAC of an entry of the verified certificate cache.
+ *
+ * Call with caLock held.
+ *
+ * @param [in]  cm   Certificate manager.
+ * @param [in]  vc   Entry of cache.
+ * @param [out] mac  HMAC-SHA256 of hashes and creation time of entry.
+ * @return  0 on success.
+ * @return  MEMORY_E when dynamic memory allocation fails.
+ * @return  Other negative when HMAC operation fails.
+ */
+static int cm_verified_cert_mac(WOLFSSL_CERT_MANAGER* cm,
+    const VerifiedCert* vc, byte* mac)
+{
+    int ret;
+    byte created[4];
+    WC_DECLARE_VAR(hmac, Hmac, 1, cm->heap);
+
+    WC_ALLOC_VAR_EX(hmac, Hmac, 1, cm->heap, DYNAMIC_TYPE_HMAC,
+        return MEMORY_E);
+
+    c32toa(vc->created, created);
+    ret = wc_HmacInit(hmac, cm->heap, INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_HmacSetKey(hmac, WC_SHA256, cm->verifiedKey,
+            cm->verifiedKeySz);
+        if (ret == 0) {
+            ret = wc_HmacUpdate(hmac, vc->certHash, WC_SHA256_DIGEST_SIZE);
+        }
+        if (ret == 0) {
+            ret = wc_HmacUpdate(hmac, vc->caHash, SIGNER_DIGEST_SIZE);
+        }
+        if (ret == 0) {
+            ret = wc_HmacUpdate(hmac, created, sizeof(created));
+        }
+        if (ret == 0) {
+            ret = wc_HmacFinal(hmac, mac);
+        }
+        wc_HmacFree(hmac);
+    }
+
+    WC_FREE_VAR_EX(hmac, cm->heap, DYNAMIC_TYPE_HMAC);
+    return ret;
+}
+
+/* Look up a peer certificate in the verified certificate cache.
+ *
+ * Expired entries and entries whose MAC doesn't match are removed as they are
+ * found.
+ *
+ * @param [in]  cm        Certificate manager.
+ * @param [in]  certHash  SHA-256 of the DER encoded certificate.
+ * @param [out] caHash    Key id hash of the CA the certificate was verified
+ *                        against. SIGNER_DIGEST_SIZE bytes.
+ * @return  1 when the certificate's signature has been verified.
+ * @return  0 when not found.
+ * @return  BAD_MUTEX_E when locking fails.
+ */
+int CM_VerifiedCertFind(WOLFSSL_CERT_MANAGER* cm, const byte* certHash,
+    byte* caHash)
+{
+    int ret = 0;
+    word32 now = LowResTimer();
+    word32 i;
+
+    if (wc_LockMutex(&cm->caLock) != 0) {
+        return BAD_MUTEX_E;
+    }
+
+    i = 0;
+    while (i < cm->verifiedCnt) {
+        VerifiedCert* vc = &cm->verified[i];
+
+        if (now - vc->created >= cm->verifiedMaxAge) {
+            cm_verified_cert_drop(cm, i);
+            continue;
+        }
+        if (XMEMCMP(vc->certHash, certHash, WC_SHA256_DIGEST_SIZE) == 0) {
+            byte mac[WC_SHA256_DIGEST_SIZE];
+
+            if ((cm_verified_cert_mac(cm, vc, mac) != 0) ||
+                    (ConstantCompare(mac, vc->mac, sizeof(mac)) != 0)) {
+                WOLFSSL_MSG("Verified certificate cache entry MAC mismatch");
+                cm_verified_cert_drop(cm, i);
+                break;
+            }
+            XMEMCPY(caHash, vc->caHash, SIGNER_DIGEST_SIZE);
+            ret = 1;
+            break;
+        }
+        i++;
+    }
+    if (ret == 1) {
+        cm->verifiedHits++;
+    }
+    else {
+        cm->verifiedMisses++;
+    }
+
+    wc_UnLockMutex(&cm->caLock);
+
+    return ret;
+}
+
+/* Add a peer certificate to the verified certificate cache.
+ *
+ * An entry for the same certificate is replaced, otherwise the oldest entry is
+ * replaced when the cache is full.
+ *
+ * @param [in] cm        Certificate manager.
+ * @param [in] certHash  SHA-256 of the DER encoded certificate.
+ * @param [in] caHash    Key id hash of the CA the certificate was verified
+ *                       against.
+ * @return  0 on success.
+ * @return  BAD_MUTEX_E when locking fails.
+ * @return  Other negative when calculating the MAC fails.
+ */
+int CM_VerifiedCertAdd(WOLFSSL_CERT_MANAGER* cm, const byte* certHash,
+    const byte* caHash)
+{
+    int ret;
+    word32 n;
+    VerifiedCert vc;
+
+    XMEMCPY(vc.certHash, certHash, WC_SHA256_DIGEST_SIZE);
+    XMEMCPY(vc.caHash, caHash, SIGNER_DIGEST_SIZE);
+    vc.created = LowResTimer();
+
+    if (wc_LockMutex(&cm->caLock) != 0) {
+        return BAD_MUTEX_E;
+    }
+
+    ret = cm_verified_cert_mac(cm, &vc, vc.mac);
+    if (ret == 0) {
+        for (n = 0; n < cm->verifiedCnt; n++) {
+            if (XMEMCMP(cm->verified[n].certHash, certHash,
+                    WC_SHA256_DIGEST_SIZE) == 0) {
+                cm_verified_cert_drop(cm, n);
+                break;
+            }
+        }
+        n = cm->verifiedCnt;
+        if (n == WOLFSSL_VERIFIED_CERT_CACHE_SZ) {
+            n--;
+        }
+        XMEMMOVE(&cm->verified[1], &cm->verified[0],
+            n * sizeof(VerifiedCert));
+        XMEMCPY(&cm->verified[0], &vc, sizeof(VerifiedCert));
+        cm->verifiedCnt = n + 1;
+    }
+
+    wc_UnLockMutex(&cm->caLock);
+
+    ForceZero(&vc, sizeof(vc));
+    return ret;
+}
+
+/* Remove a peer certificate from the verified certificate cache.
+ *
+ * @param [in] cm        Certificate manager.
+ * @param [in] certHash  SHA-256 of the DER encoded certificate.
+ */
+void CM_VerifiedCertRemove(WOLFSSL_CERT_MANAGER* cm, const byte* certHash)
+{
+    word32 i;
+
+    if (wc_LockMutex(&cm->caLock) != 0) {
+        return;
+    }
+
+    for (i = 0; i < cm->verifiedCnt; i++) {
+        if (XMEMCMP(cm->verified[i].certHash, certHash,
+                WC_SHA256_DIGEST_SIZE) == 0) {
+            cm_verified_cert_drop(cm, i);
+            break;
+        }
+    }
+
+    wc_UnLockMutex(&cm->caLock);
+}
+#endif /* WOLFSSL_VERIFIED_CERT_CACHE */
+
 /* Load certificate/s from buffer with flags and type.
  *
  * @param [in] cm         Certificate manager.
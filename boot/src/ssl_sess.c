@@ -805,6 +805,52 @@ long wolfSSL_CTX_get_session_cache_mode(WOLFSSL_CTX* ctx)
 
 #endif /* !NO_SESSION_CACHE */
 
+/* Prepares ssl to resume the session it now holds.
+ * returns WOLFSSL_SUCCESS, or WOLFSSL_FAILURE when the session has expired or
+ * belongs to another application context */
+static int SetSessionResume(WOLFSSL* ssl)
+{
+#ifdef WOLFSSL_SESSION_ID_CTX
+    /* check for application context id */
+    if (ssl->sessionCtxSz > 0) {
+        if (XMEMCMP(ssl->sessionCtx, ssl->session->sessionCtx,
+                ssl->sessionCtxSz)) {
+            /* context id did not match! */
+            WOLFSSL_MSG("Session context did not match");
+            return WOLFSSL_FAILURE;
+        }
+    }
+#endif /* WOLFSSL_SESSION_ID_CTX */
+
+    if (LowResTimer() >= (ssl->session->bornOn + ssl->session->timeout)) {
+#if !defined(OPENSSL_EXTRA) || !defined(WOLFSSL_ERROR_CODE_OPENSSL)
+        return WOLFSSL_FAILURE;  /* session timed out */
+#else /* defined(OPENSSL_EXTRA) && defined(WOLFSSL_ERROR_CODE_OPENSSL) */
+        WOLFSSL_MSG("Session is expired but return success for "
+                    "OpenSSL compatibility");
+#endif
+    }
+    ssl->options.resuming = 1;
+    ssl->options.haveEMS = (ssl->session->haveEMS) ? 1 : 0;
+
+#if defined(SESSION_CERTS) || (defined(WOLFSSL_TLS13) && \
+                           defined(HAVE_SESSION_TICKET))
+    ssl->version              = ssl->session->version;
+    if (IsAtLeastTLSv1_3(ssl->version))
+        ssl->options.tls1_3 = 1;
+#endif
+#if defined(SESSION_CERTS) || !defined(NO_RESUME_SUITE_CHECK) || \
+                    (defined(WOLFSSL_TLS13) && defined(HAVE_SESSION_TICKET))
+    ssl->options.cipherSuite0 = ssl->session->cipherSuite0;
+    ssl->options.cipherSuite  = ssl->session->cipherSuite;
+#endif
+#if defined(OPENSSL_EXTRA) || defined(OPENSSL_EXTRA_X509_SMALL)
+    ssl->peerVerifyRet = (unsigned long)ssl->session->peerVerifyRet;
+#endif
+
+    return WOLFSSL_SUCCESS;
+}
+
 #ifndef NO_SESSION_CACHE
 
 WOLFSSL_ABI
@@ -1527,45 +1573,7 @@ int wolfSSL_SetSession(WOLFSSL* ssl, WOLFSSL_SESSION* session)
     if (ret != WOLFSSL_SUCCESS)
         return ret;
 
-#ifdef WOLFSSL_SESSION_ID_CTX
-    /* check for application context id */
-    if (ssl->sessionCtxSz > 0) {
-        if (XMEMCMP(ssl->sessionCtx, ssl->session->sessionCtx,
-                ssl->sessionCtxSz)) {
-            /* context id did not match! */
-            WOLFSSL_MSG("Session context did not match");
-            return WOLFSSL_FAILURE;
-        }
-    }
-#endif /* WOLFSSL_SESSION_ID_CTX */
-
-    if (LowResTimer() >= (ssl->session->bornOn + ssl->session->timeout)) {
-#if !defined(OPENSSL_EXTRA) || !defined(WOLFSSL_ERROR_CODE_OPENSSL)
-        return WOLFSSL_FAILURE;  /* session timed out */
-#else /* defined(OPENSSL_EXTRA) && defined(WOLFSSL_ERROR_CODE_OPENSSL) */
-        WOLFSSL_MSG("Session is expired but return success for "
-                    "OpenSSL compatibility");
-#endif
-    }
-    ssl->options.resuming = 1;
-    ssl->options.haveEMS = (ssl->session->haveEMS) ? 1 : 0;
-
-#if defined(SESSION_CERTS) || (defined(WOLFSSL_TLS13) && \
-                           defined(HAVE_SESSION_TICKET))
-    ssl->version              = ssl->session->version;
-    if (IsAtLeastTLSv1_3(ssl->version))
-        ssl->options.tls1_3 = 1;
-#endif
-#if defined(SESSION_CERTS) || !defined(NO_RESUME_SUITE_CHECK) || \
-                    (defined(WOLFSSL_TLS13) && defined(HAVE_SESSION_TICKET))
-    ssl->options.cipherSuite0 = ssl->session->cipherSuite0;
-    ssl->options.cipherSuite  = ssl->session->cipherSuite;
-#endif
-#if defined(OPENSSL_EXTRA) || defined(OPENSSL_EXTRA_X509_SMALL)
-    ssl->peerVerifyRet = (unsigned long)ssl->session->peerVerifyRet;
-#endif
-
-    return WOLFSSL_SUCCESS;
+    return SetSessionResume(ssl);
 }
 
 
@@ -2444,6 +2452,54 @@ WOLFSSL_SESSION* wolfSSL_GetSession(WOLFSSL* ssl, byte* masterSecret,
     return NULL;
 }
 
+/* No session cache version. The application holds on to the session of an
+ * earlier connection, see wolfSSL_get1_session(), and hands it back with
+ * wolfSSL_set_session(). Only sessions with a TLS 1.3 ticket can resume. */
+WOLFSSL_SESSION* wolfSSL_get1_session(WOLFSSL* ssl)
+{
+    WOLFSSL_SESSION* sess = NULL;
+    WOLFSSL_ENTER("wolfSSL_get1_session");
+    if (ssl != NULL) {
+        sess = ssl->session;
+        if (sess != NULL && sess->type == WOLFSSL_SESSION_TYPE_HEAP) {
+            if (wolfSSL_SESSION_up_ref(sess) != WOLFSSL_SUCCESS)
+                sess = NULL;
+        }
+    }
+    return sess;
+}
+
+int wolfSSL_SetSession(WOLFSSL* ssl, WOLFSSL_SESSION* session)
+{
+    if (ssl == NULL || session == NULL || !session->isSetup) {
+        WOLFSSL_MSG("ssl or session NULL or not set up");
+        return WOLFSSL_FAILURE;
+    }
+    if (ssl->options.side != WOLFSSL_NEITHER_END &&
+            (byte)ssl->options.side != session->side) {
+        WOLFSSL_MSG("Setting session for wrong role");
+        return WOLFSSL_FAILURE;
+    }
+    if (ssl->session != session) {
+        if (wolfSSL_SESSION_up_ref(session) != WOLFSSL_SUCCESS)
+            return WOLFSSL_FAILURE;
+        wolfSSL_FreeSession(ssl->ctx, ssl->session);
+        ssl->session = session;
+    }
+
+    return SetSessionResume(ssl);
+}
+
+WOLFSSL_ABI
+int wolfSSL_set_session(WOLFSSL* ssl, WOLFSSL_SESSION* session)
+{
+    WOLFSSL_ENTER("wolfSSL_set_session");
+    if (session)
+        return wolfSSL_SetSession(ssl, session);
+
+    return WOLFSSL_FAILURE;
+}
+
 #endif /* NO_SESSION_CACHE */
 
 #ifdef OPENSSL_EXTRA
@@ -3567,7 +3623,7 @@ void SetupSession(WOLFSSL* ssl)
     }
 #endif
     session->timeout = ssl->timeout;
-#ifndef NO_ASN_TIME
+#if !defined(NO_ASN_TIME) || defined(WOLFSSL_TICKET_USER_TIME)
     session->bornOn  = LowResTimer();
 #endif
 #if defined(SESSION_CERTS) || (defined(WOLFSSL_TLS13) && \
@@ -8290,6 +8290,10 @@ static int TLSX_KeyShare_GenEccKey(WOLFSSL *ssl, KeyShareEntry* kse)
     #error "Choose WOLFSSL_TLSX_PQC_MLKEM_STORE_PRIV_KEY or "
            "WOLFSSL_TLSX_PQC_MLKEM_STORE_OBJ"
 #endif
+#if defined(WOLFSSL_MLKEM_KEY_REUSE) && \
+    defined(WOLFSSL_TLSX_PQC_MLKEM_STORE_OBJ)
+    #error "WOLFSSL_MLKEM_KEY_REUSE needs the encoded ML-KEM private key"
+#endif
 
 #if !defined(WOLFSSL_MLKEM_NO_MAKE_KEY) || \
     !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) || \
@@ -8413,6 +8417,597 @@ static void findEccPqc(int *ecc, int *pqc, int *pqc_first, int group)
     }
 }
 
+#ifdef WOLFSSL_MLKEM_KEY_REUSE
+/* Dispose of the cached client ML-KEM key pair.
+ * Lock held by caller or context being freed.
+ *
+ * ctx  The SSL/TLS context object.
+ */
+void TLSX_KeyShare_FreeMlKemReuse(WOLFSSL_CTX* ctx)
+{
+    MlKemKeyReuse* reuse = &ctx->mlkemReuse;
+
+    if (reuse->privKey != NULL) {
+        ForceZero(reuse->privKey, reuse->privKeyLen);
+        XFREE(reuse->privKey, ctx->heap, DYNAMIC_TYPE_PRIVATE_KEY);
+        reuse->privKey = NULL;
+    }
+    XFREE(reuse->pubKey, ctx->heap, DYNAMIC_TYPE_PUBLIC_KEY);
+    reuse->pubKey = NULL;
+    reuse->pubKeyLen = 0;
+    reuse->privKeyLen = 0;
+    reuse->uses = 0;
+}
+
+/* Lock the cached client ML-KEM key pair of the context.
+ *
+ * ctx  The SSL/TLS context object.
+ * returns 0 on success, otherwise failure.
+ */
+static int TLSX_KeyShare_LockMlKemReuse(WOLFSSL_CTX* ctx)
+{
+#ifndef SINGLE_THREADED
+    if (!ctx->mlkemReuseLockInit) {
+        return BAD_STATE_E;
+    }
+    return wc_LockMutex(&ctx->mlkemReuseLock);
+#else
+    (void)ctx;
+    return 0;
+#endif
+}
+
+/* Unlock the cached client ML-KEM key pair of the context.
+ *
+ * ctx  The SSL/TLS context object.
+ */
+static void TLSX_KeyShare_UnlockMlKemReuse(WOLFSSL_CTX* ctx)
+{
+#ifndef SINGLE_THREADED
+    wc_UnLockMutex(&ctx->mlkemReuseLock);
+#else
+    (void)ctx;
+#endif
+}
+
+#ifndef WOLFSSL_MLKEM_NO_MAKE_KEY
+/* Put a copy of the cached ML-KEM key pair into the key share entry when the
+ * context's reuse policy allows it. An expired pair is disposed of.
+ *
+ * ssl   The SSL/TLS object.
+ * kse   The key share entry object.
+ * used  Set to 1 when the entry has the cached key pair.
+ * returns 0 on success, otherwise failure.
+ */
+static int TLSX_KeyShare_GetMlKemReuse(WOLFSSL* ssl, KeyShareEntry* kse,
+    int* used)
+{
+    int ret;
+    WOLFSSL_CTX* ctx = ssl->ctx;
+    MlKemKeyReuse* reuse = &ctx->mlkemReuse;
+    byte* pubKey = NULL;
+    byte* privKey = NULL;
+
+    *used = 0;
+#ifndef SINGLE_THREADED
+    /* Reuse never set up on this context. */
+    if (!ctx->mlkemReuseLockInit) {
+        return 0;
+    }
+#endif
+
+    ret = TLSX_KeyShare_LockMlKemReuse(ctx);
+    if (ret != 0) {
+        return ret;
+    }
+
+    /* Policy may be changed by another thread, only read it locked. */
+    if (reuse->maxUses <= 1) {
+        TLSX_KeyShare_UnlockMlKemReuse(ctx);
+        return 0;
+    }
+
+    if ((reuse->pubKey != NULL) && ((reuse->uses >= reuse->maxUses) ||
+            ((reuse->maxAge != 0) &&
+             (LowResTimer() - reuse->created >= reuse->maxAge)))) {
+        WOLFSSL_MSG("Cached ML-KEM key pair expired");
+        TLSX_KeyShare_FreeMlKemReuse(ctx);
+    }
+
+    if ((reuse->pubKey != NULL) && (reuse->group == kse->group)) {
+        pubKey = (byte*)XMALLOC(reuse->pubKeyLen, ssl->heap,
+                                DYNAMIC_TYPE_PUBLIC_KEY);
+        privKey = (byte*)XMALLOC(reuse->privKeyLen, ssl->heap,
+                                 DYNAMIC_TYPE_PRIVATE_KEY);
+        if ((pubKey == NULL) || (privKey == NULL)) {
+            WOLFSSL_MSG("ML-KEM key reuse memory allocation failure");
+            XFREE(pubKey, ssl->heap, DYNAMIC_TYPE_PUBLIC_KEY);
+            XFREE(privKey, ssl->heap, DYNAMIC_TYPE_PRIVATE_KEY);
+            ret = MEMORY_ERROR;
+        }
+        else {
+            XMEMCPY(pubKey, reuse->pubKey, reuse->pubKeyLen);
+            XMEMCPY(privKey, reuse->privKey, reuse->privKeyLen);
+            kse->pubKey = pubKey;
+            kse->pubKeyLen = reuse->pubKeyLen;
+            kse->privKey = privKey;
+            kse->privKeyLen = reuse->privKeyLen;
+            reuse->uses++;
+            reuse->reused++;
+            *used = 1;
+        }
+    }
+
+    TLSX_KeyShare_UnlockMlKemReuse(ctx);
+
+    return ret;
+}
+
+/* Cache a copy of a newly generated ML-KEM key pair in the context so that
+ * following handshakes can use it. Failure only means no caching.
+ *
+ * ssl      The SSL/TLS object.
+ * kse      The key share entry object with the encoded public key.
+ * privKey  The encoded private key.
+ * privSz   Size of the encoded private key in bytes.
+ */
+static void TLSX_KeyShare_SetMlKemReuse(WOLFSSL* ssl, KeyShareEntry* kse,
+    const byte* privKey, word32 privSz)
+{
+    WOLFSSL_CTX* ctx = ssl->ctx;
+    MlKemKeyReuse* reuse = &ctx->mlkemReuse;
+
+    if (TLSX_KeyShare_LockMlKemReuse(ctx) != 0) {
+        return;
+    }
+
+    reuse->generated++;
+    if (reuse->maxUses > 1) {
+        TLSX_KeyShare_FreeMlKemReuse(ctx);
+        reuse->pubKey = (byte*)XMALLOC(kse->pubKeyLen, ctx->heap,
+                                       DYNAMIC_TYPE_PUBLIC_KEY);
+        reuse->privKey = (byte*)XMALLOC(privSz, ctx->heap,
+                                        DYNAMIC_TYPE_PRIVATE_KEY);
+        if ((reuse->pubKey == NULL) || (reuse->privKey == NULL)) {
+            WOLFSSL_MSG("ML-KEM key reuse memory allocation failure");
+            TLSX_KeyShare_FreeMlKemReuse(ctx);
+        }
+        else {
+            XMEMCPY(reuse->pubKey, kse->pubKey, kse->pubKeyLen);
+            XMEMCPY(reuse->privKey, privKey, privSz);
+            reuse->pubKeyLen = kse->pubKeyLen;
+            reuse->privKeyLen = privSz;
+            reuse->group = kse->group;
+            reuse->created = LowResTimer();
+            reuse->uses = 1;
+        }
+    }
+
+    TLSX_KeyShare_UnlockMlKemReuse(ctx);
+}
+#endif /* !WOLFSSL_MLKEM_NO_MAKE_KEY */
+
+/* Set the policy for using a client ML-KEM key pair in more than one
+ * handshake, like servers do with ECDHE keys.
+ *
+ * A key pair is generated on the first handshake and then used for up to
+ * maxUses handshakes in total and for no more than maxAge seconds. Setting
+ * maxUses to 0 or 1 turns reuse off and disposes of any cached key pair.
+ * Handshakes that share a key pair do not have forward secrecy from each
+ * other.
+ *
+ * ctx      The SSL/TLS context object.
+ * maxUses  Maximum number of handshakes per key pair.
+ * maxAge   Maximum age of a key pair in seconds. 0 for no limit.
+ * returns WOLFSSL_SUCCESS on success, otherwise failure.
+ */
+int wolfSSL_CTX_SetMlKemKeyReuse(WOLFSSL_CTX* ctx, word32 maxUses,
+    word32 maxAge)
+{
+    int ret = 0;
+
+    if (ctx == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+#ifndef SINGLE_THREADED
+    if (!ctx->mlkemReuseLockInit) {
+        ret = wc_InitMutex(&ctx->mlkemReuseLock);
+        if (ret == 0) {
+            ctx->mlkemReuseLockInit = 1;
+        }
+    }
+#endif
+    if (ret == 0) {
+        ret = TLSX_KeyShare_LockMlKemReuse(ctx);
+    }
+    if (ret == 0) {
+        ctx->mlkemReuse.maxUses = maxUses;
+        ctx->mlkemReuse.maxAge = maxAge;
+        if (maxUses <= 1) {
+            TLSX_KeyShare_FreeMlKemReuse(ctx);
+        }
+        TLSX_KeyShare_UnlockMlKemReuse(ctx);
+    }
+
+    return (ret == 0) ? WOLFSSL_SUCCESS : ret;
+}
+
+/* Get the ML-KEM key reuse statistics of the context.
+ *
+ * ctx        The SSL/TLS context object.
+ * generated  Number of client key pairs generated. May be NULL.
+ * reused     Number of key shares that used a cached key pair. May be NULL.
+ * returns WOLFSSL_SUCCESS on success, otherwise failure.
+ */
+int wolfSSL_CTX_GetMlKemKeyReuseStats(WOLFSSL_CTX* ctx, word32* generated,
+    word32* reused)
+{
+    if (ctx == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    if (generated != NULL) {
+        *generated = ctx->mlkemReuse.generated;
+    }
+    if (reused != NULL) {
+        *reused = ctx->mlkemReuse.reused;
+    }
+
+    return WOLFSSL_SUCCESS;
+}
+#endif /* WOLFSSL_MLKEM_KEY_REUSE */
+
+#ifdef WOLFSSL_MLKEM_KEY_POOL
+/* Dispose of a pooled ML-KEM key pair.
+ *
+ * key   The pooled key pair.
+ * heap  Dynamic memory hint.
+ */
+static void TLSX_KeyShare_FreeMlKemPoolKey(MlKemPoolKey* key, void* heap)
+{
+    if (key->privKey != NULL) {
+        ForceZero(key->privKey, key->privKeyLen);
+        XFREE(key->privKey, heap, DYNAMIC_TYPE_PRIVATE_KEY);
+    }
+    XFREE(key->pubKey, heap, DYNAMIC_TYPE_PUBLIC_KEY);
+    XMEMSET(key, 0, sizeof(*key));
+}
+
+/* Dispose of all pregenerated ML-KEM key pairs.
+ * Lock held by caller or context being freed.
+ *
+ * ctx  The SSL/TLS context object.
+ */
+void TLSX_KeyShare_FreeMlKemPool(WOLFSSL_CTX* ctx)
+{
+    int i;
+
+    for (i = 0; i < ctx->mlkemPoolCnt; i++) {
+        TLSX_KeyShare_FreeMlKemPoolKey(&ctx->mlkemPool[i], ctx->heap);
+    }
+    ctx->mlkemPoolCnt = 0;
+}
+
+/* Lock the pregenerated ML-KEM key pairs of the context.
+ *
+ * ctx  The SSL/TLS context object.
+ * returns 0 on success, otherwise failure.
+ */
+static int TLSX_KeyShare_LockMlKemPool(WOLFSSL_CTX* ctx)
+{
+#ifndef SINGLE_THREADED
+    if (!ctx->mlkemPoolLockInit) {
+        return BAD_STATE_E;
+    }
+    return wc_LockMutex(&ctx->mlkemPoolLock);
+#else
+    (void)ctx;
+    return 0;
+#endif
+}
+
+/* Unlock the pregenerated ML-KEM key pairs of the context.
+ *
+ * ctx  The SSL/TLS context object.
+ */
+static void TLSX_KeyShare_UnlockMlKemPool(WOLFSSL_CTX* ctx)
+{
+#ifndef SINGLE_THREADED
+    wc_UnLockMutex(&ctx->mlkemPoolLock);
+#else
+    (void)ctx;
+#endif
+}
+
+#ifndef WOLFSSL_MLKEM_NO_MAKE_KEY
+/* Move the oldest pregenerated ML-KEM key pair of the group into the key
+ * share entry. The key pair leaves the pool so it is only used once.
+ *
+ * ssl   The SSL/TLS object.
+ * kse   The key share entry object.
+ * used  Set to 1 when the entry has a pregenerated key pair.
+ * returns 0 on success, otherwise failure.
+ */
+static int TLSX_KeyShare_TakeMlKemPoolKey(WOLFSSL* ssl, KeyShareEntry* kse,
+    int* used)
+{
+    int ret;
+    int i;
+    WOLFSSL_CTX* ctx = ssl->ctx;
+
+    *used = 0;
+    if (ctx->mlkemPoolCnt == 0) {
+        return 0;
+    }
+
+    ret = TLSX_KeyShare_LockMlKemPool(ctx);
+    if (ret != 0) {
+        return ret;
+    }
+
+    for (i = 0; i < ctx->mlkemPoolCnt; i++) {
+        if (ctx->mlkemPool[i].group == kse->group) {
+            break;
+        }
+    }
+    if (i < ctx->mlkemPoolCnt) {
+        MlKemPoolKey* key = &ctx->mlkemPool[i];
+
+        /* Buffers were allocated with the context's heap hint. */
+        kse->pubKey = key->pubKey;
+        kse->pubKeyLen = key->pubKeyLen;
+        kse->privKey = key->privKey;
+        kse->privKeyLen = key->privKeyLen;
+        ctx->mlkemPoolCnt--;
+        XMEMMOVE(key, key + 1, (ctx->mlkemPoolCnt - i) * sizeof(*key));
+        XMEMSET(&ctx->mlkemPool[ctx->mlkemPoolCnt], 0, sizeof(*key));
+        *used = 1;
+    }
+
+    TLSX_KeyShare_UnlockMlKemPool(ctx);
+
+    return ret;
+}
+
+/* Generate an ML-KEM key pair for a client key share ahead of time.
+ *
+ * Call when the application is idle, e.g. before wolfSSL_connect() or
+ * between connections. The next ClientHello offering the group takes the key
+ * pair out of the pool instead of running key generation.
+ *
+ * ctx    The SSL/TLS context object.
+ * group  The ML-KEM named group, e.g. WOLFSSL_ML_KEM_512.
+ * returns 1 when a key pair was added, 0 when the pool is full, otherwise
+ * failure.
+ */
+int wolfSSL_CTX_MlKemKeyPool_Generate(WOLFSSL_CTX* ctx, word16 group)
+{
+    int ret = 0;
+    int type = 0;
+    MlKemPoolKey key;
+    WC_DECLARE_VAR(kem, KyberKey, 1, 0);
+    int kemInit = 0;
+    WC_RNG rng;
+    int rngInit = 0;
+
+    if ((ctx == NULL) || !WOLFSSL_NAMED_GROUP_IS_PQC(group)) {
+        return BAD_FUNC_ARG;
+    }
+    if (ctx->mlkemPoolCnt >= WOLFSSL_MLKEM_KEY_POOL_SZ) {
+        return 0;
+    }
+
+    XMEMSET(&key, 0, sizeof(key));
+    key.group = group;
+
+#ifndef SINGLE_THREADED
+    if (!ctx->mlkemPoolLockInit) {
+        ret = wc_InitMutex(&ctx->mlkemPoolLock);
+        if (ret == 0) {
+            ctx->mlkemPoolLockInit = 1;
+        }
+    }
+#endif
+
+    if (ret == 0) {
+        ret = mlkem_id2type(group, &type);
+        if (ret == WC_NO_ERR_TRACE(NOT_COMPILED_IN)) {
+            WOLFSSL_MSG("Invalid Kyber algorithm specified.");
+            ret = BAD_FUNC_ARG;
+        }
+    }
+#ifdef WOLFSSL_SMALL_STACK
+    if (ret == 0) {
+        kem = (KyberKey *)XMALLOC(sizeof(*kem), ctx->heap,
+                                  DYNAMIC_TYPE_PRIVATE_KEY);
+        if (kem == NULL) {
+            WOLFSSL_MSG("KEM memory allocation failure");
+            ret = MEMORY_ERROR;
+        }
+    }
+#endif
+    if (ret == 0) {
+        ret = wc_KyberKey_Init(type, kem, ctx->heap, ctx->devId);
+        if (ret == 0) {
+            kemInit = 1;
+        }
+    }
+    if (ret == 0) {
+        ret = wc_KyberKey_PrivateKeySize(kem, &key.privKeyLen);
+    }
+    if (ret == 0) {
+        ret = wc_KyberKey_PublicKeySize(kem, &key.pubKeyLen);
+    }
+    if (ret == 0) {
+        key.pubKey = (byte*)XMALLOC(key.pubKeyLen, ctx->heap,
+                                    DYNAMIC_TYPE_PUBLIC_KEY);
+        key.privKey = (byte*)XMALLOC(key.privKeyLen, ctx->heap,
+                                     DYNAMIC_TYPE_PRIVATE_KEY);
+        if ((key.pubKey == NULL) || (key.privKey == NULL)) {
+            WOLFSSL_MSG("ML-KEM key pool memory allocation failure");
+            ret = MEMORY_ERROR;
+        }
+    }
+    if (ret == 0) {
+    #ifndef HAVE_FIPS
+        ret = wc_InitRng_ex(&rng, ctx->heap, ctx->devId);
+    #else
+        ret = wc_InitRng(&rng);
+    #endif
+        if (ret == 0) {
+            rngInit = 1;
+        }
+    }
+    if (ret == 0) {
+        ret = wc_KyberKey_MakeKey(kem, &rng);
+        if (ret != 0) {
+            WOLFSSL_MSG("Kyber keygen failure");
+        }
+    }
+    if (ret == 0) {
+        ret = wc_KyberKey_EncodePublicKey(kem, key.pubKey, key.pubKeyLen);
+    }
+    if (ret == 0) {
+        ret = wc_KyberKey_EncodePrivateKey(kem, key.privKey, key.privKeyLen);
+    }
+    if (rngInit) {
+        wc_FreeRng(&rng);
+    }
+    if (kemInit) {
+        wc_KyberKey_Free(kem);
+    }
+    WC_FREE_VAR_EX(kem, ctx->heap, DYNAMIC_TYPE_PRIVATE_KEY);
+
+    /* Key generation done without the lock - add if there is still room. */
+    if ((ret == 0) && ((ret = TLSX_KeyShare_LockMlKemPool(ctx)) == 0)) {
+        if (ctx->mlkemPoolCnt < WOLFSSL_MLKEM_KEY_POOL_SZ) {
+            ctx->mlkemPool[ctx->mlkemPoolCnt++] = key;
+            XMEMSET(&key, 0, sizeof(key));
+            ret = 1;
+        }
+        TLSX_KeyShare_UnlockMlKemPool(ctx);
+    }
+    TLSX_KeyShare_FreeMlKemPoolKey(&key, ctx->heap);
+
+    return ret;
+}
+#endif /* !WOLFSSL_MLKEM_NO_MAKE_KEY */
+
+/* Get the number of pregenerated ML-KEM key pairs held by the context.
+ *
+ * ctx  The SSL/TLS context object.
+ * returns the number of key pairs, otherwise failure.
+ */
+int wolfSSL_CTX_MlKemKeyPool_Count(WOLFSSL_CTX* ctx)
+{
+    if (ctx == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    return ctx->mlkemPoolCnt;
+}
+#endif /* WOLFSSL_MLKEM_KEY_POOL */
+
+#ifdef WOLFSSL_PQC_NONBLOCK
+/* Verify ML-DSA signatures and decapsulate ML-KEM over a number of calls.
+ *
+ * While the ServerHello key share, the Certificate or the CertificateVerify
+ * message is being processed, wolfSSL_connect() returns WOLFSSL_FATAL_ERROR
+ * and wolfSSL_get_error() returns WC_PENDING_E. The message is kept and
+ * processed again on the next call to wolfSSL_connect(), which continues the
+ * operation. Each call spends about cycles, as counted by
+ * WC_NONBLOCK_CYCLES(), or one step when cycles is 0.
+ *
+ * ssl     The SSL/TLS object.
+ * cycles  Budget of cycles per call.
+ * returns WOLFSSL_SUCCESS on success, otherwise failure.
+ */
+int wolfSSL_UsePqcNonBlock(WOLFSSL* ssl, word32 cycles)
+{
+    if (ssl == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    if (ssl->dilithiumNb == NULL) {
+        ssl->dilithiumNb = (dilithium_nb_ctx*)XMALLOC(sizeof(dilithium_nb_ctx),
+            ssl->heap, DYNAMIC_TYPE_DILITHIUM);
+        if (ssl->dilithiumNb == NULL) {
+            return MEMORY_E;
+        }
+        XMEMSET(ssl->dilithiumNb, 0, sizeof(dilithium_nb_ctx));
+    }
+    if (ssl->mlkemNb == NULL) {
+        ssl->mlkemNb = (MlKemNbCtx*)XMALLOC(sizeof(MlKemNbCtx), ssl->heap,
+            DYNAMIC_TYPE_PRIVATE_KEY);
+        if (ssl->mlkemNb == NULL) {
+            return MEMORY_E;
+        }
+        XMEMSET(ssl->mlkemNb, 0, sizeof(MlKemNbCtx));
+    }
+    ssl->dilithiumNb->budget = cycles;
+    ssl->mlkemNb->budget = cycles;
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Get the number of post-quantum steps performed and the number of times
+ * wolfSSL_connect() returned between steps.
+ *
+ * ssl     The SSL/TLS object.
+ * steps   Number of steps performed. May be NULL.
+ * yields  Number of returns with WC_PENDING_E. May be NULL.
+ * returns WOLFSSL_SUCCESS on success, otherwise failure.
+ */
+int wolfSSL_GetPqcNonBlockStats(WOLFSSL* ssl, word32* steps, word32* yields)
+{
+    word32 s = 0;
+    word32 y = 0;
+
+    if (ssl == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    if (ssl->dilithiumNb != NULL) {
+        s += ssl->dilithiumNb->steps;
+        y += ssl->dilithiumNb->yields;
+    }
+    if (ssl->mlkemNb != NULL) {
+        s += ssl->mlkemNb->steps;
+        y += ssl->mlkemNb->yields;
+    }
+    if (steps != NULL) {
+        *steps = s;
+    }
+    if (yields != NULL) {
+        *yields = y;
+    }
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Dispose of the non-blocking contexts of the SSL/TLS object.
+ *
+ * ssl  The SSL/TLS object.
+ */
+void TLSX_FreePqcNonBlock(WOLFSSL* ssl)
+{
+    if (ssl->dilithiumNb != NULL) {
+        wc_dilithium_free_nonblock(ssl->dilithiumNb);
+        XFREE(ssl->dilithiumNb, ssl->heap, DYNAMIC_TYPE_DILITHIUM);
+        ssl->dilithiumNb = NULL;
+    }
+    if (ssl->mlkemNb != NULL) {
+        wc_MlKemKey_FreeNonBlock(ssl->mlkemNb);
+        XFREE(ssl->mlkemNb, ssl->heap, DYNAMIC_TYPE_PRIVATE_KEY);
+        ssl->mlkemNb = NULL;
+    }
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+    XFREE(ssl->verifiedLookup, ssl->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    ssl->verifiedLookup = NULL;
+#endif
+}
+#endif /* WOLFSSL_PQC_NONBLOCK */
+
 #ifndef WOLFSSL_MLKEM_NO_MAKE_KEY
 /* Create a key share entry using pqc parameters group on the client side.
  * Generates a key pair.
@@ -8447,6 +9042,33 @@ static int TLSX_KeyShare_GenPqcKeyClient(WOLFSSL *ssl, KeyShareEntry* kse)
         ret = BAD_FUNC_ARG;
     }
 
+#ifdef WOLFSSL_MLKEM_KEY_REUSE
+    if (ret == 0) {
+        int used = 0;
+
+        /* Use the context's key pair when its reuse policy allows. */
+        ret = TLSX_KeyShare_GetMlKemReuse(ssl, kse, &used);
+        if ((ret == 0) && used) {
+            return 0;
+        }
+    }
+#endif
+#ifdef WOLFSSL_MLKEM_KEY_POOL
+    if (ret == 0) {
+        int used = 0;
+
+        /* Take a key pair generated ahead of time when there is one. */
+        ret = TLSX_KeyShare_TakeMlKemPoolKey(ssl, kse, &used);
+        if ((ret == 0) && used) {
+        #ifdef WOLFSSL_MLKEM_KEY_REUSE
+            TLSX_KeyShare_SetMlKemReuse(ssl, kse, kse->privKey,
+                kse->privKeyLen);
+        #endif
+            return 0;
+        }
+    }
+#endif
+
 #ifndef WOLFSSL_TLSX_PQC_MLKEM_STORE_OBJ
 
     #ifdef WOLFSSL_SMALL_STACK
@@ -8552,6 +9174,9 @@ static int TLSX_KeyShare_GenPqcKeyClient(WOLFSSL *ssl, KeyShareEntry* kse)
     else {
     #ifndef WOLFSSL_TLSX_PQC_MLKEM_STORE_OBJ
         wc_KyberKey_Free(kem);
+        #ifdef WOLFSSL_MLKEM_KEY_REUSE
+        TLSX_KeyShare_SetMlKemReuse(ssl, kse, privKey, privSz);
+        #endif
         kse->privKey = (byte*)privKey;
         kse->privKeyLen = privSz;
     #else
@@ -9487,9 +10112,23 @@ static int TLSX_KeyShare_ProcessPqcClient_ex(WOLFSSL* ssl,
     }
 #endif
 
+    if (ret == 0) {
+    #ifdef WOLFSSL_PQC_NONBLOCK
+        if (ssl->mlkemNb != NULL) {
+            ret = wc_MlKemKey_SetNonBlock(kem, ssl->mlkemNb);
+        }
+    #endif
+    }
     if (ret == 0) {
         ret = wc_KyberKey_Decapsulate(kem, ssOutput,
                                       keyShareEntry->ke, ctSz);
+    #ifdef WOLFSSL_PQC_NONBLOCK
+        if (ret == WC_NO_ERR_TRACE(MP_WOULDBLOCK)) {
+            /* Key share is decoded and processed again on the next call. */
+            ret = WC_PENDING_E;
+        }
+        else
+    #endif
         if (ret != 0) {
             WOLFSSL_MSG("wc_KyberKey decapsulation failure.");
             ret = BAD_FUNC_ARG;
@@ -9520,9 +10159,13 @@ static int TLSX_KeyShare_ProcessPqcClient_ex(WOLFSSL* ssl,
 static int TLSX_KeyShare_ProcessPqcClient(WOLFSSL* ssl,
                                           KeyShareEntry* keyShareEntry)
 {
-    return TLSX_KeyShare_ProcessPqcClient_ex(ssl, keyShareEntry,
-                                             ssl->arrays->preMasterSecret,
-                                             &ssl->arrays->preMasterSz);
+    int traceTok = WOLFSSL_TRACE_BEGIN(TRACE_KEYSHARE_PQC);
+    int ret = TLSX_KeyShare_ProcessPqcClient_ex(ssl, keyShareEntry,
+                                                ssl->arrays->preMasterSecret,
+                                                &ssl->arrays->preMasterSz);
+
+    WOLFSSL_TRACE_END(traceTok);
+    return ret;
 }
 
 /* Process the hybrid key share extension on the client side.
@@ -1455,6 +1455,7 @@ int DeriveTls13Keys(WOLFSSL* ssl, int secret, int side, int store)
 {
     int   ret = WC_NO_ERR_TRACE(BAD_FUNC_ARG); /* Assume failure */
     int   i = 0;
+    int   traceTok;
     WC_DECLARE_VAR(key_dig, byte, MAX_PRF_DIG, 0);
     int   provision;
 
@@ -1468,6 +1469,7 @@ int DeriveTls13Keys(WOLFSSL* ssl, int secret, int side, int store)
 
     WC_ALLOC_VAR_EX(key_dig, byte, MAX_PRF_DIG, ssl->heap,
         DYNAMIC_TYPE_DIGEST, return MEMORY_E);
+    traceTok = WOLFSSL_TRACE_BEGIN(TRACE_DERIVE_KEYS);
 
     if (side == ENCRYPT_AND_DECRYPT_SIDE) {
         provision = PROVISION_CLIENT_SERVER;
@@ -1654,6 +1656,7 @@ end:
     wc_MemZero_Check(key_dig, MAX_PRF_DIG);
 #endif
 
+    WOLFSSL_TRACE_END(traceTok);
     if (ret != 0) {
         WOLFSSL_ERROR_VERBOSE(ret);
     }
@@ -3217,8 +3220,9 @@ static void FreeBuildMsg13Args(WOLFSSL* ssl, void* pArgs)
  * asyncOkay   If non-zero can return WC_PENDING_E, otherwise blocks on crypto
  * returns the size of the encrypted record message or negative value on error.
  */
-int BuildTls13Message(WOLFSSL* ssl, byte* output, int outSz, const byte* input,
-                int inSz, int type, int hashOutput, int sizeOnly, int asyncOkay)
+static int BuildTls13Message_ex(WOLFSSL* ssl, byte* output, int outSz,
+                const byte* input, int inSz, int type, int hashOutput,
+                int sizeOnly, int asyncOkay)
 {
     int ret;
     BuildMsg13Args* args;
@@ -3439,6 +3443,20 @@ exit_buildmsg:
     return ret;
 }
 
+/* Build SSL Message, encrypted, as a trace span (WOLFSSL_TRACE_BEGIN).
+ * See BuildTls13Message_ex() for the parameters.
+ */
+int BuildTls13Message(WOLFSSL* ssl, byte* output, int outSz, const byte* input,
+                int inSz, int type, int hashOutput, int sizeOnly, int asyncOkay)
+{
+    int traceTok = WOLFSSL_TRACE_BEGIN(TRACE_BUILD_MESSAGE);
+    int ret = BuildTls13Message_ex(ssl, output, outSz, input, inSz, type,
+                                   hashOutput, sizeOnly, asyncOkay);
+
+    WOLFSSL_TRACE_END(traceTok);
+    return ret;
+}
+
 #if !defined(NO_WOLFSSL_CLIENT) || (!defined(NO_WOLFSSL_SERVER) && \
     (defined(HAVE_SESSION_TICKET) || !defined(NO_PSK)) && \
     (defined(WOLFSSL_PSK_ONE_ID) || defined(WOLFSSL_PRIORITIZE_PSK)))
@@ -4318,7 +4336,7 @@ typedef struct Sch13Args {
 #endif
 } Sch13Args;
 
-int SendTls13ClientHello(WOLFSSL* ssl)
+static int SendTls13ClientHello_ex(WOLFSSL* ssl)
 {
     int ret;
 #ifdef WOLFSSL_ASYNC_CRYPT
@@ -4794,6 +4812,21 @@ int SendTls13ClientHello(WOLFSSL* ssl)
     return ret;
 }
 
+/* Send a ClientHello message to the server as a trace span
+ * (WOLFSSL_TRACE_BEGIN), see SendTls13ClientHello_ex().
+ *
+ * ssl  The SSL/TLS object.
+ * returns 0 on success and otherwise failure.
+ */
+int SendTls13ClientHello(WOLFSSL* ssl)
+{
+    int traceTok = WOLFSSL_TRACE_BEGIN(TRACE_CLIENT_HELLO);
+    int ret = SendTls13ClientHello_ex(ssl);
+
+    WOLFSSL_TRACE_END(traceTok);
+    return ret;
+}
+
 #if defined(WOLFSSL_DTLS13) && !defined(WOLFSSL_NO_CLIENT)
 static int Dtls13ClientDoDowngrade(WOLFSSL* ssl)
 {
@@ -5405,7 +5438,7 @@ int DoTls13ServerHello(WOLFSSL* ssl, const byte* input, word32* inOutIdx,
         ret = TLSX_Parse(ssl, input + args->idx, args->totalExtSz,
             *extMsgType, NULL);
         if (ret != 0) {
-        #ifdef WOLFSSL_ASYNC_CRYPT
+        #if defined(WOLFSSL_ASYNC_CRYPT) || defined(WOLFSSL_PQC_NONBLOCK)
             /* Handle async operation */
             if (ret == WC_NO_ERR_TRACE(WC_PENDING_E)) {
                 /* Mark message as not received so it can process again */
@@ -10145,6 +10178,7 @@ static int DoTls13CertificateVerify(WOLFSSL* ssl, byte* input,
 #else
     Dcv13Args  args[1];
 #endif
+    int         traceTok = WOLFSSL_TRACE_BEGIN(TRACE_CERT_VERIFY);
 
     WOLFSSL_START(WC_FUNC_CERTIFICATE_VERIFY_DO);
     WOLFSSL_ENTER("DoTls13CertificateVerify");
@@ -10710,9 +10744,19 @@ static int DoTls13CertificateVerify(WOLFSSL* ssl, byte* input,
                 (ssl->peerDilithiumKeyPresent)) {
                 int res = 0;
                 WOLFSSL_MSG("Doing Dilithium peer cert verify");
+            #ifdef WOLFSSL_PQC_NONBLOCK
+                wc_dilithium_set_nonblock(ssl->peerDilithiumKey,
+                                          ssl->dilithiumNb);
+            #endif
                 ret = wc_dilithium_verify_ctx_msg(sig, args->sigSz, NULL, 0,
                                                   args->sigData, args->sigDataSz,
                                                   &res, ssl->peerDilithiumKey);
+            #ifdef WOLFSSL_PQC_NONBLOCK
+                wc_dilithium_set_nonblock(ssl->peerDilithiumKey, NULL);
+                if (ret == WC_NO_ERR_TRACE(MP_WOULDBLOCK)) {
+                    ret = WC_PENDING_E;
+                }
+            #endif
 
                 if ((ret >= 0) && (res == 1)) {
                     /* CLIENT/SERVER: data verified with public key from
@@ -10941,10 +10985,18 @@ exit_dcv:
         /* Mark message as not received so it can process again */
         ssl->msgsReceived.got_certificate_verify = 0;
 
+        WOLFSSL_TRACE_END(traceTok);
         return ret;
     }
     else
 #endif /* WOLFSSL_ASYNC_CRYPT */
+#ifdef WOLFSSL_PQC_NONBLOCK
+    if (ret == WC_NO_ERR_TRACE(WC_PENDING_E)) {
+        /* Message is processed again from the start on the next call */
+        ssl->msgsReceived.got_certificate_verify = 0;
+    }
+    else
+#endif
     if (ret != 0) {
         WOLFSSL_ERROR_VERBOSE(ret);
 
@@ -10961,6 +11013,7 @@ exit_dcv:
     FreeAsyncCtx(ssl, 0);
 #endif
 
+    WOLFSSL_TRACE_END(traceTok);
     return ret;
 }
 #endif /* !NO_RSA || HAVE_ECC */
@@ -12932,6 +12985,12 @@ int DoTls13HandShakeMsgType(WOLFSSL* ssl, byte* input, word32* inOutIdx,
          ssl->error == WC_NO_ERR_TRACE(OCSP_WANT_READ))) {
         ssl->error = 0;
     }
+#endif
+#ifdef WOLFSSL_PQC_NONBLOCK
+    /* sliced PQC operation finished, clear the pending error */
+    if (ret == 0 && ssl->error == WC_NO_ERR_TRACE(WC_PENDING_E)) {
+        ssl->error = 0;
+    }
 #endif
     if (ret == 0 && type != client_hello && type != session_ticket &&
                                                            type != key_update) {
@@ -13289,7 +13348,7 @@ int wolfSSL_connect_TLSv13(WOLFSSL* ssl)
 #endif /* WOLFSSL_DTLS13 */
 
     if (ssl->buffers.outputBuffer.length > 0
-    #ifdef WOLFSSL_ASYNC_CRYPT
+    #if defined(WOLFSSL_ASYNC_CRYPT) || defined(WOLFSSL_PQC_NONBLOCK)
         /* do not send buffered or advance state if last error was an
             async pending operation */
         && ssl->error != WC_NO_ERR_TRACE(WC_PENDING_E)
@@ -2347,6 +2347,34 @@ void wolfSSL_CTX_SetIORecv(WOLFSSL_CTX *ctx, CallbackIORecv CBIORecv)
 }
 
 
+#ifdef WOLFSSL_ZERO_COPY_RX
+/* sets the zero-copy receive callbacks, only used for DTLS (not SCTP) */
+void wolfSSL_CTX_SetIORecvZeroCopy(WOLFSSL_CTX *ctx,
+    CallbackIORecvZeroCopy CBIORecvZeroCopy,
+    CallbackIORecvRelease CBIORecvRelease)
+{
+    if (ctx) {
+        ctx->CBIORecvZeroCopy = CBIORecvZeroCopy;
+        ctx->CBIORecvRelease  = CBIORecvRelease;
+    }
+}
+#endif /* WOLFSSL_ZERO_COPY_RX */
+
+
+#ifdef WOLFSSL_ZERO_COPY_TX
+/* sets the zero-copy send buffer callback, only used for DTLS (not SCTP) */
+void wolfSSL_CTX_SetIOSendZeroCopy(WOLFSSL_CTX *ctx,
+    CallbackIOSendGetBuffer CBIOSendGetBuffer,
+    CallbackIOSendRelease CBIOSendRelease)
+{
+    if (ctx) {
+        ctx->CBIOSendGetBuffer = CBIOSendGetBuffer;
+        ctx->CBIOSendRelease   = CBIOSendRelease;
+    }
+}
+#endif /* WOLFSSL_ZERO_COPY_TX */
+
+
 void wolfSSL_CTX_SetIOSend(WOLFSSL_CTX *ctx, CallbackIOSend CBIOSend)
 {
     if (ctx) {
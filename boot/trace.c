@@ -0,0 +1,126 @@
+#include "trace.h"
+#include "mem_profile.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <generated/soc.h>
+
+#ifdef CYCLE_TRACE
+
+extern uint64_t read_cycle64(void);
+
+/*
+ * CYCLE TRACER
+ *
+ * Spans go into a ring of TRACE_RING_SZ records in the order they begin.
+ * The token handed out by trace_begin() is the span's sequence number, so
+ * trace_end() can tell whether its record was overwritten meanwhile (a span
+ * that outlives TRACE_RING_SZ newer ones) instead of closing someone else's
+ * record. Overwritten spans are reported as dropped.
+ */
+
+#if (TRACE_RING_SZ & (TRACE_RING_SZ - 1)) != 0
+#error TRACE_RING_SZ must be a power of two
+#endif
+
+typedef struct {
+    uint32_t seq;         // sequence number of the span in this slot
+    uint8_t  span;        // TRACE_* id
+    uint8_t  depth;       // spans open around it when it began
+    uint8_t  closed;      // 1 once trace_end() has run
+    uint64_t start;
+    uint64_t end;
+    size_t   heap_start;  // g_heap_current when the span began
+    int32_t  heap_delta;  // heap growth between begin and end
+} TraceRecord;
+
+static const char *span_names[TRACE_SPAN_COUNT] = {
+    "handshake",
+    "SendTls13ClientHello",
+    "TLSX_KeyShare_ProcessPqcClient",
+    "ProcessPeerCerts",
+    "DoTls13CertificateVerify",
+    "DeriveTls13Keys",
+    "BuildTls13Message",
+};
+
+static TraceRecord ring[TRACE_RING_SZ];
+static uint32_t next_seq = 0;
+static uint32_t depth = 0;     // spans open right now
+
+int trace_begin(int span)
+{
+    uint32_t seq = next_seq++;
+    TraceRecord *r = &ring[seq & (TRACE_RING_SZ - 1)];
+
+    r->seq = seq;
+    r->span = (uint8_t)span;
+    r->depth = (uint8_t)depth++;
+    r->closed = 0;
+    r->heap_start = g_heap_current;
+    r->heap_delta = 0;
+    r->end = 0;
+    r->start = read_cycle64();
+    return (int)seq;
+}
+
+void trace_end(int token)
+{
+    uint64_t now = read_cycle64();
+    TraceRecord *r = &ring[(uint32_t)token & (TRACE_RING_SZ - 1)];
+
+    if (depth > 0)
+        depth--;
+    if (r->seq != (uint32_t)token || r->closed)
+        return; // Record reused by a newer span
+    r->end = now;
+    r->heap_delta = (int32_t)(g_heap_current - r->heap_start);
+    r->closed = 1;
+}
+
+void trace_reset(void)
+{
+    for (int i = 0; i < TRACE_RING_SZ; i++)
+        ring[i].closed = 0;
+    next_seq = 0;
+    depth = 0;
+}
+
+/* Prints the closed spans, oldest first, as one JSON object:
+     {"hz":..,"names":[..],"dropped":n,"base":c,
+      "spans":[[id,depth,start,end,heap_delta],..]}
+   start and end are cycles after "base" so the numbers stay short. */
+void trace_dump(void)
+{
+    uint32_t first = (next_seq > TRACE_RING_SZ) ? next_seq - TRACE_RING_SZ : 0;
+    uint64_t base = 0;
+    int n = 0;
+
+    for (uint32_t s = first; s < next_seq; s++){
+        TraceRecord *r = &ring[s & (TRACE_RING_SZ - 1)];
+        if (r->closed){
+            base = r->start;
+            break;
+        }
+    }
+
+    printf("=== TRACE JSON ===\n");
+    printf("{\"hz\":%lu,\"names\":[", (unsigned long)CONFIG_CLOCK_FREQUENCY);
+    for (int i = 0; i < TRACE_SPAN_COUNT; i++)
+        printf("%s\"%s\"", i ? "," : "", span_names[i]);
+    printf("],\"dropped\":%lu,\"base\":%llu,\"spans\":[\n",
+           (unsigned long)first, (unsigned long long)base);
+    for (uint32_t s = first; s < next_seq; s++){
+        TraceRecord *r = &ring[s & (TRACE_RING_SZ - 1)];
+        if (!r->closed)
+            continue; // Still open, e.g. dumped from inside a span
+        printf("%s[%u,%u,%llu,%llu,%ld]", n++ ? ",\n" : "",
+               r->span, r->depth,
+               (unsigned long long)(r->start - base),
+               (unsigned long long)(r->end - base),
+               (long)r->heap_delta);
+    }
+    printf("]}\n");
+    printf("=== TRACE END ===\n");
+}
+
+#endif /* CYCLE_TRACE */
@@ -0,0 +1,29 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+/* --- Cycle Tracing --- */
+/* Named spans timed with read_cycle64(). Spans nest, each one records its
+   depth, start and end cycle and how much the tracked heap grew while it
+   was open. Included from user_settings.h, so keep it free of wolfSSL. */
+#define TRACE_HANDSHAKE      0  /* one wolfSSL_connect loop in main.c */
+#define TRACE_CLIENT_HELLO   1  /* SendTls13ClientHello */
+#define TRACE_KEYSHARE_PQC   2  /* TLSX_KeyShare_ProcessPqcClient (decaps) */
+#define TRACE_PEER_CERTS     3  /* ProcessPeerCerts (chain, ML-DSA verify) */
+#define TRACE_CERT_VERIFY    4  /* DoTls13CertificateVerify */
+#define TRACE_DERIVE_KEYS    5  /* DeriveTls13Keys */
+#define TRACE_BUILD_MESSAGE  6  /* BuildTls13Message (encrypt a record) */
+#define TRACE_SPAN_COUNT     7
+
+/* Spans kept, older ones are overwritten. Must be a power of two. */
+#ifndef TRACE_RING_SZ
+#define TRACE_RING_SZ        256
+#endif
+
+int  trace_begin(int span);   /* returns the token for trace_end() */
+void trace_end(int token);
+void trace_reset(void);
+void trace_dump(void);        /* JSON over the UART, see scripts/trace2flame.py */
+
+#endif // TRACE_H
@@ -104,6 +104,15 @@ ASN Options:
  *  DO NOT enable this unless required for interoperability.
  * WOLFSSL_ASN_EXTRA: Make more ASN.1 APIs available regardless of internal
  *  usage.
+ * WOLFSSL_MLDSA_CA_PRECOMPUTE: Keep an imported ML-DSA public key with the
+ *  expanded matrix A, NTT form of t1 and tr on each ML-DSA CA signer. The key
+ *  is prepared when first needed, or earlier with PrepareSignerMlDsaKey(), and
+ *  certificate signature checks only compute mu and the verification itself.
+ *  Requires WC_DILITHIUM_CACHE_PUB_VECTORS and SINGLE_THREADED.
+ * WC_DILITHIUM_NONBLOCK: ConfirmSignature() verifies ML-DSA signatures in steps
+ *  when the signature context has a non-blocking context and returns
+ *  MP_WOULDBLOCK until the result is known. CheckCertSignatureNonBlock() is
+ *  the small certificate verify check with a non-blocking context.
 */
 
 #ifndef NO_RSA
@@ -174,6 +183,19 @@ ASN Options:
 #if defined(HAVE_DILITHIUM)
     #include <wolfssl/wolfcrypt/dilithium.h>
 #endif
+
+#ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+    #if !defined(HAVE_DILITHIUM) || !defined(WC_DILITHIUM_CACHE_PUB_VECTORS)
+        #error "WOLFSSL_MLDSA_CA_PRECOMPUTE requires HAVE_DILITHIUM and" \
+               " WC_DILITHIUM_CACHE_PUB_VECTORS"
+    #endif
+    #if !defined(SINGLE_THREADED) || defined(WOLFSSL_NO_MALLOC)
+        /* The prepared key, including its SHAKE object, is shared by every
+         * verification against the CA. */
+        #error "WOLFSSL_MLDSA_CA_PRECOMPUTE requires SINGLE_THREADED and" \
+               " dynamic memory"
+    #endif
+#endif
 #if defined(HAVE_SPHINCS)
     #include <wolfssl/wolfcrypt/sphincs.h>
 #endif
@@ -17881,6 +17903,13 @@ void FreeSignatureCtx(SignatureCtx* sigCtx)
             case ML_DSA_LEVEL2k:
             case ML_DSA_LEVEL3k:
             case ML_DSA_LEVEL5k:
+            #ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+                if (sigCtx->key.dilithium == sigCtx->caDilithium) {
+                    /* Prepared key belongs to the signer. */
+                    sigCtx->key.dilithium = NULL;
+                    break;
+                }
+            #endif
                 wc_dilithium_free(sigCtx->key.dilithium);
             #ifndef WOLFSSL_NO_MALLOC
                 XFREE(sigCtx->key.dilithium, sigCtx->heap,
@@ -18575,6 +18604,13 @@ int ConfirmSignature(SignatureCtx* sigCtx,
                         goto exit_cs;
                     }
                     sigCtx->verify = 0;
+                #ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+                    if (sigCtx->caDilithium != NULL) {
+                        /* Key was imported when the CA was prepared. */
+                        sigCtx->key.dilithium = sigCtx->caDilithium;
+                        break;
+                    }
+                #endif
                 #ifndef WOLFSSL_NO_MALLOC
                     sigCtx->key.dilithium = (dilithium_key*)XMALLOC(
                         sizeof(dilithium_key), sigCtx->heap,
@@ -18951,8 +18987,16 @@ int ConfirmSignature(SignatureCtx* sigCtx,
                 case ML_DSA_LEVEL3k:
                 case ML_DSA_LEVEL5k:
                 {
+                #ifdef WC_DILITHIUM_NONBLOCK
+                    /* Key may be shared - only non-blocking for this call. */
+                    wc_dilithium_set_nonblock(sigCtx->key.dilithium,
+                        sigCtx->dilithiumNb);
+                #endif
                     ret = wc_dilithium_verify_ctx_msg(sig, sigSz, NULL, 0, buf,
                         bufSz, &sigCtx->verify, sigCtx->key.dilithium);
+                #ifdef WC_DILITHIUM_NONBLOCK
+                    wc_dilithium_set_nonblock(sigCtx->key.dilithium, NULL);
+                #endif
                     break;
                 }
             #endif /* HAVE_DILITHIUM */
@@ -18980,6 +19024,13 @@ int ConfirmSignature(SignatureCtx* sigCtx,
             }
         #endif
 
+        #ifdef WC_DILITHIUM_NONBLOCK
+            if (ret == WC_NO_ERR_TRACE(MP_WOULDBLOCK)) {
+                /* Verification continues on next call. */
+                goto exit_cs;
+            }
+        #endif
+
             if (ret < 0) {
                 /* treat all errors as ASN_SIG_CONFIRM_E */
                 ret = ASN_SIG_CONFIRM_E;
@@ -24563,7 +24614,8 @@ static int GetAKIHash(const byte* input, word32 maxIdx, word32 sigOID,
  *   OCSP Only: alt lookup using subject and pub key w/o sig check
  */
 static int CheckCertSignature_ex(const byte* cert, word32 certSz, void* heap,
-        void* cm, const byte* pubKey, word32 pubKeySz, int pubKeyOID, int req)
+        void* cm, const byte* pubKey, word32 pubKeySz, int pubKeyOID, int req,
+        void* dilithiumNb)
 {
 #ifndef WOLFSSL_ASN_TEMPLATE
 #if !defined(WOLFSSL_SMALL_STACK) || defined(WOLFSSL_NO_MALLOC)
@@ -24605,6 +24657,11 @@ static int CheckCertSignature_ex(const byte* cert, word32 certSz, void* heap,
 #endif
 
     InitSignatureCtx(sigCtx, heap, INVALID_DEVID);
+#ifdef WC_DILITHIUM_NONBLOCK
+    sigCtx->dilithiumNb = (dilithium_nb_ctx*)dilithiumNb;
+#else
+    (void)dilithiumNb;
+#endif
 
     /* Certificate SEQUENCE */
     if (GetSequence(cert, &idx, &len, certSz) < 0)
@@ -24893,6 +24950,11 @@ static int CheckCertSignature_ex(const byte* cert, word32 certSz, void* heap,
                 cert + idx, len, signatureOID, sigParams, sigParamsSz, NULL);
         }
         else {
+        #ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+            if (PrepareSignerMlDsaKey(ca, heap) == 0) {
+                sigCtx->caDilithium = ca->mldsaKey;
+            }
+        #endif
             ret = ConfirmSignature(sigCtx, cert + tbsCertIdx,
                 sigIndex - tbsCertIdx, ca->publicKey, ca->pubKeySize,
                 ca->keyOID, cert + idx, len, signatureOID, sigParams,
@@ -25094,6 +25156,15 @@ static int CheckCertSignature_ex(const byte* cert, word32 certSz, void* heap,
         if (WC_VAR_OK(sigCtx))
         {
             InitSignatureCtx(sigCtx, heap, INVALID_DEVID);
+        #ifdef WC_DILITHIUM_NONBLOCK
+            sigCtx->dilithiumNb = (dilithium_nb_ctx*)dilithiumNb;
+        #endif
+        #ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+            /* Use the CA's prepared key when it has an ML-DSA key. */
+            if ((ca != NULL) && (PrepareSignerMlDsaKey(ca, heap) == 0)) {
+                sigCtx->caDilithium = ca->mldsaKey;
+            }
+        #endif
 
             /* Check signature. */
             ret = ConfirmSignature(sigCtx, tbs, tbsSz, pubKey, pubKeySz,
@@ -25108,6 +25179,10 @@ static int CheckCertSignature_ex(const byte* cert, word32 certSz, void* heap,
         }
     }
 
+#ifndef WC_DILITHIUM_NONBLOCK
+    (void)dilithiumNb;
+#endif
+
     return ret;
 #endif /* WOLFSSL_ASN_TEMPLATE */
 }
@@ -25117,7 +25192,7 @@ int CheckCertSignaturePubKey(const byte* cert, word32 certSz, void* heap,
         const byte* pubKey, word32 pubKeySz, int pubKeyOID)
 {
     return CheckCertSignature_ex(cert, certSz, heap, NULL,
-            pubKey, pubKeySz, pubKeyOID, 0);
+            pubKey, pubKeySz, pubKeyOID, 0, NULL);
 }
 
 /* Call CheckCertSignature_ex using a public key and oid */
@@ -25133,15 +25208,26 @@ int CheckCSRSignaturePubKey(const byte* cert, word32 certSz, void* heap,
         const byte* pubKey, word32 pubKeySz, int pubKeyOID)
 {
     return CheckCertSignature_ex(cert, certSz, heap, NULL,
-            pubKey, pubKeySz, pubKeyOID, 1);
+            pubKey, pubKeySz, pubKeyOID, 1, NULL);
 }
 #endif /* WOLFSSL_CERT_REQ */
 
 /* Call CheckCertSignature_ex using a certificate manager (cm) */
 int wc_CheckCertSignature(const byte* cert, word32 certSz, void* heap, void* cm)
 {
-    return CheckCertSignature_ex(cert, certSz, heap, cm, NULL, 0, 0, 0);
+    return CheckCertSignature_ex(cert, certSz, heap, cm, NULL, 0, 0, 0, NULL);
+}
+
+#ifdef WC_DILITHIUM_NONBLOCK
+/* Call CheckCertSignature_ex using a certificate manager (cm) and verify an
+ * ML-DSA signature in steps with the non-blocking context (nb).
+ * Returns MP_WOULDBLOCK until the verification is finished. */
+int CheckCertSignatureNonBlock(const byte* cert, word32 certSz, void* heap,
+    void* cm, dilithium_nb_ctx* nb)
+{
+    return CheckCertSignature_ex(cert, certSz, heap, cm, NULL, 0, 0, 0, nb);
 }
+#endif
 #endif /* WOLFSSL_SMALL_CERT_VERIFY || OPENSSL_EXTRA */
 
 #if (defined(HAVE_ED25519) && defined(HAVE_ED25519_KEY_IMPORT) || \
@@ -25848,6 +25934,12 @@ int ParseCertRelative(DecodedCert* cert, int type, int verify, void* cm,
                 if (cert->selfSigned && (cert->signatureOID == CTC_SM3wSM2)) {
                     keyOID = SM2k;
                 }
+            #endif
+            #ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+                if ((keyOID == cert->ca->keyOID) &&
+                        (PrepareSignerMlDsaKey(cert->ca, cert->heap) == 0)) {
+                    cert->sigCtx.caDilithium = cert->ca->mldsaKey;
+                }
             #endif
                 /* try to confirm/verify signature */
                 if ((ret = ConfirmSignature(&cert->sigCtx,
@@ -26138,10 +26230,92 @@ void FreeSigner(Signer* signer, void* heap)
 #endif
 #ifdef WOLFSSL_SIGNER_DER_CERT
     FreeDer(&signer->derCert);
+#endif
+#ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+    if (signer->mldsaKey != NULL) {
+        wc_dilithium_free(signer->mldsaKey);
+        XFREE(signer->mldsaKey, heap, DYNAMIC_TYPE_DILITHIUM);
+    }
 #endif
     XFREE(signer, heap, DYNAMIC_TYPE_SIGNER);
 }
 
+#ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+/* Import the ML-DSA public key of a signer and keep it on the signer.
+ *
+ * Importing expands the matrix A, converts t1 to NTT form and hashes the
+ * public key. Doing this once per CA leaves only mu and the verification
+ * itself to be computed for each certificate checked against it.
+ *
+ * @param [in, out] signer  Signer object.
+ * @param [in]      heap    Dynamic memory hint.
+ * @return  0 on success or when the key was already prepared.
+ * @return  BAD_FUNC_ARG when signer is NULL.
+ * @return  NOT_COMPILED_IN when the signer's key is not an ML-DSA key.
+ * @return  MEMORY_E on dynamic memory allocation failure.
+ * @return  Other negative on error importing the key.
+ */
+int PrepareSignerMlDsaKey(Signer* signer, void* heap)
+{
+    int ret = 0;
+    int level = 0;
+    word32 idx = 0;
+    dilithium_key* key = NULL;
+
+    if (signer == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    if (signer->mldsaKey != NULL) {
+        return 0;
+    }
+
+    if (signer->keyOID == ML_DSA_LEVEL2k) {
+        level = WC_ML_DSA_44;
+    }
+    else if (signer->keyOID == ML_DSA_LEVEL3k) {
+        level = WC_ML_DSA_65;
+    }
+    else if (signer->keyOID == ML_DSA_LEVEL5k) {
+        level = WC_ML_DSA_87;
+    }
+    else {
+        ret = NOT_COMPILED_IN;
+    }
+
+    if (ret == 0) {
+        key = (dilithium_key*)XMALLOC(sizeof(dilithium_key), heap,
+            DYNAMIC_TYPE_DILITHIUM);
+        if (key == NULL) {
+            ret = MEMORY_E;
+        }
+    }
+    if (ret == 0) {
+        ret = wc_dilithium_init_ex(key, heap, INVALID_DEVID);
+        if (ret != 0) {
+            XFREE(key, heap, DYNAMIC_TYPE_DILITHIUM);
+            key = NULL;
+        }
+    }
+    if (ret == 0) {
+        ret = wc_dilithium_set_level(key, (byte)level);
+    }
+    if (ret == 0) {
+        ret = wc_Dilithium_PublicKeyDecode(signer->publicKey, &idx, key,
+            signer->pubKeySize);
+    }
+
+    if (ret == 0) {
+        signer->mldsaKey = key;
+    }
+    else if (key != NULL) {
+        wc_dilithium_free(key);
+        XFREE(key, heap, DYNAMIC_TYPE_DILITHIUM);
+    }
+
+    return ret;
+}
+#endif /* WOLFSSL_MLDSA_CA_PRECOMPUTE */
+
 
 /* Free the whole singer table with number of rows.
  *
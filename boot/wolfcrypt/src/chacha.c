@@ -220,7 +220,8 @@ int wc_Chacha_SetKey(ChaCha* ctx, const byte* key, word32 keySz)
     return 0;
 }
 
-#if !defined(USE_INTEL_CHACHA_SPEEDUP) && !defined(USE_ARM_CHACHA_SPEEDUP)
+#if !defined(USE_INTEL_CHACHA_SPEEDUP) && !defined(USE_ARM_CHACHA_SPEEDUP) && \
+    !defined(USE_RISCV32_CHACHA_SPEEDUP)
 /**
   * Converts word into bytes with rotations having been done.
   */
@@ -267,7 +268,8 @@ extern void chacha_encrypt_avx2(ChaCha* ctx, const byte* m, byte* c,
 #endif
 
 
-#if !defined(USE_INTEL_CHACHA_SPEEDUP) && !defined(USE_ARM_CHACHA_SPEEDUP)
+#if !defined(USE_INTEL_CHACHA_SPEEDUP) && !defined(USE_ARM_CHACHA_SPEEDUP) && \
+    !defined(USE_RISCV32_CHACHA_SPEEDUP)
 /**
   * Encrypt a stream of bytes
   */
@@ -383,6 +385,24 @@ int wc_Chacha_Process(ChaCha* ctx, byte* output, const byte* input,
         wc_chacha_crypt_bytes(ctx, output, input, msglen);
     }
     return 0;
+#elif defined(USE_RISCV32_CHACHA_SPEEDUP)
+    /* Handle left over bytes from last block. */
+    if ((msglen > 0) && (ctx->left > 0)) {
+        byte* over = ((byte*)ctx->over) + CHACHA_CHUNK_BYTES - ctx->left;
+        word32 l = min(msglen, ctx->left);
+
+        xorbufout(output, input, over, l);
+
+        ctx->left -= l;
+        input += l;
+        output += l;
+        msglen -= l;
+    }
+
+    if (msglen != 0) {
+        wc_chacha_riscv32_crypt_bytes(ctx, output, input, msglen);
+    }
+    return 0;
 #else
     wc_Chacha_encrypt_bytes(ctx, input, output, msglen);
     return 0;
@@ -48,6 +48,12 @@
  *   Compiles in only the verification and public key operations.
  * WOLFSSL_DILITHIUM_VERIFY_SMALL_MEM                         Default: OFF
  *   Compiles verification implementation that uses smaller amounts of memory.
+ * WOLFSSL_DILITHIUM_VERIFY_FUSED                             Default: OFF
+ *   Compiles verification implementation that works one row of matrix A at a
+ *   time and hashes each row of encoded w1 as soon as it is made.
+ *   Uses less memory than WOLFSSL_DILITHIUM_VERIFY_SMALL_MEM, which it enables.
+ *   No slower than the default implementation. Reads matrix A and t1 from the
+ *   key instead when WC_DILITHIUM_CACHE_PUB_VECTORS has cached them.
  * WOLFSSL_DILITHIUM_VERIFY_NO_MALLOC                         Default: OFF
  *   Only works with WOLFSSL_DILITHIUM_VERIFY_SMALL_MEM.
  *   Don't allocate memory with XMALLOC. Memory is pinned against key.
@@ -92,9 +98,15 @@
  *   Enables WC_DILITHIUM_CACHE_MATRIX_A.
  *   Less work is required in sign operations.
  * WC_DILITHIUM_CACHE_PUB_VECTORS                             Default: OFF
- *   Enable caching of public key vectors on import.
+ *   Enable caching of public key vectors and the public key hash, tr, on
+ *   import.
  *   Enables WC_DILITHIUM_CACHE_MATRIX_A.
- *   Less work is required in sign operations.
+ *   Less work is required in verify operations.
+ * WC_DILITHIUM_NONBLOCK                                      Default: OFF
+ *   Enable verification in steps with wc_dilithium_set_nonblock().
+ *   Verify returns MP_WOULDBLOCK until the result is known. Each call performs
+ *   one step, or steps until the context's budget of cycles is spent when
+ *   WC_NONBLOCK_CYCLES() is defined to read a cycle counter.
  * WC_DILITHIUM_FIXED_ARRAY                                   Default: OFF
  *   Make the matrix and vectors of cached data fixed arrays that have
  *   maximumal sizes for the configured parameters.
@@ -5497,7 +5509,7 @@ static const sword32 zetas[DILITHIUM_N] = {
   -554416,  3919660,   -48306, -1362209,  3937738,  1400424,  -846154,  1976782
 };
 
-#ifndef WOLFSSL_DILITHIUM_SMALL
+#if !defined(WOLFSSL_DILITHIUM_SMALL) && !defined(USE_RISCV32_MLDSA_SPEEDUP)
 /* Zetas for inverse NTT. */
 static const sword32 zetas_inv[DILITHIUM_N] = {
  -1976782,   846154, -1400424, -3937738,  1362209,    48306, -3919660,   554416,
@@ -5558,6 +5570,9 @@ do {                                                                        \
 }                                                                           \
 while (0)
 
+#ifdef USE_RISCV32_MLDSA_SPEEDUP
+#define dilithium_ntt_c wc_mldsa_ntt_riscv32
+#else
 /* Number-Theoretic Transform.
  *
  * @param [in, out] r  Polynomial to transform.
@@ -5927,6 +5942,7 @@ static void dilithium_ntt_c(sword32* r)
     }
 #endif
 }
+#endif /* !USE_RISCV32_MLDSA_SPEEDUP */
 
 #if !defined(WOLFSSL_DILITHIUM_NO_SIGN) || \
      defined(WC_DILITHIUM_CACHE_PRIV_VECTORS)
@@ -6498,6 +6514,9 @@ do {                                                                        \
 }                                                                           \
 while (0)
 
+#ifdef USE_RISCV32_MLDSA_SPEEDUP
+#define dilithium_invntt_c wc_mldsa_invntt_riscv32
+#else
 /* Inverse Number-Theoretic Transform.
  *
  * @param [in, out] r  Polynomial to transform.
@@ -6895,6 +6914,7 @@ static void dilithium_invntt_c(sword32* r)
     }
 #endif
 }
+#endif /* !USE_RISCV32_MLDSA_SPEEDUP */
 
 #if !defined(WOLFSSL_DILITHIUM_NO_SIGN)
 /* Inverse Number-Theoretic Transform.
@@ -6934,6 +6954,22 @@ static void dilithium_invntt_full(sword32* r)
     }
 }
 
+#if defined(WOLFSSL_BENCH_KERNELS) && !defined(WOLFSSL_DILITHIUM_NO_VERIFY)
+/* Polynomial kernels exposed for timing by the benchmark firmware. */
+
+/* Forward NTT of one polynomial, see dilithium_ntt_full(). */
+void dilithium_bench_ntt(sword32* r)
+{
+    dilithium_ntt_full(r);
+}
+
+/* Inverse NTT of one polynomial, see dilithium_invntt_full(). */
+void dilithium_bench_invntt(sword32* r)
+{
+    dilithium_invntt_full(r);
+}
+#endif /* WOLFSSL_BENCH_KERNELS && !WOLFSSL_DILITHIUM_NO_VERIFY */
+
 #if !defined(WOLFSSL_DILITHIUM_NO_MAKE_KEY) || \
      defined(WOLFSSL_DILITHIUM_CHECK_KEY) || \
     (!defined(WOLFSSL_DILITHIUM_NO_VERIFY) && \
@@ -7740,6 +7776,7 @@ static int dilithium_make_key_from_seed(dilithium_key* key, const byte* seed)
 #ifdef WC_DILITHIUM_CACHE_PUB_VECTORS
         /* Public vector, t1, is not available as it was not created. */
         key->pubVecSet = 0;
+        key->trSet = 0;
 #endif
     }
 
@@ -9254,6 +9291,346 @@ static void dilithium_make_pub_vec(dilithium_key* key, sword32* t1)
 }
 #endif
 
+#ifdef WC_DILITHIUM_NONBLOCK
+/* Steps of a non-blocking verification. */
+enum {
+    DILITHIUM_NB_IDLE = 0,
+    DILITHIUM_NB_ROW,
+    DILITHIUM_NB_FINAL,
+    DILITHIUM_NB_DONE
+};
+
+/* Dispose of the in-progress verification of a non-blocking context.
+ *
+ * @param [in, out] nb  Non-blocking context.
+ */
+static void dilithium_nb_reset(dilithium_nb_ctx* nb)
+{
+    XFREE(nb->buf, nb->heap, DYNAMIC_TYPE_DILITHIUM);
+    nb->buf = NULL;
+    nb->state = DILITHIUM_NB_IDLE;
+}
+
+/* First step of verification: decode and check z, compute c and NTT both.
+ *
+ * @param [in, out] key     Dilithium key.
+ * @param [in, out] nb      Non-blocking context.
+ * @param [in]      sig     Signature to verify.
+ * @param [in]      sigLen  Length of signature in bytes.
+ * @return  0 on success.
+ * @return  SIG_VERIFY_E when hint is malformed.
+ * @return  BUFFER_E when the length of the signature does not match
+ *          parameters.
+ * @return  MEMORY_E when memory allocation fails.
+ */
+static int dilithium_verify_nb_init(dilithium_key* key, dilithium_nb_ctx* nb,
+    const byte* sig, word32 sigLen)
+{
+    int ret = 0;
+    const wc_dilithium_params* params = key->params;
+    const byte* ze = sig + params->lambda / 4;
+    const byte* h = ze + params->zEncSz;
+    sword32* z;
+    sword32* c;
+    byte* block;
+    sword32 hi;
+
+    /* Ensure the signature is the right size for the parameters. */
+    if (sigLen != params->sigSz) {
+        ret = BUFFER_E;
+    }
+    if (ret == 0) {
+        /* Step 13: Verify the hint is well-formed. */
+        ret = dilithium_check_hint(h, params->k, params->omega);
+    }
+    if (ret == 0) {
+        /* z, c, w, a, block. */
+        nb->heap = key->heap;
+        nb->buf = (sword32*)XMALLOC(params->s1Sz + params->s2Sz +
+            2 * DILITHIUM_POLY_SIZE + DILITHIUM_REJ_NTT_POLY_H_SIZE, nb->heap,
+            DYNAMIC_TYPE_DILITHIUM);
+        if (nb->buf == NULL) {
+            ret = MEMORY_E;
+        }
+    }
+    if (ret == 0) {
+        z = nb->buf;
+        c = z + params->s1Sz / sizeof(*z);
+        block = (byte*)(c + DILITHIUM_N + params->s2Sz / sizeof(*c) +
+            DILITHIUM_N);
+
+        /* Step 2: Decode z from signature. */
+        dilithium_vec_decode_gamma1(ze, params->l, params->gamma1_bits, z);
+        /* Step 13: Check z is valid - values are low enough. */
+        hi = (1 << params->gamma1_bits) - params->beta;
+        nb->valid = (byte)dilithium_vec_check_low(z, params->l, hi);
+        if (!nb->valid) {
+            nb->state = DILITHIUM_NB_DONE;
+        }
+    }
+    if ((ret == 0) && nb->valid) {
+        /* Step 10: NTT(z) */
+        dilithium_vec_ntt_full(z, params->l);
+        /* Step 9: Compute c from first 256 bits of commit. */
+        ret = dilithium_sample_in_ball_ex(params->level, &key->shake, sig,
+            params->lambda / 4, params->tau, c, block);
+    }
+    if ((ret == 0) && nb->valid) {
+        dilithium_ntt_small_full(c);
+
+        /* Copy the seed into a buffer that has space for s and r. */
+        XMEMCPY(nb->seed, key->p, DILITHIUM_PUB_SEED_SZ);
+        nb->r = 0;
+        nb->s = 0;
+        nb->state = DILITHIUM_NB_ROW;
+    }
+
+    return ret;
+}
+
+/* Step of verification: one polynomial of matrix A into a row of w.
+ *
+ * The first polynomial of a row starts it with - NTT(c) o NTT(t1) and the last
+ * converts it out of NTT form.
+ *
+ * @param [in, out] key  Dilithium key.
+ * @param [in, out] nb   Non-blocking context.
+ * @return  0 on success.
+ * @return  MEMORY_E when memory allocation fails.
+ */
+static int dilithium_verify_nb_row(dilithium_key* key, dilithium_nb_ctx* nb)
+{
+    int ret;
+    const wc_dilithium_params* params = key->params;
+    sword32* z = nb->buf;
+    sword32* c = z + params->s1Sz / sizeof(*z);
+    sword32* w = c + DILITHIUM_N + nb->r * DILITHIUM_N;
+    sword32* a = c + DILITHIUM_N + params->s2Sz / sizeof(*c);
+    byte* block = (byte*)(a + DILITHIUM_N);
+    const sword32* zt = z + nb->s * DILITHIUM_N;
+    unsigned int e;
+
+    if (nb->s == 0) {
+    #ifdef WC_DILITHIUM_CACHE_PUB_VECTORS
+        if (key->pubVecSet) {
+            /* Step 1: Polynomial of t1 cached in NTT form on import. */
+            XMEMCPY(w, key->t1 + nb->r * DILITHIUM_N, DILITHIUM_POLY_SIZE);
+        }
+        else
+    #endif
+        {
+            /* Step 1: Decode and NTT polynomial of t1. */
+            dilithium_decode_t1(key->p + DILITHIUM_PUB_SEED_SZ +
+                nb->r * (DILITHIUM_U * DILITHIUM_N / 8), w);
+            dilithium_ntt_full(w);
+        }
+        /* Step 10: - NTT(c) o NTT(t1)) */
+        for (e = 0; e < DILITHIUM_N; e++) {
+            w[e] = -dilithium_mont_red((sword64)c[e] * w[e]);
+        }
+    }
+
+#ifdef WC_DILITHIUM_CACHE_MATRIX_A
+    if (key->aSet) {
+        /* Step 5: Polynomial of matrix A cached on import. */
+        a = key->a + (nb->r * params->l + nb->s) * DILITHIUM_N;
+        ret = 0;
+    }
+    else
+#endif
+    {
+        /* Step 5: Expand pub seed to polynomial of matrix A. */
+        nb->seed[DILITHIUM_PUB_SEED_SZ + 0] = nb->s;
+        nb->seed[DILITHIUM_PUB_SEED_SZ + 1] = nb->r;
+        ret = dilithium_rej_ntt_poly_ex(&key->shake, nb->seed, a, block);
+    }
+    if (ret == 0) {
+        /* Step 10: w = A o NTT(z) - NTT(c) o NTT(t1) */
+        for (e = 0; e < DILITHIUM_N; e++) {
+            w[e] += dilithium_mont_red((sword64)a[e] * zt[e]);
+        }
+
+        if (++nb->s == params->l) {
+            /* Step 10: w = NTT-1(A o NTT(z) - NTT(c) o NTT(t1)) */
+            dilithium_invntt_full(w);
+            nb->s = 0;
+            if (++nb->r == params->k) {
+                nb->state = DILITHIUM_NB_FINAL;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/* Last step of verification: use hint, encode w1 and check the commitment.
+ *
+ * @param [in, out] key  Dilithium key.
+ * @param [in, out] nb   Non-blocking context.
+ * @param [in]      mu   Data to verify.
+ * @param [in]      sig  Signature to verify.
+ * @return  0 on success.
+ * @return  Negative on hash error.
+ */
+static int dilithium_verify_nb_final(dilithium_key* key, dilithium_nb_ctx* nb,
+    const byte* mu, const byte* sig)
+{
+    int ret;
+    const wc_dilithium_params* params = key->params;
+    const byte* h = sig + params->lambda / 4 + params->zEncSz;
+    sword32* c = nb->buf + params->s1Sz / sizeof(*nb->buf);
+    sword32* w = c + DILITHIUM_N;
+    /* c is no longer needed. */
+    byte* w1e = (byte*)c;
+    byte* encW1 = w1e;
+    byte commit_calc[DILITHIUM_TR_SZ];
+    unsigned int r;
+    byte o = 0;
+
+    for (r = 0; r < params->k; r++) {
+    #ifndef WOLFSSL_NO_ML_DSA_44
+        if (params->gamma2 == DILITHIUM_Q_LOW_88) {
+            /* Step 11: Use hint to give full w1. */
+            dilithium_use_hint_88(w, h, r, &o);
+            /* Step 12: Encode w1. */
+            dilithium_encode_w1_88(w, encW1);
+            encW1 += DILITHIUM_Q_HI_88_ENC_BITS * 2 * DILITHIUM_N / 16;
+        }
+        else
+    #endif
+    #if !defined(WOLFSSL_NO_ML_DSA_65) || !defined(WOLFSSL_NO_ML_DSA_87)
+        if (params->gamma2 == DILITHIUM_Q_LOW_32) {
+            /* Step 11: Use hint to give full w1. */
+            dilithium_use_hint_32(w, h, params->omega, r, &o);
+            /* Step 12: Encode w1. */
+            dilithium_encode_w1_32(w, encW1);
+            encW1 += DILITHIUM_Q_HI_32_ENC_BITS * 2 * DILITHIUM_N / 16;
+        }
+        else
+    #endif
+        {
+        }
+        w += DILITHIUM_N;
+    }
+
+    /* Step 12: Hash mu and encoded w1. */
+    ret = dilithium_hash256(&key->shake, mu, DILITHIUM_MU_SZ, w1e,
+        params->w1EncSz, commit_calc, params->lambda / 4);
+    if (ret == 0) {
+        /* Step 13: Compare commit. */
+        nb->valid = (XMEMCMP(sig, commit_calc, params->lambda / 4) == 0);
+        nb->state = DILITHIUM_NB_DONE;
+    }
+
+    return ret;
+}
+
+/* Verify signature of message using public key, one step at a time.
+ *
+ * A verification is identified by mu and a hash of the signature. Calling
+ * again with the same data continues the verification and, once it is done,
+ * returns the result. Calling with other data abandons the verification in
+ * progress.
+ *
+ * @param [in, out] key     Dilithium key.
+ * @param [in]      mu      Data to verify.
+ * @param [in]      sig     Signature to verify message.
+ * @param [in]      sigLen  Length of message in bytes.
+ * @param [out]     res     Result of verification.
+ * @return  0 on success.
+ * @return  MP_WOULDBLOCK when the verification is not finished.
+ * @return  SIG_VERIFY_E when hint is malformed.
+ * @return  BUFFER_E when the length of the signature does not match
+ *          parameters.
+ * @return  MEMORY_E when memory allocation fails.
+ * @return  Other negative when an error occurs.
+ */
+static int dilithium_verify_mu_nb(dilithium_key* key, const byte* mu,
+    const byte* sig, word32 sigLen, int* res)
+{
+    int ret;
+    dilithium_nb_ctx* nb = key->nb;
+    byte id[DILITHIUM_NB_ID_SZ];
+    int more;
+    int i;
+#ifdef WC_NONBLOCK_CYCLES
+    word64 start = WC_NONBLOCK_CYCLES();
+#endif
+
+    /* Identify verification by mu, which depends on the public key, and the
+     * signature. */
+    XMEMCPY(id, mu, DILITHIUM_MU_SZ);
+    ret = dilithium_shake256(&key->shake, sig, sigLen, id + DILITHIUM_MU_SZ,
+        DILITHIUM_NB_SIG_HASH_SZ);
+    if (ret != 0) {
+        return ret;
+    }
+
+    /* Finished on an earlier call. Results are kept until overwritten as a
+     * caller verifying a chain asks again for each certificate before the
+     * one still in progress every time it is called back. */
+    for (i = 0; i < WC_DILITHIUM_NB_DONE_CNT; i++) {
+        if (nb->done[i].set &&
+                (XMEMCMP(nb->done[i].id, id, DILITHIUM_NB_ID_SZ) == 0)) {
+            *res = nb->done[i].res;
+            return 0;
+        }
+    }
+    if ((nb->state != DILITHIUM_NB_IDLE) &&
+            (XMEMCMP(nb->id, id, DILITHIUM_NB_ID_SZ) != 0)) {
+        /* Other data - start again. */
+        dilithium_nb_reset(nb);
+    }
+    if (nb->state == DILITHIUM_NB_IDLE) {
+        XMEMCPY(nb->id, id, DILITHIUM_NB_ID_SZ);
+    }
+
+    do {
+        switch (nb->state) {
+            case DILITHIUM_NB_IDLE:
+                ret = dilithium_verify_nb_init(key, nb, sig, sigLen);
+                break;
+            case DILITHIUM_NB_ROW:
+                ret = dilithium_verify_nb_row(key, nb);
+                break;
+            case DILITHIUM_NB_FINAL:
+                ret = dilithium_verify_nb_final(key, nb, mu, sig);
+                break;
+            default:
+                ret = BAD_STATE_E;
+                break;
+        }
+        nb->steps++;
+    #ifdef WC_NONBLOCK_CYCLES
+        more = (nb->budget != 0) &&
+               ((word64)(WC_NONBLOCK_CYCLES() - start) < nb->budget);
+    #else
+        more = 0;
+    #endif
+    }
+    while ((ret == 0) && (nb->state != DILITHIUM_NB_DONE) && more);
+
+    if (ret != 0) {
+        dilithium_nb_reset(nb);
+    }
+    else if (nb->state != DILITHIUM_NB_DONE) {
+        nb->yields++;
+        ret = MP_WOULDBLOCK;
+    }
+    else {
+        /* Remember the result for when the caller asks again. */
+        XMEMCPY(nb->done[nb->doneIdx].id, id, DILITHIUM_NB_ID_SZ);
+        nb->done[nb->doneIdx].res = nb->valid;
+        nb->done[nb->doneIdx].set = 1;
+        nb->doneIdx = (byte)((nb->doneIdx + 1) % WC_DILITHIUM_NB_DONE_CNT);
+        *res = nb->valid;
+        dilithium_nb_reset(nb);
+    }
+
+    return ret;
+}
+#endif /* WC_DILITHIUM_NONBLOCK */
+
 /* Verify signature of message using public key.
  *
  * FIPS 204. 6: Algorithm 3 ML-DSA.Verify(pk, M, sigma)
@@ -9305,6 +9682,12 @@ static int dilithium_verify_mu(dilithium_key* key, const byte* mu,
     int valid = 0;
     sword32 hi;
 
+#ifdef WC_DILITHIUM_NONBLOCK
+    if (key->nb != NULL) {
+        return dilithium_verify_mu_nb(key, mu, sig, sigLen, res);
+    }
+#endif
+
     /* Ensure the signature is the right size for the parameters. */
     if (sigLen != params->sigSz) {
         ret = BUFFER_E;
@@ -9468,6 +9851,16 @@ static int dilithium_verify_mu(dilithium_key* key, const byte* mu,
     byte o;
     byte* encW1;
     byte* seed = commit_calc;
+#ifdef WOLFSSL_DILITHIUM_VERIFY_FUSED
+    wc_Shake shake256;
+    int shakeInit = 0;
+#endif
+
+#ifdef WC_DILITHIUM_NONBLOCK
+    if (key->nb != NULL) {
+        return dilithium_verify_mu_nb(key, mu, sig, sigLen, res);
+    }
+#endif
 
     /* Ensure the signature is the right size for the parameters. */
     if (sigLen != params->sigSz) {
@@ -9483,9 +9876,15 @@ static int dilithium_verify_mu(dilithium_key* key, const byte* mu,
     if (ret == 0) {
         /* z, c, w, t1, w1e. */
         unsigned int allocSz;
+    #ifndef WOLFSSL_DILITHIUM_VERIFY_FUSED
+        unsigned int w1eSz = params->w1EncSz;
+    #else
+        /* Only one row of w1 is encoded at a time. */
+        unsigned int w1eSz = params->w1EncSz / params->k;
+    #endif
 
         allocSz  = params->s1Sz + 3 * DILITHIUM_POLY_SIZE +
-            DILITHIUM_REJ_NTT_POLY_H_SIZE + params->w1EncSz;
+            DILITHIUM_REJ_NTT_POLY_H_SIZE + w1eSz;
     #ifdef WOLFSSL_DILITHIUM_SMALL_MEM_POLY64
         allocSz += DILITHIUM_POLY_SIZE * 2;
     #endif
@@ -9502,7 +9901,7 @@ static int dilithium_verify_mu(dilithium_key* key, const byte* mu,
             w1e   = block + DILITHIUM_REJ_NTT_POLY_H_SIZE;
             a     = t1;
         #ifdef WOLFSSL_DILITHIUM_SMALL_MEM_POLY64
-            t64   = (sword64*)(w1e + params->w1EncSz);
+            t64   = (sword64*)(w1e + w1eSz);
         #endif
         }
     }
@@ -9540,6 +9939,16 @@ static int dilithium_verify_mu(dilithium_key* key, const byte* mu,
              params->lambda / 4, params->tau, c, block);
 #endif
     }
+#ifdef WOLFSSL_DILITHIUM_VERIFY_FUSED
+    if ((ret == 0) && valid) {
+        /* Step 12: Hash mu now and each row of encoded w1 once it is made. */
+        ret = wc_InitShake256(&shake256, key->heap, INVALID_DEVID);
+        if (ret == 0) {
+            shakeInit = 1;
+            ret = wc_Shake256_Update(&shake256, mu, DILITHIUM_MU_SZ);
+        }
+    }
+#endif
     if ((ret == 0) && valid) {
         dilithium_ntt_small_full(c);
 
@@ -9554,13 +9963,22 @@ static int dilithium_verify_mu(dilithium_key* key, const byte* mu,
             unsigned int e;
             const sword32* zt = z;
 
-            /* Step 1: Decode and NTT vector t1. */
-            dilithium_decode_t1(t1p, w);
+        #ifdef WC_DILITHIUM_CACHE_PUB_VECTORS
+            if (key->pubVecSet) {
+                /* Step 1: Polynomial of t1 cached in NTT form on import. */
+                XMEMCPY(w, key->t1 + r * DILITHIUM_N, DILITHIUM_POLY_SIZE);
+            }
+            else
+        #endif
+            {
+                /* Step 1: Decode and NTT vector t1. */
+                dilithium_decode_t1(t1p, w);
+                dilithium_ntt_full(w);
+            }
             /* Next polynomial. */
             t1p += DILITHIUM_U * DILITHIUM_N / 8;
 
             /* Step 10: - NTT(c) o NTT(t1)) */
-            dilithium_ntt_full(w);
     #ifndef WOLFSSL_DILITHIUM_SMALL_MEM_POLY64
         #ifdef WOLFSSL_DILITHIUM_SMALL
             for (e = 0; e < DILITHIUM_N; e++) {
@@ -9603,12 +10021,23 @@ static int dilithium_verify_mu(dilithium_key* key, const byte* mu,
             for (s = 0; (ret == 0) && (s < params->l); s++) {
                 /* Put s into buffer to be hashed. */
                 seed[DILITHIUM_PUB_SEED_SZ + 0] = s;
-                /* Step 3: Create polynomial from hashing seed. */
-            #ifdef WOLFSSL_DILITHIUM_VERIFY_NO_MALLOC
-                ret = dilithium_rej_ntt_poly_ex(&key->shake, seed, a, key->h);
-            #else
-                ret = dilithium_rej_ntt_poly_ex(&key->shake, seed, a, block);
+            #ifdef WC_DILITHIUM_CACHE_MATRIX_A
+                if (key->aSet) {
+                    /* Step 3: Polynomial of matrix A cached on import. */
+                    a = key->a + (r * params->l + s) * DILITHIUM_N;
+                }
+                else
             #endif
+                {
+                    /* Step 3: Create polynomial from hashing seed. */
+                #ifdef WOLFSSL_DILITHIUM_VERIFY_NO_MALLOC
+                    ret = dilithium_rej_ntt_poly_ex(&key->shake, seed, a,
+                        key->h);
+                #else
+                    ret = dilithium_rej_ntt_poly_ex(&key->shake, seed, a,
+                        block);
+                #endif
+                }
 
                 /* Step 10: w = A o NTT(z) - NTT(c) o NTT(t1) */
         #ifndef WOLFSSL_DILITHIUM_SMALL_MEM_POLY64
@@ -9680,12 +10109,25 @@ static int dilithium_verify_mu(dilithium_key* key, const byte* mu,
         #endif
             {
             }
+        #ifdef WOLFSSL_DILITHIUM_VERIFY_FUSED
+            /* Step 12: Hash encoded row of w1 and reuse buffer for next. */
+            if (ret == 0) {
+                ret = wc_Shake256_Update(&shake256, w1e,
+                    (word32)(encW1 - w1e));
+            }
+            encW1 = w1e;
+        #endif
         }
     }
     if ((ret == 0) && valid) {
+    #ifndef WOLFSSL_DILITHIUM_VERIFY_FUSED
         /* Step 12: Hash mu and encoded w1. */
         ret = dilithium_hash256(&key->shake, mu, DILITHIUM_MU_SZ, w1e,
             params->w1EncSz, commit_calc, params->lambda / 4);
+    #else
+        /* Step 12: Finish hash of mu and encoded w1. */
+        ret = wc_Shake256_Final(&shake256, commit_calc, params->lambda / 4);
+    #endif
     }
     if ((ret == 0) && valid) {
         /* Step 13: Compare commit. */
@@ -9693,6 +10135,11 @@ static int dilithium_verify_mu(dilithium_key* key, const byte* mu,
     }
 
     *res = valid;
+#ifdef WOLFSSL_DILITHIUM_VERIFY_FUSED
+    if (shakeInit) {
+        wc_Shake256_Free(&shake256);
+    }
+#endif
 #ifndef WOLFSSL_DILITHIUM_VERIFY_NO_MALLOC
     XFREE(z, key->heap, DYNAMIC_TYPE_DILITHIUM);
 #endif
@@ -9729,6 +10176,13 @@ static int dilithium_verify_ctx_msg(dilithium_key* key, const byte* ctx,
         ret = BAD_FUNC_ARG;
     }
 
+#ifdef WC_DILITHIUM_CACHE_PUB_VECTORS
+    if ((ret == 0) && key->trSet) {
+        /* Step 6: Hash of public key cached on import. */
+        XMEMCPY(tr, key->tr, DILITHIUM_TR_SZ);
+    }
+    else
+#endif
     if (ret == 0) {
         /* Step 6: Hash public key. */
         ret = dilithium_shake256(&key->shake, key->p, key->params->pkSz, tr,
@@ -9772,6 +10226,13 @@ static int dilithium_verify_msg(dilithium_key* key, const byte* msg,
         ret = BAD_FUNC_ARG;
     }
 
+#ifdef WC_DILITHIUM_CACHE_PUB_VECTORS
+    if ((ret == 0) && key->trSet) {
+        /* Step 6: Hash of public key cached on import. */
+        XMEMCPY(tr, key->tr, DILITHIUM_TR_SZ);
+    }
+    else
+#endif
     if (ret == 0) {
         /* Step 6: Hash public key. */
         ret = dilithium_shake256(&key->shake, key->p, key->params->pkSz, tr,
@@ -10769,6 +11230,9 @@ int wc_dilithium_set_level(dilithium_key* key, byte level)
         key->pubVecSet = 0;
     #endif
 #endif
+    #ifdef WC_DILITHIUM_CACHE_PUB_VECTORS
+        key->trSet = 0;
+    #endif
 #endif /* WOLFSSL_WC_DILITHIUM */
 
         /* Store level and indicate public and private key are not set. */
@@ -10807,6 +11271,46 @@ int wc_dilithium_get_level(dilithium_key* key, byte* level)
     return ret;
 }
 
+#if defined(WOLFSSL_WC_DILITHIUM) && defined(WC_DILITHIUM_NONBLOCK) && \
+    !defined(WOLFSSL_DILITHIUM_NO_VERIFY)
+/* Set the non-blocking context to verify with.
+ *
+ * The context is owned by the caller and may be shared by keys that are
+ * verified one after the other. Passing NULL returns the key to blocking
+ * operation.
+ *
+ * key  [in]  Dilithium key.
+ * ctx  [in]  Non-blocking context. May be NULL.
+ * returns BAD_FUNC_ARG when key is NULL.
+ */
+int wc_dilithium_set_nonblock(dilithium_key* key, dilithium_nb_ctx* ctx)
+{
+    int ret = 0;
+
+    if (key == NULL) {
+        ret = BAD_FUNC_ARG;
+    }
+    else {
+        key->nb = ctx;
+    }
+
+    return ret;
+}
+
+/* Dispose of the dynamic memory of a non-blocking context.
+ *
+ * Any verification in progress is abandoned. Remembered results are kept.
+ *
+ * ctx  [in]  Non-blocking context.
+ */
+void wc_dilithium_free_nonblock(dilithium_nb_ctx* ctx)
+{
+    if (ctx != NULL) {
+        dilithium_nb_reset(ctx);
+    }
+}
+#endif
+
 /* Clears the dilithium key data
  *
  * key  [in]  Dilithium key.
@@ -11417,6 +11921,12 @@ int wc_dilithium_import_public(const byte* in, word32 inLen, dilithium_key* key)
     if (ret == 0) {
         /* Compute t1 from public key data. */
         dilithium_make_pub_vec(key, key->t1);
+        /* Compute tr, the hash of the public key, used when verifying. */
+        ret = dilithium_shake256(&key->shake, key->p, key->params->pkSz,
+            key->tr, DILITHIUM_TR_SZ);
+        key->trSet = (ret == 0);
+    }
+    if (ret == 0) {
 #endif
 #ifdef WC_DILITHIUM_CACHE_MATRIX_A
     #ifndef WC_DILITHIUM_FIXED_ARRAY
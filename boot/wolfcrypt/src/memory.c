@@ -344,6 +344,10 @@ void* wolfSSL_Malloc(size_t size)
     /* Space for requested size. */
     size += MEM_ALIGN;
 #endif
+#ifdef WOLFSSL_MEM_CALL_SITE
+    /* Tell a profiling allocator where XMALLOC was called from. */
+    WOLFSSL_MEM_CALL_SITE(__builtin_return_address(0));
+#endif
 
     if (malloc_function) {
     #ifdef WOLFSSL_DEBUG_MEMORY
@@ -494,6 +498,9 @@ void* wolfSSL_Realloc(void *ptr, size_t size)
         return NULL;
     }
 #endif
+#ifdef WOLFSSL_MEM_CALL_SITE
+    WOLFSSL_MEM_CALL_SITE(__builtin_return_address(0));
+#endif
 
     if (realloc_function) {
     #ifdef WOLFSSL_DEBUG_MEMORY
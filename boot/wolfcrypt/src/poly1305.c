@@ -292,6 +292,9 @@ static int poly1305_blocks(Poly1305* ctx, const unsigned char *m,
     poly1305_arm32_blocks_16(ctx, m, bytes, 1);
     return 0;
 #endif
+#elif defined(USE_RISCV32_POLY1305_SPEEDUP)
+    poly1305_blocks_riscv32(ctx, m, bytes);
+    return 0;
 #elif defined(POLY130564)
     const word64 hibit = (ctx->finished) ? 0 : ((word64)1 << 40); /* 1 << 128 */
     word64 r0,r1,r2;
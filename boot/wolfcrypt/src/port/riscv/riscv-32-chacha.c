@@ -0,0 +1,276 @@
+/* riscv-32-chacha.c
+ *
+ * Copyright (C) 2006-2025 wolfSSL Inc.
+ *
+ * This file is part of wolfSSL.
+ *
+ * wolfSSL is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * wolfSSL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
+ */
+
+#include <wolfssl/wolfcrypt/libwolfssl_sources.h>
+
+/* ChaCha20 block function for RV32I cores without vector or bit-manipulation
+ * extensions (VexRiscv). The 16 state words stay in registers for all 20
+ * rounds, the four quarter rounds of a column/diagonal step are interleaved
+ * and the key stream is XORed into the message on the way out.
+ * SetKey/SetIV are the generic ones in chacha.c.
+ */
+
+#ifdef HAVE_CHACHA
+
+#include <wolfssl/wolfcrypt/chacha.h>
+
+#ifdef USE_RISCV32_CHACHA_SPEEDUP
+
+#ifdef NO_INLINE
+    #include <wolfssl/wolfcrypt/misc.h>
+#else
+    #define WOLFSSL_MISC_INCLUDED
+    #include <wolfcrypt/src/misc.c>
+#endif
+
+/* State word to register assignment. */
+#define CC_X0   "s1"
+#define CC_X1   "s2"
+#define CC_X2   "s3"
+#define CC_X3   "s4"
+#define CC_X4   "s5"
+#define CC_X5   "s6"
+#define CC_X6   "s7"
+#define CC_X7   "s8"
+#define CC_X8   "s9"
+#define CC_X9   "s10"
+#define CC_X10  "s11"
+#define CC_X11  "t6"
+#define CC_X12  "a4"
+#define CC_X13  "a5"
+#define CC_X14  "a6"
+#define CC_X15  "a7"
+
+/* Four interleaved: a += b; d ^= a; d <<<= sl; */
+#define ARX4(a0, b0, d0, a1, b1, d1, a2, b2, d2, a3, b3, d3, sl, sr) \
+        "add    " a0 ", " a0 ", " b0 "\n\t"                         \
+        "add    " a1 ", " a1 ", " b1 "\n\t"                         \
+        "add    " a2 ", " a2 ", " b2 "\n\t"                         \
+        "add    " a3 ", " a3 ", " b3 "\n\t"                         \
+        "xor    " d0 ", " d0 ", " a0 "\n\t"                         \
+        "xor    " d1 ", " d1 ", " a1 "\n\t"                         \
+        "xor    " d2 ", " d2 ", " a2 "\n\t"                         \
+        "xor    " d3 ", " d3 ", " a3 "\n\t"                         \
+        "slli   t0, " d0 ", " #sl "\n\t"                            \
+        "slli   t1, " d1 ", " #sl "\n\t"                            \
+        "slli   t2, " d2 ", " #sl "\n\t"                            \
+        "slli   t3, " d3 ", " #sl "\n\t"                            \
+        "srli   " d0 ", " d0 ", " #sr "\n\t"                        \
+        "srli   " d1 ", " d1 ", " #sr "\n\t"                        \
+        "srli   " d2 ", " d2 ", " #sr "\n\t"                        \
+        "srli   " d3 ", " d3 ", " #sr "\n\t"                        \
+        "or     " d0 ", " d0 ", t0\n\t"                             \
+        "or     " d1 ", " d1 ", t1\n\t"                             \
+        "or     " d2 ", " d2 ", t2\n\t"                             \
+        "or     " d3 ", " d3 ", t3\n\t"
+
+#define QUARTER_ROUND_ODD()                                                 \
+        /* a += b; d ^= a; d <<<= 16; */                                    \
+        ARX4(CC_X0,  CC_X4,  CC_X12, CC_X1,  CC_X5,  CC_X13,                \
+             CC_X2,  CC_X6,  CC_X14, CC_X3,  CC_X7,  CC_X15, 16, 16)        \
+        /* c += d; b ^= c; b <<<= 12; */                                    \
+        ARX4(CC_X8,  CC_X12, CC_X4,  CC_X9,  CC_X13, CC_X5,                 \
+             CC_X10, CC_X14, CC_X6,  CC_X11, CC_X15, CC_X7,  12, 20)        \
+        /* a += b; d ^= a; d <<<= 8; */                                     \
+        ARX4(CC_X0,  CC_X4,  CC_X12, CC_X1,  CC_X5,  CC_X13,                \
+             CC_X2,  CC_X6,  CC_X14, CC_X3,  CC_X7,  CC_X15,  8, 24)        \
+        /* c += d; b ^= c; b <<<= 7; */                                     \
+        ARX4(CC_X8,  CC_X12, CC_X4,  CC_X9,  CC_X13, CC_X5,                 \
+             CC_X10, CC_X14, CC_X6,  CC_X11, CC_X15, CC_X7,   7, 25)
+
+#define QUARTER_ROUND_EVEN()                                                \
+        /* a += b; d ^= a; d <<<= 16; */                                    \
+        ARX4(CC_X0,  CC_X5,  CC_X15, CC_X1,  CC_X6,  CC_X12,                \
+             CC_X2,  CC_X7,  CC_X13, CC_X3,  CC_X4,  CC_X14, 16, 16)        \
+        /* c += d; b ^= c; b <<<= 12; */                                    \
+        ARX4(CC_X10, CC_X15, CC_X5,  CC_X11, CC_X12, CC_X6,                 \
+             CC_X8,  CC_X13, CC_X7,  CC_X9,  CC_X14, CC_X4,  12, 20)        \
+        /* a += b; d ^= a; d <<<= 8; */                                     \
+        ARX4(CC_X0,  CC_X5,  CC_X15, CC_X1,  CC_X6,  CC_X12,                \
+             CC_X2,  CC_X7,  CC_X13, CC_X3,  CC_X4,  CC_X14,  8, 24)        \
+        /* c += d; b ^= c; b <<<= 7; */                                     \
+        ARX4(CC_X10, CC_X15, CC_X5,  CC_X11, CC_X12, CC_X6,                 \
+             CC_X8,  CC_X13, CC_X7,  CC_X9,  CC_X14, CC_X4,   7, 25)
+
+/* x[i..i+3] += input[i..i+3] */
+#define ADD_INPUT4(o0, x0, o1, x1, o2, x2, o3, x3)                          \
+        "lw     t0, " #o0 "(a0)\n\t"                                        \
+        "lw     t1, " #o1 "(a0)\n\t"                                        \
+        "lw     t2, " #o2 "(a0)\n\t"                                        \
+        "lw     t3, " #o3 "(a0)\n\t"                                        \
+        "add    " x0 ", " x0 ", t0\n\t"                                     \
+        "add    " x1 ", " x1 ", t1\n\t"                                     \
+        "add    " x2 ", " x2 ", t2\n\t"                                     \
+        "add    " x3 ", " x3 ", t3\n\t"
+
+/* c[i..i+3] = m[i..i+3] ^ x[i..i+3] - word aligned m and c */
+#define XOR_WORD4(o0, x0, o1, x1, o2, x2, o3, x3)                           \
+        "lw     t0, " #o0 "(a1)\n\t"                                        \
+        "lw     t1, " #o1 "(a1)\n\t"                                        \
+        "lw     t2, " #o2 "(a1)\n\t"                                        \
+        "lw     t3, " #o3 "(a1)\n\t"                                        \
+        "xor    " x0 ", " x0 ", t0\n\t"                                     \
+        "xor    " x1 ", " x1 ", t1\n\t"                                     \
+        "xor    " x2 ", " x2 ", t2\n\t"                                     \
+        "xor    " x3 ", " x3 ", t3\n\t"                                     \
+        "sw     " x0 ", " #o0 "(a2)\n\t"                                    \
+        "sw     " x1 ", " #o1 "(a2)\n\t"                                    \
+        "sw     " x2 ", " #o2 "(a2)\n\t"                                    \
+        "sw     " x3 ", " #o3 "(a2)\n\t"
+
+/* c[i] = m[i] ^ x[i] - byte accesses as the core traps on misaligned words */
+#define XOR_BYTES(x, o0, o1, o2, o3)                                        \
+        "lbu    t0, " #o0 "(a1)\n\t"                                        \
+        "lbu    t1, " #o1 "(a1)\n\t"                                        \
+        "lbu    t2, " #o2 "(a1)\n\t"                                        \
+        "lbu    t3, " #o3 "(a1)\n\t"                                        \
+        "slli   t1, t1, 8\n\t"                                              \
+        "slli   t2, t2, 16\n\t"                                             \
+        "slli   t3, t3, 24\n\t"                                             \
+        "or     t0, t0, t1\n\t"                                             \
+        "or     t2, t2, t3\n\t"                                             \
+        "or     t0, t0, t2\n\t"                                             \
+        "xor    " x ", " x ", t0\n\t"                                       \
+        "srli   t1, " x ", 8\n\t"                                           \
+        "srli   t2, " x ", 16\n\t"                                          \
+        "srli   t3, " x ", 24\n\t"                                          \
+        "sb     " x ", " #o0 "(a2)\n\t"                                     \
+        "sb     t1, " #o1 "(a2)\n\t"                                        \
+        "sb     t2, " #o2 "(a2)\n\t"                                        \
+        "sb     t3, " #o3 "(a2)\n\t"
+
+/**
+ * Encrypt whole blocks: c = m ^ ChaCha20(x), x's block counter is advanced by
+ * the number of blocks.
+ */
+static void wc_chacha_riscv32_blocks(word32* x, const byte* m, byte* c,
+    word32 blocks)
+{
+    register word32*     x_p      __asm__ ("a0") = x;
+    register const byte* m_p      __asm__ ("a1") = m;
+    register byte*       c_p      __asm__ ("a2") = c;
+    register word32      blocks_p __asm__ ("a3") = blocks;
+
+    __asm__ __volatile__ (
+        "beqz   a3, 4f\n\t"
+        /* Both pointers word aligned: t5 = 0 */
+        "or     t5, a1, a2\n\t"
+        "andi   t5, t5, 3\n\t"
+    "1:\n\t"
+        /* Move state into registers */
+        "lw     " CC_X0  ",  0(a0)\n\t"
+        "lw     " CC_X1  ",  4(a0)\n\t"
+        "lw     " CC_X2  ",  8(a0)\n\t"
+        "lw     " CC_X3  ", 12(a0)\n\t"
+        "lw     " CC_X4  ", 16(a0)\n\t"
+        "lw     " CC_X5  ", 20(a0)\n\t"
+        "lw     " CC_X6  ", 24(a0)\n\t"
+        "lw     " CC_X7  ", 28(a0)\n\t"
+        "lw     " CC_X8  ", 32(a0)\n\t"
+        "lw     " CC_X9  ", 36(a0)\n\t"
+        "lw     " CC_X10 ", 40(a0)\n\t"
+        "lw     " CC_X11 ", 44(a0)\n\t"
+        "lw     " CC_X12 ", 48(a0)\n\t"
+        "lw     " CC_X13 ", 52(a0)\n\t"
+        "lw     " CC_X14 ", 56(a0)\n\t"
+        "lw     " CC_X15 ", 60(a0)\n\t"
+
+        /* Set number of odd+even rounds to perform */
+        "li     t4, 10\n\t"
+    "2:\n\t"
+        /* Odd Round */
+        QUARTER_ROUND_ODD()
+        "addi   t4, t4, -1\n\t"
+        /* Even Round */
+        QUARTER_ROUND_EVEN()
+        "bnez   t4, 2b\n\t"
+
+        ADD_INPUT4( 0, CC_X0,   4, CC_X1,   8, CC_X2,  12, CC_X3)
+        ADD_INPUT4(16, CC_X4,  20, CC_X5,  24, CC_X6,  28, CC_X7)
+        ADD_INPUT4(32, CC_X8,  36, CC_X9,  40, CC_X10, 44, CC_X11)
+        ADD_INPUT4(48, CC_X12, 52, CC_X13, 56, CC_X14, 60, CC_X15)
+        /* Next block counter */
+        "addi   t0, t0, 1\n\t"
+        "sw     t0, 48(a0)\n\t"
+
+        "bnez   t5, 3f\n\t"
+        XOR_WORD4( 0, CC_X0,   4, CC_X1,   8, CC_X2,  12, CC_X3)
+        XOR_WORD4(16, CC_X4,  20, CC_X5,  24, CC_X6,  28, CC_X7)
+        XOR_WORD4(32, CC_X8,  36, CC_X9,  40, CC_X10, 44, CC_X11)
+        XOR_WORD4(48, CC_X12, 52, CC_X13, 56, CC_X14, 60, CC_X15)
+        "j      5f\n\t"
+    "3:\n\t"
+        XOR_BYTES(CC_X0,   0,  1,  2,  3)
+        XOR_BYTES(CC_X1,   4,  5,  6,  7)
+        XOR_BYTES(CC_X2,   8,  9, 10, 11)
+        XOR_BYTES(CC_X3,  12, 13, 14, 15)
+        XOR_BYTES(CC_X4,  16, 17, 18, 19)
+        XOR_BYTES(CC_X5,  20, 21, 22, 23)
+        XOR_BYTES(CC_X6,  24, 25, 26, 27)
+        XOR_BYTES(CC_X7,  28, 29, 30, 31)
+        XOR_BYTES(CC_X8,  32, 33, 34, 35)
+        XOR_BYTES(CC_X9,  36, 37, 38, 39)
+        XOR_BYTES(CC_X10, 40, 41, 42, 43)
+        XOR_BYTES(CC_X11, 44, 45, 46, 47)
+        XOR_BYTES(CC_X12, 48, 49, 50, 51)
+        XOR_BYTES(CC_X13, 52, 53, 54, 55)
+        XOR_BYTES(CC_X14, 56, 57, 58, 59)
+        XOR_BYTES(CC_X15, 60, 61, 62, 63)
+    "5:\n\t"
+        "addi   a1, a1, 64\n\t"
+        "addi   a2, a2, 64\n\t"
+        "addi   a3, a3, -1\n\t"
+        "bnez   a3, 1b\n\t"
+    "4:\n\t"
+        : [m] "+r" (m_p), [c] "+r" (c_p), [blocks] "+r" (blocks_p)
+        : [x] "r" (x_p)
+        : "memory", "t0", "t1", "t2", "t3", "t4", "t5", "t6",
+          "s1", "s2", "s3", "s4", "s5", "s6", "s7", "s8", "s9", "s10", "s11",
+          "a4", "a5", "a6", "a7"
+    );
+}
+
+/**
+ * Encrypt a stream of bytes. The key stream of a trailing partial block is
+ * kept in over for the next call.
+ */
+void wc_chacha_riscv32_crypt_bytes(ChaCha* ctx, byte* c, const byte* m,
+    word32 len)
+{
+    word32 blocks = len / CHACHA_CHUNK_BYTES;
+
+    if (blocks > 0) {
+        wc_chacha_riscv32_blocks(ctx->X, m, c, blocks);
+        len -= blocks * CHACHA_CHUNK_BYTES;
+        m += blocks * CHACHA_CHUNK_BYTES;
+        c += blocks * CHACHA_CHUNK_BYTES;
+    }
+    if (len > 0) {
+        XMEMSET(ctx->over, 0, CHACHA_CHUNK_BYTES);
+        wc_chacha_riscv32_blocks(ctx->X, (byte*)ctx->over, (byte*)ctx->over,
+            1);
+        xorbufout(c, m, ctx->over, len);
+        ctx->left = CHACHA_CHUNK_BYTES - len;
+    }
+}
+
+#endif /* USE_RISCV32_CHACHA_SPEEDUP */
+#endif /* HAVE_CHACHA */
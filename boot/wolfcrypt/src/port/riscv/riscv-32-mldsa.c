@@ -0,0 +1,596 @@
+/* riscv-32-mldsa.c
+ *
+ * Copyright (C) 2006-2025 wolfSSL Inc.
+ *
+ * This file is part of wolfSSL.
+ *
+ * wolfSSL is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * wolfSSL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
+ */
+
+#include <wolfssl/wolfcrypt/libwolfssl_sources.h>
+
+/* ML-DSA NTT and inverse NTT for RV32IM. Results are identical to
+ * dilithium_ntt_c() and dilithium_invntt_c() in dilithium.c.
+ *
+ * The layers are merged the same way as the unrolled C code: (128, 64),
+ * (32, 16, 8), (4, 2, 1) forward and (1, 2, 4), (8, 16, 32), (64, 128)
+ * inverse. The twiddles of all but the last layer of a pass stay in registers
+ * for the whole loop over the coefficients they apply to.
+ *
+ * A twiddle z is stored as the pair (z, z * q^-1 mod 2^32) so that the
+ * Montgomery product of dilithium_mont_red() is four instructions:
+ *   t = mulh(a, z) - mulh(a * zq, q)
+ */
+
+#if defined(HAVE_DILITHIUM) && defined(WOLFSSL_WC_DILITHIUM)
+
+#include <wolfssl/wolfcrypt/dilithium.h>
+
+#ifdef USE_RISCV32_MLDSA_SPEEDUP
+
+/* Coefficient register assignment. */
+#define CC_R0   "t1"
+#define CC_R1   "t2"
+#define CC_R2   "t3"
+#define CC_R3   "t4"
+#define CC_R4   "t5"
+#define CC_R5   "t6"
+#define CC_R6   "a5"
+#define CC_R7   "a6"
+/* q */
+#define CC_Q    "a4"
+
+/* Butterfly: t = b * z; b = a - t; a = a + t; */
+#define MONT_BFLY(a, b, zw, zq)                                             \
+        "mulh   t0, " b ", " zw "\n\t"                                      \
+        "mul    " b ", " b ", " zq "\n\t"                                   \
+        "mulh   " b ", " b ", " CC_Q "\n\t"                                 \
+        "sub    t0, t0, " b "\n\t"                                          \
+        "sub    " b ", " a ", t0\n\t"                                       \
+        "add    " a ", " a ", t0\n\t"
+
+/* Inverse butterfly: t = a - b; a = a + b; b = t * z; */
+#define MONT_INV_BFLY(a, b, zw, zq)                                         \
+        "sub    t0, " a ", " b "\n\t"                                       \
+        "add    " a ", " a ", " b "\n\t"                                    \
+        "mulh   " b ", t0, " zw "\n\t"                                      \
+        "mul    t0, t0, " zq "\n\t"                                         \
+        "mulh   t0, t0, " CC_Q "\n\t"                                       \
+        "sub    " b ", " b ", t0\n\t"
+
+/* a = a * z */
+#define MONT_MUL(a, zw, zq)                                                 \
+        "mulh   t0, " a ", " zw "\n\t"                                      \
+        "mul    " a ", " a ", " zq "\n\t"                                   \
+        "mulh   " a ", " a ", " CC_Q "\n\t"                                 \
+        "sub    " a ", t0, " a "\n\t"
+
+/* Load/store eight coefficients at byte offsets from a2. */
+#define LOAD8(o0, o1, o2, o3, o4, o5, o6, o7)                               \
+        "lw     " CC_R0 ", " #o0 "(a2)\n\t"                                 \
+        "lw     " CC_R1 ", " #o1 "(a2)\n\t"                                 \
+        "lw     " CC_R2 ", " #o2 "(a2)\n\t"                                 \
+        "lw     " CC_R3 ", " #o3 "(a2)\n\t"                                 \
+        "lw     " CC_R4 ", " #o4 "(a2)\n\t"                                 \
+        "lw     " CC_R5 ", " #o5 "(a2)\n\t"                                 \
+        "lw     " CC_R6 ", " #o6 "(a2)\n\t"                                 \
+        "lw     " CC_R7 ", " #o7 "(a2)\n\t"
+#define STORE8(o0, o1, o2, o3, o4, o5, o6, o7)                              \
+        "sw     " CC_R0 ", " #o0 "(a2)\n\t"                                 \
+        "sw     " CC_R1 ", " #o1 "(a2)\n\t"                                 \
+        "sw     " CC_R2 ", " #o2 "(a2)\n\t"                                 \
+        "sw     " CC_R3 ", " #o3 "(a2)\n\t"                                 \
+        "sw     " CC_R4 ", " #o4 "(a2)\n\t"                                 \
+        "sw     " CC_R5 ", " #o5 "(a2)\n\t"                                 \
+        "sw     " CC_R6 ", " #o6 "(a2)\n\t"                                 \
+        "sw     " CC_R7 ", " #o7 "(a2)\n\t"
+
+/* Load twiddle pairs 0-2 of a table entry into s1-s6. */
+#define LOAD_ZETAS3(t)                                                      \
+        "lw     s1,  0(" t ")\n\t"                                          \
+        "lw     s2,  4(" t ")\n\t"                                          \
+        "lw     s3,  8(" t ")\n\t"                                          \
+        "lw     s4, 12(" t ")\n\t"                                          \
+        "lw     s5, 16(" t ")\n\t"                                          \
+        "lw     s6, 20(" t ")\n\t"
+
+/* Load twiddle pair at byte offset o of a table entry into s7/s8. */
+#define LOAD_ZETA(t, o)                                                     \
+        "lw     s7, " #o "(" t ")\n\t"                                      \
+        "lw     s8, " #o "+4(" t ")\n\t"
+
+/* Twiddle pairs of the forward NTT in the order they are used:
+ *   len 128, 64:     zetas[1..3]
+ *   len 32, 16, 8:   per 64 coefficients zetas[4 + b], zetas[8 + 2b + i],
+ *                    zetas[16 + 4b + i]
+ *   len 4, 2, 1:     per 8 coefficients zetas[32 + g], zetas[64 + 2g + i],
+ *                    zetas[128 + 4g + i]
+ * Each pair is (z, z * DILITHIUM_QINV mod 2^32).
+ */
+static const word32 mldsa_riscv32_ntt_zetas[510] = {
+    0x000064f7, 0x6d1f44f7, 0xffd83102, 0x8cf87102,
+    0xfff81503, 0x8d187503, 0x00039e44, 0x61cc1e44,
+    0x001bde2b, 0x12613e2b, 0x0023e92b, 0x93c9492b,
+    0x00299658, 0x66f49658, 0x000fa070, 0x7c1da070,
+    0xffef85a4, 0xaea405a4, 0x0036b788, 0x3327b788,
+    0xfff42118, 0x58172118, 0xfffa84ad, 0xae1024ad,
+    0xffe0147f, 0xbeeff47f, 0xfff79d90, 0x6ba99d90,
+    0xffeeeaa0, 0x0d42eaa0, 0x0027f968, 0xeb54f968,
+    0xffdfd37b, 0x28cf337b, 0xfff2a128, 0x6017a128,
+    0x002f9a75, 0x8cfe3a75, 0xffd3fb09, 0x1eb51b09,
+    0xffdfadd6, 0x629a6dd6, 0xffc51ae7, 0xcba1fae7,
+    0xffeaa4f7, 0xb50984f7, 0xffcdfc98, 0xd360fc98,
+    0x00071e24, 0x61cb9e24, 0x002f7a49, 0xeef89a49,
+    0x0028e527, 0x254dc527, 0x001ad035, 0x13a17035,
+    0xffffb422, 0x6d83f422, 0x003d3201, 0xa9fd5201,
+    0x000445c5, 0xba3ce5c5, 0x00294a67, 0x91f62a67,
+    0xffc406e5, 0xa220a6e5, 0xffe8ac81, 0xd8f8cc81,
+    0x001fea93, 0xfff24a93, 0x0033ff5a, 0x3b1f3f5a,
+    0x002358d4, 0x513dd8d4, 0x003a41f8, 0x2c7941f8,
+    0x00017620, 0x9ec57620, 0xffc7e1cf, 0x5081c1cf,
+    0xffd19819, 0x8a54b819, 0xffccff72, 0xaebb3f72,
+    0x00223dfb, 0x36619dfb, 0xffdaab9f, 0x01ce8b9f,
+    0xffc9a422, 0xab4de422, 0x002ef4cd, 0xac4894cd,
+    0xffe9d65d, 0x8035765d, 0x003509ee, 0x6272c9ee,
+    0x000412f5, 0xdbe2b2f5, 0x00252587, 0xfd560587,
+    0xffed24f0, 0xec8b24f0, 0x00359b5d, 0x79213b5d,
+    0x0035dec5, 0x6d8e7ec5, 0x002135c7, 0x5f5a15c7,
+    0xffe7cfbb, 0x085f2fbb, 0xffca48a0, 0x78de48a0,
+    0xffc6a2fc, 0x462622fc, 0xffedbb56, 0x64587b56,
+    0xffcf45de, 0x718b05de, 0xffe6a503, 0x5f070503,
+    0xffeccf75, 0xb35b6f75, 0x001d9772, 0xc20bd772,
+    0x000dbe5e, 0x00d97e5e, 0x001c5e1a, 0xe6df9e1a,
+    0x000de0e6, 0xe12aa0e6, 0x000c7f5a, 0x4af7bf5a,
+    0xffc9302c, 0xbfceb02c, 0xffc1b072, 0xc4cff072,
+    0xfff0bcf6, 0x748f7cf6, 0x00078f83, 0x3c77ef83,
+    0xffe7628a, 0xcf38a28a, 0xffff5704, 0x78dfd704,
+    0xfff806fc, 0x72d786fc, 0xffd947d4, 0x8ed3c7d4,
+    0xffcf5280, 0xaa1f5280, 0xffcfd2ae, 0x5b2592ae,
+    0xfff60021, 0x337a2021, 0xffd05af6, 0x682f1af6,
+    0x001f0084, 0xae2f8084, 0x0030ef86, 0x7321af86,
+    0x003bbeaf, 0xdc919eaf, 0xffc890e0, 0x21e490e0,
+    0x0001efca, 0x80fb2fca, 0xffc9b97d, 0x6c79597d,
+    0xfff7fcd6, 0xec92bcd6, 0xfff44592, 0x07a68592,
+    0xffc921c2, 0x4b0161c2, 0xffc51585, 0xf3f5b585,
+    0x003410f2, 0xd15250f2, 0xfff0fe85, 0xf1419e85,
+    0x00053919, 0x7ea85919, 0x0004610c, 0x3625e10c,
+    0xffdacd41, 0xbd02ed41, 0x003eb01b, 0x34c2101b,
+    0xffd18e7c, 0xe3a10e7c, 0x0020c638, 0xdce7c638,
+    0x00296e9f, 0x5a7d4e9f, 0x003472e7, 0xb71152e7,
+    0xffcd003b, 0x6e54603b, 0x001a7cc7, 0x08335cc7,
+    0x00031924, 0x61279924, 0x00368a96, 0xde894a96,
+    0xffd2b7a3, 0x114717a3, 0xffc7a44b, 0xfad1044b,
+    0x002b5ee5, 0x8d87fee5, 0x00291199, 0xb9dc3199,
+    0xffd87a3a, 0xda1fba3a, 0x00134d71, 0x75416d71,
+    0xffd43e41, 0x6b1c5e41, 0xfff9ba6d, 0xb4c75a6d,
+    0xffda3409, 0x65db5409, 0x003de11c, 0x9e61611c,
+    0x00130984, 0xaf438984, 0x0025f051, 0xd9b01051,
+    0x00185a46, 0x00611a46, 0x00360400, 0xc0b60400,
+    0xfff5c282, 0x7f460282, 0xffed4113, 0x6a8fa113,
+    0xffc68518, 0xa4698518, 0x001314be, 0xfbaad4be,
+    0x00283891, 0x02ba5891, 0xffc9db90, 0xb33bdb90,
+    0xfffb6a4d, 0x7ac50a4d, 0xffffa63b, 0xc347063b,
+    0xffec09f7, 0x61aae9f7, 0xffd25089, 0x29637089,
+    0x001c853f, 0xed44653f, 0x001d0b4b, 0x28066b4b,
+    0xffeff6a6, 0x43c4b6a6, 0x0023d69c, 0x9cf7569c,
+    0xfffa2bdd, 0xcaf5cbdd, 0x001495d4, 0xf8cf15d4,
+    0xffeba8be, 0x0e0368be, 0x0012e11b, 0x3ab6411b,
+    0xffcd5e3e, 0x84951e3e, 0xffea2d2f, 0x6a100d2f,
+    0xfff7c55d, 0xbe23655d, 0x001c4563, 0x6348a563,
+    0xffea2c62, 0x9c766c62, 0xfff91de4, 0xc1b59de4,
+    0x001406c7, 0x396ce6c7, 0x00327283, 0x1902d283,
+    0xffe20d6e, 0x428fcd6e, 0xffe6123d, 0x97adb23d,
+    0xffccfbe9, 0x4eca1be9, 0x00040af0, 0xc9620af0,
+    0xffec7953, 0x3196d953, 0x001d4099, 0xbfb06099,
+    0xffd92578, 0x48882578, 0xffeb05ad, 0x3e20a5ad,
+    0xffe6ead6, 0xca41aad6, 0x0007c417, 0x490aa417,
+    0x002f4588, 0x44e04588, 0x0016e405, 0xee178405,
+    0x000bdbe7, 0x2408bbe7, 0x00221de8, 0xefdf1de8,
+    0x0033f8cf, 0x53cdd8cf, 0x00357e1e, 0x18f93e1e,
+    0x0000ad00, 0x95a0ad00, 0xffef36be, 0x7fc6f6be,
+    0xfff7b934, 0x2d1e3934, 0xffd4ca0c, 0xc3164a0c,
+    0xffe67ff8, 0xb3e57ff8, 0xffe3d157, 0x2a8eb157,
+    0xffc5af59, 0x6d30cf59, 0x000dcd44, 0x27b64d44,
+    0x003c675a, 0x4827a75a, 0xffd8911b, 0xf07bf11b,
+    0xffc72c12, 0x24496c12, 0x000910d8, 0x162410d8,
+    0xffc65e1f, 0x380a3e1f, 0x0035843f, 0x8d3d643f,
+    0xffc72bca, 0x28406bca, 0xffffde7e, 0xb4cf9e7e,
+    0xffe14658, 0x5cac4658, 0x00251d8b, 0x0a567d8b,
+    0x002573b7, 0xaf1c53b7, 0xfffd7c8f, 0xa40f5c8f,
+    0xffdf5617, 0x3b223617, 0x00193948, 0xa3423948,
+    0xffce69c0, 0xed0669c0, 0x001ddd98, 0x4fd0dd98,
+    0x00336898, 0x81466898, 0x0002d4bb, 0xe91a34bb,
+    0xffed93a7, 0x7ae273a7, 0xffe7945c, 0x3473145c,
+    0x0024756c, 0x88d1f56c, 0xfffcc7df, 0x2578a7df,
+    0xffcf6cbe, 0x86672cbe, 0x00027c1c, 0xb185fc1c,
+    0x0018aa08, 0x3159aa08, 0x002dfd71, 0xcb5c1d71,
+    0x0038738c, 0x78a9f38c, 0x000b98a1, 0xa69fb8a1,
+    0xffebe808, 0x98ece808, 0x000c5ca5, 0xcd20fca5,
+    0x0019379a, 0xc20c779a, 0xffc7a167, 0xdc748167,
+    0xffe48c3d, 0x66ec2c3d, 0x000c63a8, 0x588163a8,
+    0x0002e46c, 0xd690646c, 0xffc9c808, 0x54cac808,
+    0xffd1a13c, 0x85f9213c, 0x0035c539, 0x005ce539,
+    0x003b0115, 0x29dda115, 0x00041dc0, 0xa3bc1dc0,
+    0x00081b9a, 0x9e7b5b9a, 0x003036c2, 0xae0876c2,
+    0xffe3bff6, 0x54e27ff6, 0x0021c4f7, 0x9940a4f7,
+    0xfff11bf4, 0xf96f9bf4, 0x001a35e7, 0xef5715e7,
+    0x0007340e, 0x1788f40e, 0x000e8f76, 0xeefd4f76,
+    0xffdb3c93, 0x69ed9c93, 0xfffd4ae0, 0xb9594ae0,
+    0xfff97d45, 0xa1221d45, 0x001a4cd0, 0x21b44cd0,
+    0xffe47cae, 0xf07a3cae, 0x001d2668, 0x10ea2668,
+    0x003b3853, 0x89c59853, 0x00141305, 0x13f4b305,
+    0x00147792, 0x0e06b792, 0xffe68e98, 0xe5b98e98,
+    0xffef2633, 0x97358633, 0xfffc05da, 0xfbb745da,
+    0xffc57fdb, 0x2e40dfdb, 0x003b8534, 0xa6e20534,
+    0x00139e25, 0xf5583e25, 0xffe7d0e0, 0x0a03d0e0,
+    0xffd32764, 0x42bfa764, 0xffdde1af, 0xa093c1af,
+    0xfff993dd, 0xb7f533dd, 0xffdd1d09, 0x42fe3d09,
+    0xffd8fc30, 0xc75efc30, 0xfff39944, 0xe11c1944,
+    0xffea0802, 0x47ea4802, 0x0002cc93, 0x5c152c93,
+    0xfff11805, 0x3471b805, 0x00189c2a, 0xa69ddc2a,
+    0xffc9e5a9, 0x0bff05a9, 0x001f9d54, 0x99ca1d54,
+    0xffd1eea2, 0x74a62ea2, 0xffc4c79c, 0x3ab8479c,
+    0xfff78a50, 0x09418a50, 0x003bcf2c, 0x94214f2c,
+    0xffff434e, 0x7969034e, 0xffeb36df, 0x734716df,
+    0xffd54f2d, 0xc73aef2d, 0xffc8a057, 0x44538057,
+    0x003a97d9, 0xcab5b7d9, 0x003c15ca, 0xc5f555ca,
+    0x00155e68, 0x17e25e68, 0xfff316b6, 0xdfc9d6b6,
+    0x001e29ce, 0x1657e9ce
+};
+
+/* Twiddle pairs of the inverse NTT in the order they are used:
+ *   len 1, 2, 4:     per 8 coefficients zetas_inv[128 + 2g + i],
+ *                    zetas_inv[192 + g], zetas_inv[4g + i]
+ *   len 8, 16, 32:   per 64 coefficients zetas_inv[240 + 2b + i],
+ *                    zetas_inv[248 + b], zetas_inv[224 + 4b + i]
+ *   len 64, 128:     zetas_inv[252..255], the last one being the final factor
+ * Each pair is (z, z * DILITHIUM_QINV mod 2^32).
+ */
+static const word32 mldsa_riscv32_invntt_zetas[512] = {
+    0xffc56827, 0x354a4827, 0x00375fa9, 0xbbac7fa9,
+    0x002ab0d3, 0x38c510d3, 0xffe1d632, 0xe9a81632,
+    0x000ce94a, 0x2036294a, 0xffeaa198, 0xe81da198,
+    0xffc3ea36, 0x3a0aaa36, 0x003b3864, 0xc547b864,
+    0x002e115e, 0x8b59d15e, 0xffe062ac, 0x6635e2ac,
+    0x0014c921, 0x8cb8e921, 0x0000bcb2, 0x8696fcb2,
+    0xffc430d4, 0x6bdeb0d4, 0x000875b0, 0xf6be75b0,
+    0x0015f7fe, 0xb815b7fe, 0x000c66bc, 0x1ee3e6bc,
+    0x002703d0, 0x38a103d0, 0x00361a57, 0xf400fa57,
+    0xffe763d6, 0x596223d6, 0x000ee7fb, 0xcb8e47fb,
+    0xfffd336d, 0xa3ead36d, 0x00182f20, 0xf5fc2f20,
+    0xffec61db, 0x0aa7c1db, 0xffc47acc, 0x591dfacc,
+    0x0022e2f7, 0xbd01c2f7, 0x00066c23, 0x480acc23,
+    0x00221e51, 0x5f6c3e51, 0x002cd89c, 0xbd40589c,
+    0xffeb886e, 0xf1f9486e, 0xffebecfb, 0xec0b4cfb,
+    0xffc4c7ad, 0x763a67ad, 0x003a8025, 0xd1bf2025,
+    0x0003fa26, 0x0448ba26, 0x0010d9cd, 0x68ca79cd,
+    0x00197168, 0x1a467168, 0x0002b520, 0x46a6b520,
+    0x0024c36d, 0x9612636d, 0xfff1708a, 0x1102b08a,
+    0xffe2d998, 0xef15d998, 0x001b8352, 0x0f85c352,
+    0xffe5b330, 0xde4bb330, 0x000682bb, 0x5edde2bb,
+    0x001c400a, 0xab1d800a, 0xffcfc93e, 0x51f7893e,
+    0xfff7e466, 0x6184a466, 0xfff8cbf2, 0xe8770bf2,
+    0xffe5ca19, 0x10a8ea19, 0x000ee40c, 0x0690640c,
+    0xffde3b09, 0x66bf5b09, 0x003637f8, 0xab3537f8,
+    0xfffd1b94, 0x296f9b94, 0xfff39c58, 0xa77e9c58,
+    0xfffbe240, 0x5c43e240, 0xffc4feeb, 0xd6225eeb,
+    0xffca3ac7, 0xffa31ac7, 0x002e5ec4, 0x7a06dec4,
+    0x001417f8, 0x671317f8, 0xfff4675f, 0x5960475f,
+    0xffc78c74, 0x87560c74, 0x001b73c3, 0x9913d3c3,
+    0x00385e99, 0x238b7e99, 0xffe6c866, 0x3df38866,
+    0xfff3a35b, 0x32df035b, 0x00033821, 0xda875821,
+    0xffdb8a94, 0x772e0a94, 0x00186ba4, 0xcb8ceba4,
+    0xffd2028f, 0x34a3e28f, 0xffe755f8, 0xcea655f8,
+    0xfffd83e4, 0x4e7a03e4, 0x00309342, 0x7998d342,
+    0x00319640, 0x12f99640, 0xffe6c6b8, 0x5cbdc6b8,
+    0x0020a9e9, 0xc4ddc9e9, 0x00126c59, 0x851d8c59,
+    0xfffd2b45, 0x16e5cb45, 0xffcc9768, 0x7eb99768,
+    0xffe22268, 0xb02f2268, 0x00002182, 0x4b306182,
+    0x0038d436, 0xd7bf9436, 0xffca7bc1, 0x72c29bc1,
+    0x00028371, 0x5bf0a371, 0xffda8c49, 0x50e3ac49,
+    0xffdae275, 0xf5a98275, 0x001eb9a8, 0xa353b9a8,
+    0xffc398a6, 0xb7d858a6, 0xfff232bc, 0xd849b2bc,
+    0x003a50a7, 0x92cf30a7, 0x0039a1e1, 0xc7f5c1e1,
+    0xfff6ef28, 0xe9dbef28, 0x0038d3ee, 0xdbb693ee,
+    0x00276ee5, 0x0f840ee5, 0x0010c942, 0x80390942,
+    0xffff5300, 0x6a5f5300, 0xffca81e2, 0xe706c1e2,
+    0x001c2ea9, 0xd5714ea9, 0x00198008, 0x4c1a8008,
+    0x002b35f4, 0x3ce9b5f4, 0x000846cc, 0xd2e1c6cc,
+    0xffd0ba78, 0xbb1fba78, 0xfff83be9, 0xb6f55be9,
+    0x0019152a, 0x35be552a, 0xffcc0731, 0xac322731,
+    0xffdde218, 0x1020e218, 0xfff42419, 0xdbf74419,
+    0xffe91bfb, 0x11e87bfb, 0xfffbf510, 0x369df510,
+    0x00330417, 0xb135e417, 0x0019edc3, 0x68524dc3,
+    0x0014fa53, 0xc1df5a53, 0x0026da88, 0xb777da88,
+    0xffe2bf67, 0x404f9f67, 0x001386ad, 0xce6926ad,
+    0x0015d39e, 0x6389939e, 0xffe3ba9d, 0x9cb75a9d,
+    0x00083aa3, 0x41dc9aa3, 0x001df292, 0xbd703292,
+    0xffcd8d7d, 0xe6fd2d7d, 0xffebf939, 0xc6931939,
+    0x0006e21c, 0x3e4a621c, 0xffeb6a2c, 0x0730ea2c,
+    0x0005d423, 0x350a3423, 0xffdc2964, 0x6308a964,
+    0x0015d2d1, 0x95eff2d1, 0x0032a1c2, 0x7b6ae1c2,
+    0xffed1ee5, 0xc549bee5, 0x00145742, 0xf1fc9742,
+    0x0013f609, 0x9e551609, 0x000059c5, 0x3cb8f9c5,
+    0x000495b3, 0x853af5b3, 0x0010095a, 0xbc3b495a,
+    0xffe2f4b5, 0xd7f994b5, 0xffe37ac1, 0x12bb9ac1,
+    0x002daf77, 0xd69c8f77, 0x0012beed, 0x95705eed,
+    0x000a3d7e, 0x80b9fd7e, 0xffc9fc00, 0x3f49fc00,
+    0x00362470, 0x4cc42470, 0xffd7c76f, 0xfd45a76f,
+    0xffeceb42, 0x04552b42, 0x00397ae8, 0x5b967ae8,
+    0x0025cbf7, 0x9a24abf7, 0x00064593, 0x4b38a593,
+    0x002bc1bf, 0x94e3a1bf, 0xffe7a5ba, 0xff9ee5ba,
+    0xffda0faf, 0x264fefaf, 0xffecf67c, 0x50bc767c,
+    0xffc21ee4, 0x619e9ee4, 0x00385bb5, 0x052efbb5,
+    0x002d485d, 0xeeb8e85d, 0xffc9756a, 0x2176b56a,
+    0xffecb28f, 0x8abe928f, 0x002785c6, 0x25e045c6,
+    0xffd6ee67, 0x4623ce67, 0xffd4a11b, 0x7278011b,
+    0xffd69161, 0xa582b161, 0xffdf39c8, 0x231839c8,
+    0x002e7184, 0x1c5ef184, 0xfffce6dc, 0x9ed866dc,
+    0xffe58339, 0xf7cca339, 0x0032ffc5, 0x91ab9fc5,
+    0xffcb8d19, 0x48eead19, 0x000f017b, 0x0ebe617b,
+    0xffcbef0e, 0x2eadaf0e, 0x003aea7b, 0x0c0a4a7b,
+    0xffc14fe5, 0xcb3defe5, 0x002532bf, 0x42fd12bf,
+    0xfffb9ef4, 0xc9da1ef4, 0xfffac6e7, 0x8157a6e7,
+    0xfffe1036, 0x7f04d036, 0x00376f20, 0xde1b6f20,
+    0xffc44151, 0x236e6151, 0x0036de3e, 0xb4fe9e3e,
+    0x000bba6e, 0xf8597a6e, 0x0008032a, 0x136d432a,
+    0x00364683, 0x9386a683, 0x00302d52, 0xa4da6d52,
+    0x0030ad80, 0x55e0ad80, 0x0026b82c, 0x712c382c,
+    0xffcf107a, 0x8cde507a, 0xffe0ff7c, 0x51d07f7c,
+    0x002fa50a, 0x97d0e50a, 0x0009ffdf, 0xcc85dfdf,
+    0x000f430a, 0x8b70830a, 0x003e4f8e, 0x3b300f8e,
+    0x0036cfd4, 0x40314fd4, 0x0007f904, 0x8d287904,
+    0x0000a8fc, 0x872028fc, 0x00189d76, 0x30c75d76,
+    0xfff8707d, 0xc388107d, 0xffe2688e, 0x3df4288e,
+    0x0013308b, 0x4ca4908b, 0x00195afd, 0xa0f8fafd,
+    0xfff380a6, 0xb50840a6, 0xfff21f1a, 0x1ed55f1a,
+    0xffe3a1e6, 0x192061e6, 0xfff241a2, 0xff2681a2,
+    0x00183045, 0xf7a0d045, 0xffdeca39, 0xa0a5ea39,
+    0xffca213b, 0x9271813b, 0x0030ba22, 0x8e74fa22,
+    0x001244aa, 0x9ba784aa, 0x00395d04, 0xb9d9dd04,
+    0x0035b760, 0x8721b760, 0xffcaf612, 0x9d8d3612,
+    0x001629a3, 0x7fca89a3, 0xffd10b33, 0x53b76b33,
+    0xffca64a3, 0x86dec4a3, 0x0012db10, 0x1374db10,
+    0xffdada79, 0x02a9fa79, 0xfffbed0b, 0x241d4d0b,
+    0x002e67e7, 0x75ab47e7, 0x00381e31, 0xaf7e3e31,
+    0xfffe89e0, 0x613a89e0, 0x00365bde, 0x54b21bde,
+    0x00255461, 0xfe317461, 0xffddc205, 0xc99e6205,
+    0x0033008e, 0x5144c08e, 0x0017537f, 0x2707337f,
+    0x003bf91b, 0x5ddf591b, 0xffd6b599, 0x6e09d599,
+    0xffc5be08, 0xd386be08, 0xffdca72c, 0xaec2272c,
+    0xffcc00a6, 0xc4e0c0a6, 0xffe0156d, 0x000db56d,
+    0xffd71ad9, 0xdab23ad9, 0xffd085b7, 0x110765b7,
+    0xfff8e1dc, 0x9e3461dc, 0xfffbba3b, 0x45c31a3b,
+    0xffc2cdff, 0x5602adff, 0x00004bde, 0x927c0bde,
+    0xffe52fcb, 0xec5e8fcb, 0x002c04f7, 0xe14ae4f7,
+    0xffd0658b, 0x7301c58b, 0x000d5ed8, 0x9fe85ed8,
+    0x00320368, 0x2c9f0368, 0x00155b09, 0x4af67b09,
+    0x003ae519, 0x345e0519, 0x0020522a, 0x9d65922a,
+    0x001feb81, 0x41100b81, 0x00057b53, 0x51efdb53,
+    0x000bdee8, 0xa7e8dee8, 0x00202c85, 0xd730cc85,
+    0xffd80698, 0x14ab0698, 0x00111560, 0xf2bd1560,
+    0x00086270, 0x94566270, 0xffdc16d5, 0x6c36b6d5,
+    0xffe421d5, 0xed9ec1d5, 0xfffc61bc, 0x9e33e1bc,
+    0xffc94878, 0xccd84878, 0x00107a5c, 0x515bfa5c,
+    0xfff05f90, 0x83e25f90, 0xffd669a8, 0x990b69a8,
+    0x0007eafd, 0x72e78afd, 0x0027cefe, 0x73078efe,
+    0xffff9b09, 0x92e0bb09, 0x0000a3fa, 0xff7fe3fa
+};
+
+/* Number-Theoretic Transform.
+ *
+ * @param [in, out] r  Polynomial to transform.
+ */
+void wc_mldsa_ntt_riscv32(sword32* r)
+{
+    register sword32*       r_p __asm__ ("a0") = r;
+    register const word32*  z_p __asm__ ("a1") = mldsa_riscv32_ntt_zetas;
+
+    __asm__ __volatile__ (
+        "li     " CC_Q ", 8380417\n\t"
+
+        /* len = 128,64: r[j + 32 * i] for j = 0..31 */
+        LOAD_ZETAS3("a1")
+        "mv     a2, a0\n\t"
+        "addi   a3, a0, 128\n\t"
+    "1:\n\t"
+        LOAD8(0, 128, 256, 384, 512, 640, 768, 896)
+        MONT_BFLY(CC_R0, CC_R4, "s1", "s2")
+        MONT_BFLY(CC_R1, CC_R5, "s1", "s2")
+        MONT_BFLY(CC_R2, CC_R6, "s1", "s2")
+        MONT_BFLY(CC_R3, CC_R7, "s1", "s2")
+        MONT_BFLY(CC_R0, CC_R2, "s3", "s4")
+        MONT_BFLY(CC_R1, CC_R3, "s3", "s4")
+        MONT_BFLY(CC_R4, CC_R6, "s5", "s6")
+        MONT_BFLY(CC_R5, CC_R7, "s5", "s6")
+        STORE8(0, 128, 256, 384, 512, 640, 768, 896)
+        "addi   a2, a2, 4\n\t"
+        "bne    a2, a3, 1b\n\t"
+
+        /* len = 32,16,8: r[j + i + 8 * k] for i = 0..7 */
+        "addi   s9, a1, 24\n\t"
+        "mv     s11, a0\n\t"
+        "addi   s10, a0, 1024\n\t"
+    "2:\n\t"
+        LOAD_ZETAS3("s9")
+        "mv     a2, s11\n\t"
+        "addi   a3, s11, 32\n\t"
+    "3:\n\t"
+        LOAD8(0, 32, 64, 96, 128, 160, 192, 224)
+        MONT_BFLY(CC_R0, CC_R4, "s1", "s2")
+        MONT_BFLY(CC_R1, CC_R5, "s1", "s2")
+        MONT_BFLY(CC_R2, CC_R6, "s1", "s2")
+        MONT_BFLY(CC_R3, CC_R7, "s1", "s2")
+        MONT_BFLY(CC_R0, CC_R2, "s3", "s4")
+        MONT_BFLY(CC_R1, CC_R3, "s3", "s4")
+        MONT_BFLY(CC_R4, CC_R6, "s5", "s6")
+        MONT_BFLY(CC_R5, CC_R7, "s5", "s6")
+        LOAD_ZETA("s9", 24)
+        MONT_BFLY(CC_R0, CC_R1, "s7", "s8")
+        LOAD_ZETA("s9", 32)
+        MONT_BFLY(CC_R2, CC_R3, "s7", "s8")
+        LOAD_ZETA("s9", 40)
+        MONT_BFLY(CC_R4, CC_R5, "s7", "s8")
+        LOAD_ZETA("s9", 48)
+        MONT_BFLY(CC_R6, CC_R7, "s7", "s8")
+        STORE8(0, 32, 64, 96, 128, 160, 192, 224)
+        "addi   a2, a2, 4\n\t"
+        "bne    a2, a3, 3b\n\t"
+        "addi   s9, s9, 56\n\t"
+        "addi   s11, s11, 256\n\t"
+        "bne    s11, s10, 2b\n\t"
+
+        /* len = 4,2,1: r[j + i] for i = 0..7 */
+        "mv     a2, a0\n\t"
+        "addi   a3, a0, 1024\n\t"
+    "4:\n\t"
+        LOAD_ZETAS3("s9")
+        LOAD8(0, 4, 8, 12, 16, 20, 24, 28)
+        MONT_BFLY(CC_R0, CC_R4, "s1", "s2")
+        MONT_BFLY(CC_R1, CC_R5, "s1", "s2")
+        MONT_BFLY(CC_R2, CC_R6, "s1", "s2")
+        MONT_BFLY(CC_R3, CC_R7, "s1", "s2")
+        MONT_BFLY(CC_R0, CC_R2, "s3", "s4")
+        MONT_BFLY(CC_R1, CC_R3, "s3", "s4")
+        MONT_BFLY(CC_R4, CC_R6, "s5", "s6")
+        MONT_BFLY(CC_R5, CC_R7, "s5", "s6")
+        LOAD_ZETA("s9", 24)
+        MONT_BFLY(CC_R0, CC_R1, "s7", "s8")
+        LOAD_ZETA("s9", 32)
+        MONT_BFLY(CC_R2, CC_R3, "s7", "s8")
+        LOAD_ZETA("s9", 40)
+        MONT_BFLY(CC_R4, CC_R5, "s7", "s8")
+        LOAD_ZETA("s9", 48)
+        MONT_BFLY(CC_R6, CC_R7, "s7", "s8")
+        STORE8(0, 4, 8, 12, 16, 20, 24, 28)
+        "addi   s9, s9, 56\n\t"
+        "addi   a2, a2, 32\n\t"
+        "bne    a2, a3, 4b\n\t"
+        :
+        : [r] "r" (r_p), [z] "r" (z_p)
+        : "memory", "t0", "t1", "t2", "t3", "t4", "t5", "t6",
+          "s1", "s2", "s3", "s4", "s5", "s6", "s7", "s8", "s9", "s10", "s11",
+          "a2", "a3", "a4", "a5", "a6"
+    );
+}
+
+/* Inverse Number-Theoretic Transform.
+ *
+ * @param [in, out] r  Polynomial to transform.
+ */
+void wc_mldsa_invntt_riscv32(sword32* r)
+{
+    register sword32*       r_p __asm__ ("a0") = r;
+    register const word32*  z_p __asm__ ("a1") = mldsa_riscv32_invntt_zetas;
+
+    __asm__ __volatile__ (
+        "li     " CC_Q ", 8380417\n\t"
+
+        /* len = 1,2,4: r[j + i] for i = 0..7 */
+        "mv     s9, a1\n\t"
+        "mv     a2, a0\n\t"
+        "addi   a3, a0, 1024\n\t"
+    "1:\n\t"
+        LOAD_ZETAS3("s9")
+        LOAD8(0, 4, 8, 12, 16, 20, 24, 28)
+        LOAD_ZETA("s9", 24)
+        MONT_INV_BFLY(CC_R0, CC_R1, "s7", "s8")
+        LOAD_ZETA("s9", 32)
+        MONT_INV_BFLY(CC_R2, CC_R3, "s7", "s8")
+        LOAD_ZETA("s9", 40)
+        MONT_INV_BFLY(CC_R4, CC_R5, "s7", "s8")
+        LOAD_ZETA("s9", 48)
+        MONT_INV_BFLY(CC_R6, CC_R7, "s7", "s8")
+        MONT_INV_BFLY(CC_R0, CC_R2, "s1", "s2")
+        MONT_INV_BFLY(CC_R1, CC_R3, "s1", "s2")
+        MONT_INV_BFLY(CC_R4, CC_R6, "s3", "s4")
+        MONT_INV_BFLY(CC_R5, CC_R7, "s3", "s4")
+        MONT_INV_BFLY(CC_R0, CC_R4, "s5", "s6")
+        MONT_INV_BFLY(CC_R1, CC_R5, "s5", "s6")
+        MONT_INV_BFLY(CC_R2, CC_R6, "s5", "s6")
+        MONT_INV_BFLY(CC_R3, CC_R7, "s5", "s6")
+        STORE8(0, 4, 8, 12, 16, 20, 24, 28)
+        "addi   s9, s9, 56\n\t"
+        "addi   a2, a2, 32\n\t"
+        "bne    a2, a3, 1b\n\t"
+
+        /* len = 8,16,32: r[j + i + 8 * k] for i = 0..7 */
+        "mv     s11, a0\n\t"
+        "addi   s10, a0, 1024\n\t"
+    "2:\n\t"
+        LOAD_ZETAS3("s9")
+        "mv     a2, s11\n\t"
+        "addi   a3, s11, 32\n\t"
+    "3:\n\t"
+        LOAD8(0, 32, 64, 96, 128, 160, 192, 224)
+        LOAD_ZETA("s9", 24)
+        MONT_INV_BFLY(CC_R0, CC_R1, "s7", "s8")
+        LOAD_ZETA("s9", 32)
+        MONT_INV_BFLY(CC_R2, CC_R3, "s7", "s8")
+        LOAD_ZETA("s9", 40)
+        MONT_INV_BFLY(CC_R4, CC_R5, "s7", "s8")
+        LOAD_ZETA("s9", 48)
+        MONT_INV_BFLY(CC_R6, CC_R7, "s7", "s8")
+        MONT_INV_BFLY(CC_R0, CC_R2, "s1", "s2")
+        MONT_INV_BFLY(CC_R1, CC_R3, "s1", "s2")
+        MONT_INV_BFLY(CC_R4, CC_R6, "s3", "s4")
+        MONT_INV_BFLY(CC_R5, CC_R7, "s3", "s4")
+        MONT_INV_BFLY(CC_R0, CC_R4, "s5", "s6")
+        MONT_INV_BFLY(CC_R1, CC_R5, "s5", "s6")
+        MONT_INV_BFLY(CC_R2, CC_R6, "s5", "s6")
+        MONT_INV_BFLY(CC_R3, CC_R7, "s5", "s6")
+        STORE8(0, 32, 64, 96, 128, 160, 192, 224)
+        "addi   a2, a2, 4\n\t"
+        "bne    a2, a3, 3b\n\t"
+        "addi   s9, s9, 56\n\t"
+        "addi   s11, s11, 256\n\t"
+        "bne    s11, s10, 2b\n\t"
+
+        /* len = 64,128 and final factor: r[j + 32 * i] for j = 0..31 */
+        LOAD_ZETAS3("s9")
+        LOAD_ZETA("s9", 24)
+        "mv     a2, a0\n\t"
+        "addi   a3, a0, 128\n\t"
+    "4:\n\t"
+        LOAD8(0, 128, 256, 384, 512, 640, 768, 896)
+        MONT_INV_BFLY(CC_R0, CC_R2, "s1", "s2")
+        MONT_INV_BFLY(CC_R1, CC_R3, "s1", "s2")
+        MONT_INV_BFLY(CC_R4, CC_R6, "s3", "s4")
+        MONT_INV_BFLY(CC_R5, CC_R7, "s3", "s4")
+        MONT_INV_BFLY(CC_R0, CC_R4, "s5", "s6")
+        MONT_INV_BFLY(CC_R1, CC_R5, "s5", "s6")
+        MONT_INV_BFLY(CC_R2, CC_R6, "s5", "s6")
+        MONT_INV_BFLY(CC_R3, CC_R7, "s5", "s6")
+        MONT_MUL(CC_R0, "s7", "s8")
+        MONT_MUL(CC_R1, "s7", "s8")
+        MONT_MUL(CC_R2, "s7", "s8")
+        MONT_MUL(CC_R3, "s7", "s8")
+        MONT_MUL(CC_R4, "s7", "s8")
+        MONT_MUL(CC_R5, "s7", "s8")
+        MONT_MUL(CC_R6, "s7", "s8")
+        MONT_MUL(CC_R7, "s7", "s8")
+        STORE8(0, 128, 256, 384, 512, 640, 768, 896)
+        "addi   a2, a2, 4\n\t"
+        "bne    a2, a3, 4b\n\t"
+        :
+        : [r] "r" (r_p), [z] "r" (z_p)
+        : "memory", "t0", "t1", "t2", "t3", "t4", "t5", "t6",
+          "s1", "s2", "s3", "s4", "s5", "s6", "s7", "s8", "s9", "s10", "s11",
+          "a2", "a3", "a4", "a5", "a6"
+    );
+}
+
+#endif /* USE_RISCV32_MLDSA_SPEEDUP */
+#endif /* HAVE_DILITHIUM && WOLFSSL_WC_DILITHIUM */
@@ -0,0 +1,627 @@
+/* riscv-32-mlkem.c
+ *
+ * Copyright (C) 2006-2025 wolfSSL Inc.
+ *
+ * This file is part of wolfSSL.
+ *
+ * wolfSSL is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * wolfSSL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
+ */
+
+#include <wolfssl/wolfcrypt/libwolfssl_sources.h>
+
+/* ML-KEM polynomial transforms for RV32IM: NTT, inverse NTT and the base
+ * multiplication in the NTT domain. Results are identical to the C code in
+ * wc_mlkem_poly.c.
+ *
+ * The layers are merged the same way as the unrolled C code: (128, 64),
+ * (32, 16, 8), (4, 2) forward and (2, 4), (8, 16, 32), (64, 128) inverse, so
+ * each coefficient is loaded and stored three times per transform. The
+ * twiddles of all but the last layer of a pass stay in registers for the
+ * whole loop over the coefficients they apply to.
+ *
+ * Coefficients are sign extended into 32-bit registers and a twiddle z is
+ * stored as the pair (z << 16, (z * q^-1 mod 2^16) << 16). The Montgomery
+ * product is then four instructions and needs no sign extension:
+ *   t = mulh(a, z << 16) - mulh(a * (zq << 16), q)
+ * Sums are not truncated to 16 bits between layers. The C code does not
+ * overflow for the coefficient ranges it is called with, so this does not
+ * change any result.
+ */
+
+#ifdef WOLFSSL_WC_MLKEM
+
+#include <wolfssl/wolfcrypt/wc_mlkem.h>
+
+#ifdef USE_RISCV32_MLKEM_SPEEDUP
+
+/* Coefficient register assignment. */
+#define CC_R0   "t1"
+#define CC_R1   "t2"
+#define CC_R2   "t3"
+#define CC_R3   "t4"
+#define CC_R4   "t5"
+#define CC_R5   "t6"
+#define CC_R6   "a5"
+#define CC_R7   "a6"
+/* q and the Barrett multiplier. */
+#define CC_Q    "a4"
+#define CC_V    "a7"
+
+/* Butterfly: t = b * z; b = a - t; a = a + t; */
+#define MONT_BFLY(a, b, zw, zq)                                             \
+        "mulh   t0, " b ", " zw "\n\t"                                      \
+        "mul    " b ", " b ", " zq "\n\t"                                   \
+        "mulh   " b ", " b ", " CC_Q "\n\t"                                 \
+        "sub    t0, t0, " b "\n\t"                                          \
+        "sub    " b ", " a ", t0\n\t"                                       \
+        "add    " a ", " a ", t0\n\t"
+
+/* Inverse butterfly: t = a - b; a = a + b; b = t * z; */
+#define MONT_INV_BFLY(a, b, zw, zq)                                         \
+        "sub    t0, " a ", " b "\n\t"                                       \
+        "add    " a ", " a ", " b "\n\t"                                    \
+        "mulh   " b ", t0, " zw "\n\t"                                      \
+        "mul    t0, t0, " zq "\n\t"                                         \
+        "mulh   t0, t0, " CC_Q "\n\t"                                       \
+        "sub    " b ", " b ", t0\n\t"
+
+/* a = a * z */
+#define MONT_MUL(a, zw, zq)                                                 \
+        "mulh   t0, " a ", " zw "\n\t"                                      \
+        "mul    " a ", " a ", " zq "\n\t"                                   \
+        "mulh   " a ", " a ", " CC_Q "\n\t"                                 \
+        "sub    " a ", t0, " a "\n\t"
+
+/* a = a mod q, as MLKEM_BARRETT_RED() */
+#define BARRETT_RED(a)                                                      \
+        "mul    t0, " a ", " CC_V "\n\t"                                    \
+        "srai   t0, t0, 26\n\t"                                             \
+        "mul    t0, t0, " CC_Q "\n\t"                                       \
+        "sub    " a ", " a ", t0\n\t"
+
+/* Load/store eight coefficients at byte offsets from a2. */
+#define LOAD8(o0, o1, o2, o3, o4, o5, o6, o7)                               \
+        "lh     " CC_R0 ", " #o0 "(a2)\n\t"                                 \
+        "lh     " CC_R1 ", " #o1 "(a2)\n\t"                                 \
+        "lh     " CC_R2 ", " #o2 "(a2)\n\t"                                 \
+        "lh     " CC_R3 ", " #o3 "(a2)\n\t"                                 \
+        "lh     " CC_R4 ", " #o4 "(a2)\n\t"                                 \
+        "lh     " CC_R5 ", " #o5 "(a2)\n\t"                                 \
+        "lh     " CC_R6 ", " #o6 "(a2)\n\t"                                 \
+        "lh     " CC_R7 ", " #o7 "(a2)\n\t"
+#define STORE8(o0, o1, o2, o3, o4, o5, o6, o7)                              \
+        "sh     " CC_R0 ", " #o0 "(a2)\n\t"                                 \
+        "sh     " CC_R1 ", " #o1 "(a2)\n\t"                                 \
+        "sh     " CC_R2 ", " #o2 "(a2)\n\t"                                 \
+        "sh     " CC_R3 ", " #o3 "(a2)\n\t"                                 \
+        "sh     " CC_R4 ", " #o4 "(a2)\n\t"                                 \
+        "sh     " CC_R5 ", " #o5 "(a2)\n\t"                                 \
+        "sh     " CC_R6 ", " #o6 "(a2)\n\t"                                 \
+        "sh     " CC_R7 ", " #o7 "(a2)\n\t"
+
+/* Load twiddle pairs 0-2 of a table entry into s1-s6. */
+#define LOAD_ZETAS3(t)                                                      \
+        "lw     s1,  0(" t ")\n\t"                                          \
+        "lw     s2,  4(" t ")\n\t"                                          \
+        "lw     s3,  8(" t ")\n\t"                                          \
+        "lw     s4, 12(" t ")\n\t"                                          \
+        "lw     s5, 16(" t ")\n\t"                                          \
+        "lw     s6, 20(" t ")\n\t"
+
+/* Load twiddle pair at byte offset o of a table entry into s7/s8. */
+#define LOAD_ZETA(t, o)                                                     \
+        "lw     s7, " #o "(" t ")\n\t"                                      \
+        "lw     s8, " #o "+4(" t ")\n\t"
+
+/* Twiddle pairs of the forward NTT in the order they are used:
+ *   len 128, 64:     zetas[1..3]
+ *   len 32, 16, 8:   per 64 coefficients zetas[4 + b], zetas[8 + 2b + i],
+ *                    zetas[16 + 4b + i]
+ *   len 4, 2:        per 8 coefficients zetas[32 + g], zetas[64 + 2g + i]
+ * Each pair is (z << 16, (z * MLKEM_QINV mod 2^16) << 16).
+ */
+static const word32 mlkem_riscv32_ntt_zetas[254] = {
+    0x0a0b0000, 0x7b0b0000, 0x0b9a0000, 0x399a0000,
+    0x07140000, 0x03140000, 0x05d50000, 0x34d50000,
+    0x0c560000, 0xae560000, 0x026e0000, 0x6c6e0000,
+    0x023d0000, 0xe93d0000, 0x07d40000, 0x43d40000,
+    0x01080000, 0x99080000, 0x017f0000, 0x8e7f0000,
+    0x058e0000, 0xcf8e0000, 0x06290000, 0xf1290000,
+    0x00b60000, 0xc2b60000, 0x09c40000, 0x15c40000,
+    0x05b20000, 0xfbb20000, 0x06bf0000, 0x53bf0000,
+    0x0c7f0000, 0x997f0000, 0x011f0000, 0x6e1f0000,
+    0x03c20000, 0x29c20000, 0x084f0000, 0x054f0000,
+    0x0a580000, 0x92580000, 0x03f90000, 0x5ef90000,
+    0x02dc0000, 0xd6dc0000, 0x02600000, 0x22600000,
+    0x00ca0000, 0xbeca0000, 0x073f0000, 0xd43f0000,
+    0x05bc0000, 0x79bc0000, 0x06fb0000, 0x47fb0000,
+    0x019b0000, 0x229b0000, 0x0c340000, 0x68340000,
+    0x06de0000, 0xc0de0000, 0x04c70000, 0xe9c70000,
+    0x08b20000, 0xfeb20000, 0x01ae0000, 0x2bae0000,
+    0x028c0000, 0xe68c0000, 0x022b0000, 0xd32b0000,
+    0x034b0000, 0x344b0000, 0x0ad90000, 0x05d90000,
+    0x081e0000, 0x821e0000, 0x03670000, 0xc8670000,
+    0x03f70000, 0x78f70000, 0x060e0000, 0x500e0000,
+    0x00690000, 0xab690000, 0x07f40000, 0xa3f40000,
+    0x01a60000, 0x93a60000, 0x024b0000, 0x334b0000,
+    0x05d30000, 0x4ed30000, 0x00b10000, 0x03b10000,
+    0x0c160000, 0xee160000, 0x0be70000, 0x50e70000,
+    0x0bde0000, 0xc5de0000, 0x0b350000, 0x5a350000,
+    0x06f90000, 0x61f90000, 0x06260000, 0x18260000,
+    0x06750000, 0x15750000, 0x02040000, 0xce040000,
+    0x0c0b0000, 0x7d0b0000, 0x030a0000, 0x810a0000,
+    0x0cf90000, 0x67f90000, 0x04870000, 0x29870000,
+    0x0c6e0000, 0x766e0000, 0x0bc10000, 0x3ec10000,
+    0x09f80000, 0x71f80000, 0x05cb0000, 0xb6cb0000,
+    0x0a670000, 0xcf670000, 0x0aa70000, 0x8fa70000,
+    0x045f0000, 0x315f0000, 0x06af0000, 0x23af0000,
+    0x06cb0000, 0xb7cb0000, 0x02840000, 0x4e840000,
+    0x08770000, 0xfd770000, 0x09990000, 0x44990000,
+    0x015d0000, 0x485d0000, 0x007e0000, 0x9a7e0000,
+    0x01a20000, 0xc7a20000, 0x01490000, 0x4c490000,
+    0x05bd0000, 0x6cbd0000, 0x0c650000, 0xeb650000,
+    0x0cb60000, 0xceb60000, 0x09ac0000, 0x4dac0000,
+    0x03310000, 0x86310000, 0x04490000, 0x4f490000,
+    0x0ca70000, 0x91a70000, 0x025b0000, 0x635b0000,
+    0x02620000, 0x08620000, 0x0bf20000, 0xc1f20000,
+    0x052a0000, 0xe32a0000, 0x07fc0000, 0x3bfc0000,
+    0x033e0000, 0xdd3e0000, 0x07480000, 0x5f480000,
+    0x01800000, 0x81800000, 0x006b0000, 0x916b0000,
+    0x08420000, 0xae420000, 0x0c790000, 0xe7790000,
+    0x07740000, 0x23740000, 0x04c20000, 0x2ac20000,
+    0x07ca0000, 0xc5ca0000, 0x0c0a0000, 0x8a0a0000,
+    0x09970000, 0x5e970000, 0x00dc0000, 0xd4dc0000,
+    0x094a0000, 0x474a0000, 0x085e0000, 0x425e0000,
+    0x06860000, 0x38860000, 0x0b730000, 0x34730000,
+    0x08600000, 0x28600000, 0x07070000, 0xac070000,
+    0x03c10000, 0x36c10000, 0x08030000, 0xe1030000,
+    0x031a0000, 0xb11a0000, 0x071d0000, 0x8e1d0000,
+    0x071b0000, 0xa81b0000, 0x09ab0000, 0x5aab0000,
+    0x0a2c0000, 0xce2c0000, 0x099b0000, 0x2a9b0000,
+    0x01de0000, 0xbbde0000, 0x01c00000, 0x41c00000,
+    0x0c950000, 0x7b950000, 0x0bcd0000, 0xa2cd0000,
+    0x08d80000, 0x10d80000, 0x03e40000, 0x6fe40000,
+    0x03df0000, 0xb0df0000, 0x02a50000, 0xa1a50000,
+    0x03be0000, 0x5dbe0000, 0x074d0000, 0x1e4d0000,
+    0x08060000, 0xba060000, 0x05f20000, 0xbbf20000,
+    0x065c0000, 0x5a5c0000
+};
+
+/* Twiddle pairs of the inverse NTT in the order they are used:
+ *   len 2, 4:        per 8 coefficients zetas_inv[2g + i], zetas_inv[64 + g]
+ *   len 8, 16, 32:   per 64 coefficients zetas_inv[112 + 2b + i],
+ *                    zetas_inv[120 + b], zetas_inv[96 + 4b + i]
+ *   len 64, 128:     zetas_inv[124..127], the last one being the final factor
+ * Each pair is (z << 16, (z * MLKEM_QINV mod 2^16) << 16).
+ */
+static const word32 mlkem_riscv32_invntt_zetas[256] = {
+    0x06a50000, 0xa5a50000, 0x070f0000, 0x440f0000,
+    0x04fb0000, 0x45fb0000, 0x05b40000, 0xe1b40000,
+    0x09430000, 0xa2430000, 0x0a5c0000, 0x5e5c0000,
+    0x09220000, 0x4f220000, 0x091d0000, 0x901d0000,
+    0x04290000, 0xef290000, 0x01340000, 0x5d340000,
+    0x006c0000, 0x846c0000, 0x0b410000, 0xbe410000,
+    0x0b230000, 0x44230000, 0x03660000, 0xd5660000,
+    0x02d50000, 0x31d50000, 0x03560000, 0xa5560000,
+    0x05e60000, 0x57e60000, 0x05e40000, 0x71e40000,
+    0x09e70000, 0x4ee70000, 0x04fe0000, 0x1efe0000,
+    0x09400000, 0xc9400000, 0x05fa0000, 0x53fa0000,
+    0x04a10000, 0xd7a10000, 0x018e0000, 0xcb8e0000,
+    0x067b0000, 0xc77b0000, 0x04a30000, 0xbda30000,
+    0x03b70000, 0xb8b70000, 0x0c250000, 0x2b250000,
+    0x036a0000, 0xa16a0000, 0x00f70000, 0x75f70000,
+    0x05370000, 0x3a370000, 0x083f0000, 0xd53f0000,
+    0x058d0000, 0xdc8d0000, 0x00880000, 0x18880000,
+    0x04bf0000, 0x51bf0000, 0x0c960000, 0x6e960000,
+    0x0b810000, 0x7e810000, 0x05b90000, 0xa0b90000,
+    0x09c30000, 0x22c30000, 0x05050000, 0xc4050000,
+    0x07d70000, 0x1cd70000, 0x010f0000, 0x3e0f0000,
+    0x0a9f0000, 0xf79f0000, 0x0aa60000, 0x9ca60000,
+    0x005a0000, 0x6e5a0000, 0x08b80000, 0xb0b80000,
+    0x09d00000, 0x79d00000, 0x03550000, 0xb2550000,
+    0x004b0000, 0x314b0000, 0x009c0000, 0x149c0000,
+    0x07440000, 0x93440000, 0x0bb80000, 0xb3b80000,
+    0x0b5f0000, 0x385f0000, 0x0c830000, 0x65830000,
+    0x0ba40000, 0xb7a40000, 0x03680000, 0xbb680000,
+    0x048a0000, 0x028a0000, 0x0a7d0000, 0xb17d0000,
+    0x06360000, 0x48360000, 0x06520000, 0xdc520000,
+    0x08a20000, 0xcea20000, 0x025a0000, 0x705a0000,
+    0x029a0000, 0x309a0000, 0x07360000, 0x49360000,
+    0x03090000, 0x8e090000, 0x01400000, 0xc1400000,
+    0x00930000, 0x89930000, 0x087a0000, 0xd67a0000,
+    0x00080000, 0x98080000, 0x09f70000, 0x7ef70000,
+    0x00f60000, 0x82f60000, 0x0afd0000, 0x31fd0000,
+    0x068c0000, 0xea8c0000, 0x06db0000, 0xe7db0000,
+    0x06080000, 0x9e080000, 0x01cc0000, 0xa5cc0000,
+    0x01230000, 0x3a230000, 0x011a0000, 0xaf1a0000,
+    0x00eb0000, 0x11eb0000, 0x0c500000, 0xfc500000,
+    0x072e0000, 0xb12e0000, 0x0ab60000, 0xccb60000,
+    0x0b5b0000, 0x6c5b0000, 0x050d0000, 0x5c0d0000,
+    0x0c980000, 0x54980000, 0x06f30000, 0xaff30000,
+    0x090a0000, 0x870a0000, 0x099a0000, 0x379a0000,
+    0x04e30000, 0x7de30000, 0x02280000, 0xfa280000,
+    0x09b60000, 0xcbb60000, 0x0ad60000, 0x2cd60000,
+    0x0a750000, 0x19750000, 0x0b530000, 0xd4530000,
+    0x044f0000, 0x014f0000, 0x083a0000, 0x163a0000,
+    0x07450000, 0x86450000, 0x05c20000, 0x2bc20000,
+    0x0c370000, 0x41370000, 0x06230000, 0x3f230000,
+    0x00cd0000, 0x97cd0000, 0x0b660000, 0xdd660000,
+    0x06060000, 0xb8060000, 0x04b20000, 0xfab20000,
+    0x093f0000, 0xd63f0000, 0x0be20000, 0x91e20000,
+    0x0aa10000, 0xdda10000, 0x0a250000, 0x29250000,
+    0x09080000, 0xa1080000, 0x02a90000, 0x6da90000,
+    0x0c4b0000, 0x3d4b0000, 0x06d80000, 0x0ed80000,
+    0x07730000, 0x30730000, 0x00820000, 0x66820000,
+    0x06420000, 0xac420000, 0x074f0000, 0x044f0000,
+    0x033d0000, 0xea3d0000, 0x0a930000, 0x93930000,
+    0x00ab0000, 0x51ab0000, 0x072c0000, 0xcb2c0000,
+    0x0b820000, 0x71820000, 0x0bf90000, 0x66f90000,
+    0x052d0000, 0xbc2d0000, 0x0ac40000, 0x16c40000,
+    0x05ed0000, 0xfced0000, 0x01670000, 0xc6670000,
+    0x02f60000, 0x84f60000, 0x05a10000, 0xd8a10000
+};
+
+/* Number-Theoretic Transform.
+ *
+ * Output is reduced as in mlkem_ntt() in wc_mlkem_poly.c.
+ *
+ * @param  [in, out]  r  Polynomial to transform.
+ */
+void mlkem_riscv32_ntt(sword16* r)
+{
+    register sword16*       r_p __asm__ ("a0") = r;
+    register const word32*  z_p __asm__ ("a1") = mlkem_riscv32_ntt_zetas;
+
+    __asm__ __volatile__ (
+        "li     " CC_Q ", 3329\n\t"
+
+        /* len = 128,64: r[j + 32 * i] for j = 0..31 */
+        LOAD_ZETAS3("a1")
+        "mv     a2, a0\n\t"
+        "addi   a3, a0, 64\n\t"
+    "1:\n\t"
+        LOAD8(0, 64, 128, 192, 256, 320, 384, 448)
+        MONT_BFLY(CC_R0, CC_R4, "s1", "s2")
+        MONT_BFLY(CC_R1, CC_R5, "s1", "s2")
+        MONT_BFLY(CC_R2, CC_R6, "s1", "s2")
+        MONT_BFLY(CC_R3, CC_R7, "s1", "s2")
+        MONT_BFLY(CC_R0, CC_R2, "s3", "s4")
+        MONT_BFLY(CC_R1, CC_R3, "s3", "s4")
+        MONT_BFLY(CC_R4, CC_R6, "s5", "s6")
+        MONT_BFLY(CC_R5, CC_R7, "s5", "s6")
+        STORE8(0, 64, 128, 192, 256, 320, 384, 448)
+        "addi   a2, a2, 2\n\t"
+        "bne    a2, a3, 1b\n\t"
+
+        /* len = 32,16,8: r[j + i + 8 * k] for i = 0..7 */
+        "addi   s9, a1, 24\n\t"
+        "mv     s11, a0\n\t"
+        "addi   s10, a0, 512\n\t"
+    "2:\n\t"
+        LOAD_ZETAS3("s9")
+        "mv     a2, s11\n\t"
+        "addi   a3, s11, 16\n\t"
+    "3:\n\t"
+        LOAD8(0, 16, 32, 48, 64, 80, 96, 112)
+        MONT_BFLY(CC_R0, CC_R4, "s1", "s2")
+        MONT_BFLY(CC_R1, CC_R5, "s1", "s2")
+        MONT_BFLY(CC_R2, CC_R6, "s1", "s2")
+        MONT_BFLY(CC_R3, CC_R7, "s1", "s2")
+        MONT_BFLY(CC_R0, CC_R2, "s3", "s4")
+        MONT_BFLY(CC_R1, CC_R3, "s3", "s4")
+        MONT_BFLY(CC_R4, CC_R6, "s5", "s6")
+        MONT_BFLY(CC_R5, CC_R7, "s5", "s6")
+        LOAD_ZETA("s9", 24)
+        MONT_BFLY(CC_R0, CC_R1, "s7", "s8")
+        LOAD_ZETA("s9", 32)
+        MONT_BFLY(CC_R2, CC_R3, "s7", "s8")
+        LOAD_ZETA("s9", 40)
+        MONT_BFLY(CC_R4, CC_R5, "s7", "s8")
+        LOAD_ZETA("s9", 48)
+        MONT_BFLY(CC_R6, CC_R7, "s7", "s8")
+        STORE8(0, 16, 32, 48, 64, 80, 96, 112)
+        "addi   a2, a2, 2\n\t"
+        "bne    a2, a3, 3b\n\t"
+        "addi   s9, s9, 56\n\t"
+        "addi   s11, s11, 128\n\t"
+        "bne    s11, s10, 2b\n\t"
+
+        /* len = 4,2 and final reduction: r[j + i] for i = 0..7 */
+        "li     " CC_V ", 20159\n\t"
+        "mv     a2, a0\n\t"
+        "addi   a3, a0, 512\n\t"
+    "4:\n\t"
+        LOAD_ZETAS3("s9")
+        LOAD8(0, 2, 4, 6, 8, 10, 12, 14)
+        MONT_BFLY(CC_R0, CC_R4, "s1", "s2")
+        MONT_BFLY(CC_R1, CC_R5, "s1", "s2")
+        MONT_BFLY(CC_R2, CC_R6, "s1", "s2")
+        MONT_BFLY(CC_R3, CC_R7, "s1", "s2")
+        MONT_BFLY(CC_R0, CC_R2, "s3", "s4")
+        MONT_BFLY(CC_R1, CC_R3, "s3", "s4")
+        MONT_BFLY(CC_R4, CC_R6, "s5", "s6")
+        MONT_BFLY(CC_R5, CC_R7, "s5", "s6")
+        BARRETT_RED(CC_R0)
+        BARRETT_RED(CC_R1)
+        BARRETT_RED(CC_R2)
+        BARRETT_RED(CC_R3)
+        BARRETT_RED(CC_R4)
+        BARRETT_RED(CC_R5)
+        BARRETT_RED(CC_R6)
+        BARRETT_RED(CC_R7)
+        STORE8(0, 2, 4, 6, 8, 10, 12, 14)
+        "addi   s9, s9, 24\n\t"
+        "addi   a2, a2, 16\n\t"
+        "bne    a2, a3, 4b\n\t"
+        :
+        : [r] "r" (r_p), [z] "r" (z_p)
+        : "memory", "t0", "t1", "t2", "t3", "t4", "t5", "t6",
+          "s1", "s2", "s3", "s4", "s5", "s6", "s7", "s8", "s9", "s10", "s11",
+          "a2", "a3", "a4", "a5", "a6", "a7"
+    );
+}
+
+/* Inverse Number-Theoretic Transform.
+ *
+ * Sums are Barrett reduced after the len 8 and len 64 layers as in
+ * mlkem_invntt() in wc_mlkem_poly.c.
+ *
+ * @param  [in, out]  r  Polynomial to transform.
+ */
+void mlkem_riscv32_invntt(sword16* r)
+{
+    register sword16*       r_p __asm__ ("a0") = r;
+    register const word32*  z_p __asm__ ("a1") = mlkem_riscv32_invntt_zetas;
+
+    __asm__ __volatile__ (
+        "li     " CC_Q ", 3329\n\t"
+        "li     " CC_V ", 20159\n\t"
+
+        /* len = 2,4: r[j + i] for i = 0..7 */
+        "mv     s9, a1\n\t"
+        "mv     a2, a0\n\t"
+        "addi   a3, a0, 512\n\t"
+    "1:\n\t"
+        LOAD_ZETAS3("s9")
+        LOAD8(0, 2, 4, 6, 8, 10, 12, 14)
+        MONT_INV_BFLY(CC_R0, CC_R2, "s1", "s2")
+        MONT_INV_BFLY(CC_R1, CC_R3, "s1", "s2")
+        MONT_INV_BFLY(CC_R4, CC_R6, "s3", "s4")
+        MONT_INV_BFLY(CC_R5, CC_R7, "s3", "s4")
+        MONT_INV_BFLY(CC_R0, CC_R4, "s5", "s6")
+        MONT_INV_BFLY(CC_R1, CC_R5, "s5", "s6")
+        MONT_INV_BFLY(CC_R2, CC_R6, "s5", "s6")
+        MONT_INV_BFLY(CC_R3, CC_R7, "s5", "s6")
+        STORE8(0, 2, 4, 6, 8, 10, 12, 14)
+        "addi   s9, s9, 24\n\t"
+        "addi   a2, a2, 16\n\t"
+        "bne    a2, a3, 1b\n\t"
+
+        /* len = 8,16,32: r[j + i + 8 * k] for i = 0..7 */
+        "mv     s11, a0\n\t"
+        "addi   s10, a0, 512\n\t"
+    "2:\n\t"
+        LOAD_ZETAS3("s9")
+        "mv     a2, s11\n\t"
+        "addi   a3, s11, 16\n\t"
+    "3:\n\t"
+        LOAD8(0, 16, 32, 48, 64, 80, 96, 112)
+        LOAD_ZETA("s9", 24)
+        MONT_INV_BFLY(CC_R0, CC_R1, "s7", "s8")
+        BARRETT_RED(CC_R0)
+        LOAD_ZETA("s9", 32)
+        MONT_INV_BFLY(CC_R2, CC_R3, "s7", "s8")
+        BARRETT_RED(CC_R2)
+        LOAD_ZETA("s9", 40)
+        MONT_INV_BFLY(CC_R4, CC_R5, "s7", "s8")
+        BARRETT_RED(CC_R4)
+        LOAD_ZETA("s9", 48)
+        MONT_INV_BFLY(CC_R6, CC_R7, "s7", "s8")
+        BARRETT_RED(CC_R6)
+        MONT_INV_BFLY(CC_R0, CC_R2, "s1", "s2")
+        MONT_INV_BFLY(CC_R1, CC_R3, "s1", "s2")
+        MONT_INV_BFLY(CC_R4, CC_R6, "s3", "s4")
+        MONT_INV_BFLY(CC_R5, CC_R7, "s3", "s4")
+        MONT_INV_BFLY(CC_R0, CC_R4, "s5", "s6")
+        MONT_INV_BFLY(CC_R1, CC_R5, "s5", "s6")
+        MONT_INV_BFLY(CC_R2, CC_R6, "s5", "s6")
+        MONT_INV_BFLY(CC_R3, CC_R7, "s5", "s6")
+        STORE8(0, 16, 32, 48, 64, 80, 96, 112)
+        "addi   a2, a2, 2\n\t"
+        "bne    a2, a3, 3b\n\t"
+        "addi   s9, s9, 56\n\t"
+        "addi   s11, s11, 128\n\t"
+        "bne    s11, s10, 2b\n\t"
+
+        /* len = 64,128 and final factor: r[j + 32 * i] for j = 0..31 */
+        LOAD_ZETAS3("s9")
+        LOAD_ZETA("s9", 24)
+        "mv     a2, a0\n\t"
+        "addi   a3, a0, 64\n\t"
+    "4:\n\t"
+        LOAD8(0, 64, 128, 192, 256, 320, 384, 448)
+        MONT_INV_BFLY(CC_R0, CC_R2, "s1", "s2")
+        BARRETT_RED(CC_R0)
+        MONT_INV_BFLY(CC_R1, CC_R3, "s1", "s2")
+        BARRETT_RED(CC_R1)
+        MONT_INV_BFLY(CC_R4, CC_R6, "s3", "s4")
+        BARRETT_RED(CC_R4)
+        MONT_INV_BFLY(CC_R5, CC_R7, "s3", "s4")
+        BARRETT_RED(CC_R5)
+        MONT_INV_BFLY(CC_R0, CC_R4, "s5", "s6")
+        MONT_INV_BFLY(CC_R1, CC_R5, "s5", "s6")
+        MONT_INV_BFLY(CC_R2, CC_R6, "s5", "s6")
+        MONT_INV_BFLY(CC_R3, CC_R7, "s5", "s6")
+        MONT_MUL(CC_R0, "s7", "s8")
+        MONT_MUL(CC_R1, "s7", "s8")
+        MONT_MUL(CC_R2, "s7", "s8")
+        MONT_MUL(CC_R3, "s7", "s8")
+        MONT_MUL(CC_R4, "s7", "s8")
+        MONT_MUL(CC_R5, "s7", "s8")
+        MONT_MUL(CC_R6, "s7", "s8")
+        MONT_MUL(CC_R7, "s7", "s8")
+        STORE8(0, 64, 128, 192, 256, 320, 384, 448)
+        "addi   a2, a2, 2\n\t"
+        "bne    a2, a3, 4b\n\t"
+        :
+        : [r] "r" (r_p), [z] "r" (z_p)
+        : "memory", "t0", "t1", "t2", "t3", "t4", "t5", "t6",
+          "s1", "s2", "s3", "s4", "s5", "s6", "s7", "s8", "s9", "s10", "s11",
+          "a2", "a3", "a4", "a5", "a6", "a7"
+    );
+}
+
+/* zetas[64..127] of wc_mlkem_poly.c, one per four coefficients of the base
+ * multiplication. */
+static const sword16 mlkem_riscv32_basemul_zetas[64] = {
+     2226,   430,   555,   843,  2078,   871,  1550,   105,
+      422,   587,   177,  3094,  3038,  2869,  1574,  1653,
+     3083,   778,  1159,  3182,  2552,  1483,  2727,  1119,
+     1739,   644,  2457,   349,   418,   329,  3173,  3254,
+      817,  1097,   603,   610,  1322,  2044,  1864,   384,
+     2114,  3193,  1218,  1994,  2455,   220,  2142,  1670,
+     2144,  1799,  2051,   794,  1819,  2475,  2459,   478,
+     3221,  3021,   996,   991,   958,  1869,  1522,  1628
+};
+
+/* r = MONT_RED(p), MLKEM_QINV << 16 in a5 and q in a6. */
+#define BASEMUL_RED(p)                                                      \
+        "mul    t0, " p ", a5\n\t"                                          \
+        "mulh   t0, t0, a6\n\t"                                             \
+        "srai   " p ", " p ", 16\n\t"                                       \
+        "sub    " p ", " p ", t0\n\t"
+
+/* Product of the degree-one polynomials at byte offset o of a1 and a2 with
+ * respect to X^2 - zeta, zeta in z. c0 into t5 and c1 into t1.
+ *   c0 = a0.b0 + a1.b1.zeta
+ *   c1 = a0.b1 + a1.b0
+ */
+#define BASEMUL(o, z)                                                       \
+        "lh     t1, " #o "(a1)\n\t"                                         \
+        "lh     t2, " #o "+2(a1)\n\t"                                       \
+        "lh     t4, " #o "+2(a2)\n\t"                                       \
+        "lh     t3, " #o "(a2)\n\t"                                         \
+        "mul    t5, t2, t4\n\t"                                             \
+        BASEMUL_RED("t5")                                                   \
+        "mul    t5, t5, " z "\n\t"                                          \
+        "mul    t0, t1, t3\n\t"                                             \
+        "add    t5, t5, t0\n\t"                                             \
+        BASEMUL_RED("t5")                                                   \
+        "mul    t1, t1, t4\n\t"                                             \
+        "mul    t2, t2, t3\n\t"                                             \
+        "add    t1, t1, t2\n\t"                                             \
+        BASEMUL_RED("t1")
+
+/* Store c0, c1 at byte offset o of a0. */
+#define BASEMUL_STORE(o)                                                    \
+        "sh     t5, " #o "(a0)\n\t"                                         \
+        "sh     t1, " #o "+2(a0)\n\t"
+
+/* Add c0, c1 to the coefficients at byte offset o of a0. */
+#define BASEMUL_ADD(o)                                                      \
+        "lh     t2, " #o "(a0)\n\t"                                         \
+        "lh     t3, " #o "+2(a0)\n\t"                                       \
+        "add    t5, t5, t2\n\t"                                             \
+        "add    t1, t1, t3\n\t"                                             \
+        BASEMUL_STORE(o)
+
+/* Multiply two polynomials in NTT domain. r = a * b.
+ *
+ * @param  [out]  r  Result polynomial.
+ * @param  [in]   a  First polynomial multiplier.
+ * @param  [in]   b  Second polynomial multiplier.
+ */
+void mlkem_riscv32_basemul_mont(sword16* r, const sword16* a,
+    const sword16* b)
+{
+    register sword16*       r_p __asm__ ("a0") = r;
+    register const sword16* a_p __asm__ ("a1") = a;
+    register const sword16* b_p __asm__ ("a2") = b;
+    register const sword16* z_p __asm__ ("a3") = mlkem_riscv32_basemul_zetas;
+
+    __asm__ __volatile__ (
+        "lui    a5, 0xf3010\n\t"
+        "li     a6, 3329\n\t"
+        "addi   a4, a0, 512\n\t"
+    "1:\n\t"
+        "lh     t6, 0(a3)\n\t"
+        "lh     a7, 2(a3)\n\t"
+        BASEMUL(0, "t6")
+        BASEMUL_STORE(0)
+        "neg    t6, t6\n\t"
+        BASEMUL(4, "t6")
+        BASEMUL_STORE(4)
+        BASEMUL(8, "a7")
+        BASEMUL_STORE(8)
+        "neg    a7, a7\n\t"
+        BASEMUL(12, "a7")
+        BASEMUL_STORE(12)
+        "addi   a0, a0, 16\n\t"
+        "addi   a1, a1, 16\n\t"
+        "addi   a2, a2, 16\n\t"
+        "addi   a3, a3, 4\n\t"
+        "bne    a0, a4, 1b\n\t"
+        : [r] "+r" (r_p), [a] "+r" (a_p), [b] "+r" (b_p), [z] "+r" (z_p)
+        :
+        : "memory", "t0", "t1", "t2", "t3", "t4", "t5", "t6",
+          "a4", "a5", "a6", "a7"
+    );
+}
+
+/* Multiply two polynomials in NTT domain and add to result. r += a * b.
+ *
+ * @param  [in, out]  r  Result polynomial.
+ * @param  [in]       a  First polynomial multiplier.
+ * @param  [in]       b  Second polynomial multiplier.
+ */
+void mlkem_riscv32_basemul_mont_add(sword16* r, const sword16* a,
+    const sword16* b)
+{
+    register sword16*       r_p __asm__ ("a0") = r;
+    register const sword16* a_p __asm__ ("a1") = a;
+    register const sword16* b_p __asm__ ("a2") = b;
+    register const sword16* z_p __asm__ ("a3") = mlkem_riscv32_basemul_zetas;
+
+    __asm__ __volatile__ (
+        "lui    a5, 0xf3010\n\t"
+        "li     a6, 3329\n\t"
+        "addi   a4, a0, 512\n\t"
+    "1:\n\t"
+        "lh     t6, 0(a3)\n\t"
+        "lh     a7, 2(a3)\n\t"
+        BASEMUL(0, "t6")
+        BASEMUL_ADD(0)
+        "neg    t6, t6\n\t"
+        BASEMUL(4, "t6")
+        BASEMUL_ADD(4)
+        BASEMUL(8, "a7")
+        BASEMUL_ADD(8)
+        "neg    a7, a7\n\t"
+        BASEMUL(12, "a7")
+        BASEMUL_ADD(12)
+        "addi   a0, a0, 16\n\t"
+        "addi   a1, a1, 16\n\t"
+        "addi   a2, a2, 16\n\t"
+        "addi   a3, a3, 4\n\t"
+        "bne    a0, a4, 1b\n\t"
+        : [r] "+r" (r_p), [a] "+r" (a_p), [b] "+r" (b_p), [z] "+r" (z_p)
+        :
+        : "memory", "t0", "t1", "t2", "t3", "t4", "t5", "t6",
+          "a4", "a5", "a6", "a7"
+    );
+}
+
+#endif /* USE_RISCV32_MLKEM_SPEEDUP */
+#endif /* WOLFSSL_WC_MLKEM */
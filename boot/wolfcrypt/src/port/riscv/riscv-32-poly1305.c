@@ -0,0 +1,267 @@
+/* riscv-32-poly1305.c
+ *
+ * Copyright (C) 2006-2025 wolfSSL Inc.
+ *
+ * This file is part of wolfSSL.
+ *
+ * wolfSSL is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * wolfSSL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
+ */
+
+#include <wolfssl/wolfcrypt/libwolfssl_sources.h>
+
+/*
+ * Based on the public domain implementations by Andrew Moon
+ * and Daniel J. Bernstein
+ */
+
+/* Poly1305 block function for RV32IM. Same 5 x 26-bit limb representation as
+ * the 32-bit C code in poly1305.c, so key setup and finalization are shared.
+ * r, 5*r and h are register resident across blocks and each 26x26-bit
+ * product is accumulated as a 64-bit value with mul/mulhu.
+ */
+
+#ifdef HAVE_POLY1305
+
+#include <wolfssl/wolfcrypt/poly1305.h>
+
+#ifdef USE_RISCV32_POLY1305_SPEEDUP
+
+/* Limb and key register assignment. */
+#define CC_R0   "s1"
+#define CC_R1   "s2"
+#define CC_R2   "s3"
+#define CC_R3   "s4"
+#define CC_R4   "s5"
+#define CC_S1   "s6"
+#define CC_S2   "s7"
+#define CC_S3   "s8"
+#define CC_S4   "s9"
+#define CC_H0   "s10"
+#define CC_H1   "s11"
+#define CC_H2   "a4"
+#define CC_H3   "a5"
+#define CC_H4   "a6"
+
+/* d (t4:t3) = h * r */
+#define MUL_FIRST(h, r)                                                     \
+        "mul    t3, " h ", " r "\n\t"                                       \
+        "mulhu  t4, " h ", " r "\n\t"
+
+/* d (t4:t3) += h * r */
+#define MUL_ADD(h, r)                                                       \
+        "mul    t5, " h ", " r "\n\t"                                       \
+        "mulhu  t6, " h ", " r "\n\t"                                       \
+        "add    t3, t3, t5\n\t"                                             \
+        "sltu   t5, t3, t5\n\t"                                             \
+        "add    t4, t4, t6\n\t"                                             \
+        "add    t4, t4, t5\n\t"
+
+/* d (t4:t3) += c (t5) */
+#define ADD_CARRY()                                                         \
+        "add    t3, t3, t5\n\t"                                             \
+        "sltu   t5, t3, t5\n\t"                                             \
+        "add    t4, t4, t5\n\t"
+
+/* n = d & 0x3ffffff; c (t5) = d >> 26 */
+#define REDUCE(n)                                                           \
+        "slli   " n ", t3, 6\n\t"                                           \
+        "srli   " n ", " n ", 6\n\t"                                        \
+        "srli   t5, t3, 26\n\t"                                             \
+        "slli   t6, t4, 6\n\t"                                              \
+        "or     t5, t5, t6\n\t"
+
+/* tN = little-endian word at m + o */
+#define LOAD_BYTES(t, o0, o1, o2, o3)                                       \
+        "lbu    " t ", " #o0 "(a1)\n\t"                                     \
+        "lbu    t4, " #o1 "(a1)\n\t"                                        \
+        "lbu    t5, " #o2 "(a1)\n\t"                                        \
+        "lbu    t6, " #o3 "(a1)\n\t"                                        \
+        "slli   t4, t4, 8\n\t"                                              \
+        "slli   t5, t5, 16\n\t"                                             \
+        "slli   t6, t6, 24\n\t"                                             \
+        "or     " t ", " t ", t4\n\t"                                       \
+        "or     t5, t5, t6\n\t"                                             \
+        "or     " t ", " t ", t5\n\t"
+
+/*
+This local function operates on a message with a given number of bytes
+with a given ctx pointer to a Poly1305 structure.
+*/
+void poly1305_blocks_riscv32(Poly1305* ctx, const unsigned char *m,
+    size_t bytes)
+{
+    word32 r[5];
+    word32 s[4];
+    word32 h[5];
+
+    r[0] = ctx->r[0];
+    r[1] = ctx->r[1];
+    r[2] = ctx->r[2];
+    r[3] = ctx->r[3];
+    r[4] = ctx->r[4];
+    s[0] = r[1] * 5;
+    s[1] = r[2] * 5;
+    s[2] = r[3] * 5;
+    s[3] = r[4] * 5;
+    h[0] = ctx->h[0];
+    h[1] = ctx->h[1];
+    h[2] = ctx->h[2];
+    h[3] = ctx->h[3];
+    h[4] = ctx->h[4];
+
+    {
+        register const unsigned char* m_p   __asm__ ("a1") = m;
+        register const unsigned char* end_p __asm__ ("a2") =
+            m + (bytes & ~((size_t)POLY1305_BLOCK_SIZE - 1));
+        register word32 hibit __asm__ ("a3") =
+            (ctx->finished) ? 0 : ((word32)1 << 24); /* 1 << 128 */
+        register word32 r0 __asm__ ("s1")  = r[0];
+        register word32 r1 __asm__ ("s2")  = r[1];
+        register word32 r2 __asm__ ("s3")  = r[2];
+        register word32 r3 __asm__ ("s4")  = r[3];
+        register word32 r4 __asm__ ("s5")  = r[4];
+        register word32 s1 __asm__ ("s6")  = s[0];
+        register word32 s2 __asm__ ("s7")  = s[1];
+        register word32 s3 __asm__ ("s8")  = s[2];
+        register word32 s4 __asm__ ("s9")  = s[3];
+        register word32 h0 __asm__ ("s10") = h[0];
+        register word32 h1 __asm__ ("s11") = h[1];
+        register word32 h2 __asm__ ("a4")  = h[2];
+        register word32 h3 __asm__ ("a5")  = h[3];
+        register word32 h4 __asm__ ("a6")  = h[4];
+
+        __asm__ __volatile__ (
+            "beq    a1, a2, 4f\n\t"
+        "1:\n\t"
+            /* Message block into t0-t3 */
+            "andi   t0, a1, 3\n\t"
+            "bnez   t0, 2f\n\t"
+            "lw     t0, 0(a1)\n\t"
+            "lw     t1, 4(a1)\n\t"
+            "lw     t2, 8(a1)\n\t"
+            "lw     t3, 12(a1)\n\t"
+            "j      3f\n\t"
+        "2:\n\t"
+            LOAD_BYTES("t0",  0,  1,  2,  3)
+            LOAD_BYTES("t1",  4,  5,  6,  7)
+            LOAD_BYTES("t2",  8,  9, 10, 11)
+            LOAD_BYTES("t3", 12, 13, 14, 15)
+        "3:\n\t"
+            /* h += m[i] */
+            "li     t4, 0x3ffffff\n\t"
+            "and    t5, t0, t4\n\t"
+            "add    " CC_H0 ", " CC_H0 ", t5\n\t"
+            "srli   t5, t0, 26\n\t"
+            "slli   t6, t1, 6\n\t"
+            "or     t5, t5, t6\n\t"
+            "and    t5, t5, t4\n\t"
+            "add    " CC_H1 ", " CC_H1 ", t5\n\t"
+            "srli   t5, t1, 20\n\t"
+            "slli   t6, t2, 12\n\t"
+            "or     t5, t5, t6\n\t"
+            "and    t5, t5, t4\n\t"
+            "add    " CC_H2 ", " CC_H2 ", t5\n\t"
+            "srli   t5, t2, 14\n\t"
+            "slli   t6, t3, 18\n\t"
+            "or     t5, t5, t6\n\t"
+            "and    t5, t5, t4\n\t"
+            "add    " CC_H3 ", " CC_H3 ", t5\n\t"
+            "srli   t5, t3, 8\n\t"
+            "or     t5, t5, a3\n\t"
+            "add    " CC_H4 ", " CC_H4 ", t5\n\t"
+
+            /* h *= r, (partial) h %= p
+             * Each d is reduced as soon as it is complete and its carry
+             * starts the next one. New limbs go to a7, t0-t2 until the
+             * old h is no longer needed. */
+            MUL_FIRST(CC_H0, CC_R0)
+            MUL_ADD(CC_H1, CC_S4)
+            MUL_ADD(CC_H2, CC_S3)
+            MUL_ADD(CC_H3, CC_S2)
+            MUL_ADD(CC_H4, CC_S1)
+            REDUCE("a7")
+
+            MUL_FIRST(CC_H0, CC_R1)
+            ADD_CARRY()
+            MUL_ADD(CC_H1, CC_R0)
+            MUL_ADD(CC_H2, CC_S4)
+            MUL_ADD(CC_H3, CC_S3)
+            MUL_ADD(CC_H4, CC_S2)
+            REDUCE("t0")
+
+            MUL_FIRST(CC_H0, CC_R2)
+            ADD_CARRY()
+            MUL_ADD(CC_H1, CC_R1)
+            MUL_ADD(CC_H2, CC_R0)
+            MUL_ADD(CC_H3, CC_S4)
+            MUL_ADD(CC_H4, CC_S3)
+            REDUCE("t1")
+
+            MUL_FIRST(CC_H0, CC_R3)
+            ADD_CARRY()
+            MUL_ADD(CC_H1, CC_R2)
+            MUL_ADD(CC_H2, CC_R1)
+            MUL_ADD(CC_H3, CC_R0)
+            MUL_ADD(CC_H4, CC_S4)
+            REDUCE("t2")
+
+            MUL_FIRST(CC_H0, CC_R4)
+            ADD_CARRY()
+            MUL_ADD(CC_H1, CC_R3)
+            MUL_ADD(CC_H2, CC_R2)
+            MUL_ADD(CC_H3, CC_R1)
+            MUL_ADD(CC_H4, CC_R0)
+            REDUCE(CC_H4)
+
+            /* h0 += c * 5; c = h0 >> 26; h0 &= 0x3ffffff; h1 += c */
+            "slli   t6, t5, 2\n\t"
+            "add    t5, t5, t6\n\t"
+            "add    " CC_H0 ", a7, t5\n\t"
+            "srli   t5, " CC_H0 ", 26\n\t"
+            "slli   " CC_H0 ", " CC_H0 ", 6\n\t"
+            "srli   " CC_H0 ", " CC_H0 ", 6\n\t"
+            "add    " CC_H1 ", t0, t5\n\t"
+            "mv     " CC_H2 ", t1\n\t"
+            "mv     " CC_H3 ", t2\n\t"
+
+            "addi   a1, a1, 16\n\t"
+            "bne    a1, a2, 1b\n\t"
+        "4:\n\t"
+            : [m] "+r" (m_p),
+              [h0] "+r" (h0), [h1] "+r" (h1), [h2] "+r" (h2), [h3] "+r" (h3),
+              [h4] "+r" (h4)
+            : [end] "r" (end_p), [hibit] "r" (hibit),
+              [r0] "r" (r0), [r1] "r" (r1), [r2] "r" (r2), [r3] "r" (r3),
+              [r4] "r" (r4),
+              [s1] "r" (s1), [s2] "r" (s2), [s3] "r" (s3), [s4] "r" (s4)
+            : "memory", "t0", "t1", "t2", "t3", "t4", "t5", "t6", "a7"
+        );
+
+        h[0] = h0;
+        h[1] = h1;
+        h[2] = h2;
+        h[3] = h3;
+        h[4] = h4;
+    }
+
+    ctx->h[0] = h[0];
+    ctx->h[1] = h[1];
+    ctx->h[2] = h[2];
+    ctx->h[3] = h[3];
+    ctx->h[4] = h[4];
+}
+
+#endif /* USE_RISCV32_POLY1305_SPEEDUP */
+#endif /* HAVE_POLY1305 */
@@ -0,0 +1,226 @@
+/* riscv-32-sha3.c
+ *
+ * Copyright (C) 2006-2025 wolfSSL Inc.
+ *
+ * This file is part of wolfSSL.
+ *
+ * wolfSSL is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * wolfSSL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
+ */
+
+#include <wolfssl/wolfcrypt/libwolfssl_sources.h>
+
+/* Keccak-f[1600] for RV32 using bit-interleaved lanes.
+ *
+ * Each 64-bit lane is held as two 32-bit words: the even numbered bits and
+ * the odd numbered bits. A 64-bit rotate then becomes two 32-bit rotates
+ * (swapping the halves for odd amounts) instead of shifting register pairs.
+ * When the core has Zbb or Zbkb the compiler turns ROTL32 into rori.
+ *
+ * BlockSha3() keeps the wolfSSL interface: the state is converted to the
+ * interleaved form on entry and back on exit. Theta's D is folded into the
+ * rho/pi lane cycle so the state is only walked three times per round.
+ */
+
+#if defined(WOLFSSL_RISCV32_ASM) && !defined(WC_SHA3_NO_ASM)
+#if defined(WOLFSSL_SHA3) && !defined(WOLFSSL_XILINX_CRYPT) && \
+    !defined(WOLFSSL_AFALG_XILINX_SHA3)
+
+#include <wolfssl/wolfcrypt/sha3.h>
+
+/* Round constants with the even bits in the first and odd bits in the second
+ * word of each pair. */
+static const word32 hash_keccak_r_bi[48] =
+{
+    0x00000001U, 0x00000000U, 0x00000000U, 0x00000089U,
+    0x00000000U, 0x8000008bU, 0x00000000U, 0x80008080U,
+    0x00000001U, 0x0000008bU, 0x00000001U, 0x00008000U,
+    0x00000001U, 0x80008088U, 0x00000001U, 0x80000082U,
+    0x00000000U, 0x0000000bU, 0x00000000U, 0x0000000aU,
+    0x00000001U, 0x00008082U, 0x00000000U, 0x00008003U,
+    0x00000001U, 0x0000808bU, 0x00000001U, 0x8000000bU,
+    0x00000001U, 0x8000008aU, 0x00000001U, 0x80000081U,
+    0x00000000U, 0x80000081U, 0x00000000U, 0x80000008U,
+    0x00000000U, 0x00000083U, 0x00000000U, 0x80008003U,
+    0x00000001U, 0x80008088U, 0x00000000U, 0x80000088U,
+    0x00000001U, 0x00008000U, 0x00000000U, 0x80008082U
+};
+
+/* Rotate left, n is a constant in [0, 31]. */
+#define ROTL32(a, n)    (((a) << (n)) | ((a) >> ((32 - (n)) & 31)))
+
+/* Even and odd word of lane i. */
+#define E(i)            st[2 * (i)]
+#define O(i)            st[2 * (i) + 1]
+
+/* Move the bits of x that are two apart selected by m to be one apart. */
+#define BIT_SWAP(x, m, n)                                   \
+    t = ((x) ^ ((x) >> (n))) & (m);                         \
+    (x) ^= t ^ (t << (n))
+
+/* Split a 64-bit lane into even and odd bit words. */
+#define TO_BIT_INTERLEAVING(e, o, lo, hi)                   \
+    BIT_SWAP(lo, 0x22222222U, 1);                           \
+    BIT_SWAP(lo, 0x0c0c0c0cU, 2);                           \
+    BIT_SWAP(lo, 0x00f000f0U, 4);                           \
+    BIT_SWAP(lo, 0x0000ff00U, 8);                           \
+    BIT_SWAP(hi, 0x22222222U, 1);                           \
+    BIT_SWAP(hi, 0x0c0c0c0cU, 2);                           \
+    BIT_SWAP(hi, 0x00f000f0U, 4);                           \
+    BIT_SWAP(hi, 0x0000ff00U, 8);                           \
+    (e) = (lo & 0x0000ffffU) | (hi << 16);                  \
+    (o) = (lo >> 16) | (hi & 0xffff0000U)
+
+/* Join even and odd bit words back into a 64-bit lane. */
+#define FROM_BIT_INTERLEAVING(lo, hi, e, o)                 \
+    lo = ((e) & 0x0000ffffU) | ((o) << 16);                 \
+    hi = ((e) >> 16) | ((o) & 0xffff0000U);                 \
+    BIT_SWAP(lo, 0x0000ff00U, 8);                           \
+    BIT_SWAP(lo, 0x00f000f0U, 4);                           \
+    BIT_SWAP(lo, 0x0c0c0c0cU, 2);                           \
+    BIT_SWAP(lo, 0x22222222U, 1);                           \
+    BIT_SWAP(hi, 0x0000ff00U, 8);                           \
+    BIT_SWAP(hi, 0x00f000f0U, 4);                           \
+    BIT_SWAP(hi, 0x0c0c0c0cU, 2);                           \
+    BIT_SWAP(hi, 0x22222222U, 1)
+
+/* (re, ro) = (ie, io) <<< r as a 64-bit lane. */
+#define ROT_BI(re, ro, ie, io, r)                           \
+    if (((r) & 1) == 0) {                                   \
+        (re) = ROTL32(ie, (r) / 2);                         \
+        (ro) = ROTL32(io, (r) / 2);                         \
+    }                                                       \
+    else {                                                  \
+        (re) = ROTL32(io, ((r) + 1) / 2);                   \
+        (ro) = ROTL32(ie, (r) / 2);                         \
+    }
+
+/* Theta's D for column x from the column parities. */
+#define THETA_D(x, xm1, xp1)                                \
+    de##x = ce##xm1 ^ ROTL32(co##xp1, 1);                   \
+    do##x = co##xm1 ^ ce##xp1
+
+/* Column parity of x. */
+#define THETA_C(x)                                          \
+    ce##x = E(x) ^ E(x + 5) ^ E(x + 10) ^ E(x + 15) ^ E(x + 20); \
+    co##x = O(x) ^ O(x + 5) ^ O(x + 10) ^ O(x + 15) ^ O(x + 20)
+
+/* Next step of the pi lane cycle: lane j gets the previous lane rotated by r
+ * and theta is applied to the lane taken out. */
+#define RHO_PI(j, x, r)                                     \
+    be = E(j) ^ de##x;                                      \
+    bo = O(j) ^ do##x;                                      \
+    ROT_BI(E(j), O(j), te, to, r)                           \
+    te = be;                                                \
+    to = bo
+
+/* chi on row y for one of the bit words. */
+#define CHI(L, y)                                           \
+    b0 = L(y + 0); b1 = L(y + 1); b2 = L(y + 2); b3 = L(y + 3); b4 = L(y + 4); \
+    L(y + 0) = b0 ^ (~b1 & b2);                             \
+    L(y + 1) = b1 ^ (~b2 & b3);                             \
+    L(y + 2) = b2 ^ (~b3 & b4);                             \
+    L(y + 3) = b3 ^ (~b4 & b0);                             \
+    L(y + 4) = b4 ^ (~b0 & b1)
+
+/* The block operation performed on the state.
+ *
+ * s  The state.
+ */
+void BlockSha3(word64* s)
+{
+    word32 st[50];
+    word32 ce0, ce1, ce2, ce3, ce4;
+    word32 co0, co1, co2, co3, co4;
+    word32 de0, de1, de2, de3, de4;
+    word32 do0, do1, do2, do3, do4;
+    word32 te, to, be, bo;
+    word32 b0, b1, b2, b3, b4;
+    word32 lo, hi, t;
+    int i;
+
+    for (i = 0; i < 25; i++) {
+        lo = (word32)s[i];
+        hi = (word32)(s[i] >> 32);
+        TO_BIT_INTERLEAVING(E(i), O(i), lo, hi);
+    }
+
+    for (i = 0; i < 48; i += 2) {
+        /* theta: column parities and D */
+        THETA_C(0);
+        THETA_C(1);
+        THETA_C(2);
+        THETA_C(3);
+        THETA_C(4);
+        THETA_D(0, 4, 1);
+        THETA_D(1, 0, 2);
+        THETA_D(2, 1, 3);
+        THETA_D(3, 2, 4);
+        THETA_D(4, 3, 0);
+
+        /* theta applied while walking rho and pi */
+        E(0) ^= de0;
+        O(0) ^= do0;
+        te = E(1) ^ de1;
+        to = O(1) ^ do1;
+        RHO_PI(10, 0,  1);
+        RHO_PI( 7, 2,  3);
+        RHO_PI(11, 1,  6);
+        RHO_PI(17, 2, 10);
+        RHO_PI(18, 3, 15);
+        RHO_PI( 3, 3, 21);
+        RHO_PI( 5, 0, 28);
+        RHO_PI(16, 1, 36);
+        RHO_PI( 8, 3, 45);
+        RHO_PI(21, 1, 55);
+        RHO_PI(24, 4,  2);
+        RHO_PI( 4, 4, 14);
+        RHO_PI(15, 0, 27);
+        RHO_PI(23, 3, 41);
+        RHO_PI(19, 4, 56);
+        RHO_PI(13, 3,  8);
+        RHO_PI(12, 2, 25);
+        RHO_PI( 2, 2, 43);
+        RHO_PI(20, 0, 62);
+        RHO_PI(14, 4, 18);
+        RHO_PI(22, 2, 39);
+        RHO_PI( 9, 4, 61);
+        RHO_PI( 6, 1, 20);
+        ROT_BI(E(1), O(1), te, to, 44)
+
+        /* chi */
+        CHI(E,  0);
+        CHI(O,  0);
+        CHI(E,  5);
+        CHI(O,  5);
+        CHI(E, 10);
+        CHI(O, 10);
+        CHI(E, 15);
+        CHI(O, 15);
+        CHI(E, 20);
+        CHI(O, 20);
+
+        /* iota */
+        E(0) ^= hash_keccak_r_bi[i];
+        O(0) ^= hash_keccak_r_bi[i + 1];
+    }
+
+    for (i = 0; i < 25; i++) {
+        FROM_BIT_INTERLEAVING(lo, hi, E(i), O(i));
+        s[i] = ((word64)hi << 32) | lo;
+    }
+}
+
+#endif /* WOLFSSL_SHA3 && !WOLFSSL_XILINX_CRYPT && !WOLFSSL_AFALG_XILINX_SHA3 */
+#endif /* WOLFSSL_RISCV32_ASM && !WC_SHA3_NO_ASM */
@@ -25,6 +25,7 @@
     #undef USE_INTEL_SPEEDUP
     #undef WOLFSSL_ARMASM
     #undef WOLFSSL_RISCV_ASM
+    #undef WOLFSSL_RISCV32_ASM
 #endif
 
 #if defined(WOLFSSL_PSOC6_CRYPTO)
@@ -84,7 +85,9 @@
 #endif
 #endif
 
-#if !defined(WOLFSSL_ARMASM) && !defined(WOLFSSL_RISCV_ASM)
+#if !defined(WOLFSSL_ARMASM) && !defined(WOLFSSL_RISCV_ASM) && \
+    !defined(WOLFSSL_RISCV32_ASM)
+    /* RV32 bit-interleaved BlockSha3 in port/riscv/riscv-32-sha3.c */
 
 #ifdef WOLFSSL_SHA3_SMALL
 /* Rotate a 64-bit value left.
@@ -564,7 +567,7 @@ void BlockSha3(word64* s)
 }
 #endif /* WOLFSSL_SHA3_SMALL */
 #endif /* STM32_HASH_SHA3 */
-#endif /* !WOLFSSL_ARMASM && !WOLFSSL_RISCV_ASM */
+#endif /* !WOLFSSL_ARMASM && !WOLFSSL_RISCV_ASM && !WOLFSSL_RISCV32_ASM */
 
 #if !defined(STM32_HASH_SHA3) && !defined(PSOC6_HASH_SHA3)
 #if defined(BIG_ENDIAN_ORDER)
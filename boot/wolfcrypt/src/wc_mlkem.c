@@ -61,6 +61,21 @@
  *   performing decapsulation.
  *   KyberKey is 8KB larger but decapsulation is significantly faster.
  *   Turn on when performing make key and decapsualtion with same object.
+ *
+ * WOLFSSL_MLKEM_MATRIX_CACHE                                       Default: OFF
+ *   Keeps the matrix A of the last WOLFSSL_MLKEM_MATRIX_CACHE_SZ (default 4)
+ *   public keys
+ *   used in encapsulation, keyed by the public seed. Saves the matrix
+ *   expansion when a peer reuses its key pair.
+ *   Up to 8KB of dynamic memory per entry for ML-KEM-1024, 2KB for ML-KEM-512.
+ *
+ * WOLFSSL_MLKEM_NONBLOCK                                           Default: OFF
+ *   Enable decapsulation in steps with wc_MlKemKey_SetNonBlock().
+ *   Decapsulate returns MP_WOULDBLOCK until the shared secret is known.
+ *   Steps: decrypt, expand matrix A a vector at a time, generate noise,
+ *   re-encrypt a polynomial of u at a time, then v and compare.
+ *   Each call performs one step, or steps until the context's budget of
+ *   cycles is spent when WC_NONBLOCK_CYCLES() is defined.
  */
 
 #include <wolfssl/wolfcrypt/libwolfssl_sources.h>
@@ -90,6 +105,14 @@
         #error "Can't use small memory with assembly optimized code"
     #endif
 #endif
+#if defined(WOLFSSL_MLKEM_MATRIX_CACHE) && \
+    defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM)
+    #error "Can't cache matrices with small memory encapsulation"
+#endif
+#if defined(WOLFSSL_MLKEM_MATRIX_CACHE) && \
+    !defined(WOLFSSL_MLKEM_MATRIX_CACHE_SZ)
+    #define WOLFSSL_MLKEM_MATRIX_CACHE_SZ   4
+#endif
 #if defined(WOLFSSL_MLKEM_CACHE_A)
     #if defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) || \
         defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM)
@@ -296,6 +319,9 @@ int wc_MlKemKey_Init(MlKemKey* key, int type, void* heap, int devId)
         key->devId = devId;
     #endif
         key->flags = 0;
+    #ifdef WOLFSSL_MLKEM_NONBLOCK
+        key->nb = NULL;
+    #endif
 
         /* Zero out all data. */
         XMEMSET(&key->prf, 0, sizeof(key->prf));
@@ -713,8 +739,234 @@ int wc_MlKemKey_SharedSecretSize(MlKemKey* key, word32* len)
     return 0;
 }
 
+#ifdef WOLFSSL_MLKEM_MATRIX_CACHE
+/* Cache of transposed A matrices, as used in encapsulation, keyed by the
+ * public seed rho. A server sees the same rho each time a client reuses its
+ * key pair and a client sees its own rho on every decapsulation. */
+
+/* Matrix cache entry. */
+typedef struct MlKemMatrixCacheEntry {
+    /* Transposed matrix A, k x k polynomials. NULL when entry unused. */
+    sword16* a;
+    /* Number of dimensions of matrix. */
+    unsigned int k;
+    /* Value of the cache clock when last used. */
+    word32 lastUse;
+    /* Public seed the matrix was generated from. */
+    byte seed[WC_ML_KEM_SYM_SZ];
+} MlKemMatrixCacheEntry;
+
+static MlKemMatrixCacheEntry mlkem_matrix_cache[WOLFSSL_MLKEM_MATRIX_CACHE_SZ];
+/* Incremented on each lookup to order entries by last use. */
+static word32 mlkem_matrix_cache_clock = 0;
+/* Statistics. */
+static word32 mlkem_matrix_cache_hits = 0;
+static word32 mlkem_matrix_cache_misses = 0;
+#ifndef SINGLE_THREADED
+static wolfSSL_Mutex mlkem_matrix_cache_mutex
+    WOLFSSL_MUTEX_INITIALIZER_CLAUSE(mlkem_matrix_cache_mutex);
+#endif
+
+/**
+ * Initialize the ML-KEM matrix cache.
+ *
+ * Called from wolfCrypt_Init().
+ *
+ * @return  0 on success.
+ * @return  BAD_MUTEX_E when the mutex could not be initialized.
+ */
+int wc_MlKemMatrixCache_Init(void)
+{
+    int ret = 0;
+#if !defined(SINGLE_THREADED) && !defined(WOLFSSL_MUTEX_INITIALIZER)
+    ret = wc_InitMutex(&mlkem_matrix_cache_mutex);
+#endif
+    return ret;
+}
+
+/**
+ * Dispose of all cached ML-KEM matrices.
+ *
+ * Called from wolfCrypt_Cleanup().
+ */
+void wc_MlKemMatrixCache_Free(void)
+{
+    int i;
+
+    for (i = 0; i < WOLFSSL_MLKEM_MATRIX_CACHE_SZ; i++) {
+        XFREE(mlkem_matrix_cache[i].a, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+        XMEMSET(&mlkem_matrix_cache[i], 0, sizeof(mlkem_matrix_cache[i]));
+    }
+    mlkem_matrix_cache_clock = 0;
+    mlkem_matrix_cache_hits = 0;
+    mlkem_matrix_cache_misses = 0;
+
+#if !defined(SINGLE_THREADED) && !defined(WOLFSSL_MUTEX_INITIALIZER)
+    wc_FreeMutex(&mlkem_matrix_cache_mutex);
+#endif
+}
+
+/**
+ * Get the ML-KEM matrix cache statistics.
+ *
+ * @param  [out]  hits    Number of matrices taken from the cache. May be NULL.
+ * @param  [out]  misses  Number of matrices generated. May be NULL.
+ * @return  0 on success.
+ */
+int wc_MlKemMatrixCache_GetStats(word32* hits, word32* misses)
+{
+    if (hits != NULL) {
+        *hits = mlkem_matrix_cache_hits;
+    }
+    if (misses != NULL) {
+        *misses = mlkem_matrix_cache_misses;
+    }
+
+    return 0;
+}
+
+/* Copy out the cached transposed matrix for the public seed.
+ *
+ * @param  [in]   seed  Public seed rho.
+ * @param  [in]   k     Number of dimensions of matrix.
+ * @param  [out]  a     Transposed matrix A.
+ * @return  1 when the matrix was found, 0 otherwise.
+ */
+static int mlkem_matrix_cache_get(const byte* seed, unsigned int k, sword16* a)
+{
+    int found = 0;
+    int i;
+
+#ifndef SINGLE_THREADED
+    if (wc_LockMutex(&mlkem_matrix_cache_mutex) != 0) {
+        return 0;
+    }
+#endif
+
+    mlkem_matrix_cache_clock++;
+    for (i = 0; i < WOLFSSL_MLKEM_MATRIX_CACHE_SZ; i++) {
+        MlKemMatrixCacheEntry* e = &mlkem_matrix_cache[i];
+        /* Seed is public - no need for constant time comparison. */
+        if ((e->a != NULL) && (e->k == k) &&
+                (XMEMCMP(e->seed, seed, WC_ML_KEM_SYM_SZ) == 0)) {
+            XMEMCPY(a, e->a, k * k * MLKEM_N * sizeof(sword16));
+            e->lastUse = mlkem_matrix_cache_clock;
+            found = 1;
+            break;
+        }
+    }
+    if (found) {
+        mlkem_matrix_cache_hits++;
+    }
+    else {
+        mlkem_matrix_cache_misses++;
+    }
+
+#ifndef SINGLE_THREADED
+    wc_UnLockMutex(&mlkem_matrix_cache_mutex);
+#endif
+
+    return found;
+}
+
+/* Store a copy of the transposed matrix for the public seed, replacing the
+ * least recently used entry. Failure only means the matrix isn't cached.
+ *
+ * @param  [in]  seed  Public seed rho.
+ * @param  [in]  k     Number of dimensions of matrix.
+ * @param  [in]  a     Transposed matrix A.
+ */
+static void mlkem_matrix_cache_put(const byte* seed, unsigned int k,
+    const sword16* a)
+{
+    MlKemMatrixCacheEntry* e = &mlkem_matrix_cache[0];
+    int i;
+
+#ifndef SINGLE_THREADED
+    if (wc_LockMutex(&mlkem_matrix_cache_mutex) != 0) {
+        return;
+    }
+#endif
+
+    /* Unused entry or the least recently used one. */
+    for (i = 0; (e->a != NULL) && (i < WOLFSSL_MLKEM_MATRIX_CACHE_SZ); i++) {
+        if ((mlkem_matrix_cache[i].a == NULL) ||
+                (mlkem_matrix_cache[i].lastUse < e->lastUse)) {
+            e = &mlkem_matrix_cache[i];
+        }
+    }
+    if ((e->a != NULL) && (e->k != k)) {
+        XFREE(e->a, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+        e->a = NULL;
+    }
+    if (e->a == NULL) {
+        e->a = (sword16*)XMALLOC(k * k * MLKEM_N * sizeof(sword16), NULL,
+            DYNAMIC_TYPE_TMP_BUFFER);
+    }
+    if (e->a != NULL) {
+        XMEMCPY(e->a, a, k * k * MLKEM_N * sizeof(sword16));
+        XMEMCPY(e->seed, seed, WC_ML_KEM_SYM_SZ);
+        e->k = k;
+        e->lastUse = mlkem_matrix_cache_clock;
+    }
+
+#ifndef SINGLE_THREADED
+    wc_UnLockMutex(&mlkem_matrix_cache_mutex);
+#endif
+}
+#endif /* WOLFSSL_MLKEM_MATRIX_CACHE */
+
 #if !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) || \
     !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
+/* Compress and encode u and v into the cipher text.
+ *
+ * FIPS 203, Algorithm 14: K-PKE.Encrypt(ek_PKE, m, r)
+ *   ...
+ *   22: c_1 <- ByteEncode_d_u(Compress_d_u(u))
+ *   23: c_2 <- ByteEncode_d_v(Compress_d_v(v))
+ *   24: return c <- (c_1||c_2)
+ *
+ * @param  [out]  c          Cipher text.
+ * @param  [in]   u          Vector of polynomials.
+ * @param  [in]   v          Polynomial.
+ * @param  [in]   k          Number of polynomials in vector.
+ * @param  [in]   compVecSz  Size of compressed u in bytes.
+ */
+static void mlkemkey_encode_ct(byte* c, sword16* u, sword16* v,
+    unsigned int k, unsigned int compVecSz)
+{
+    byte* c1 = c;
+    byte* c2 = c + compVecSz;
+
+#if defined(WOLFSSL_KYBER512) || defined(WOLFSSL_WC_ML_KEM_512)
+    if (k == WC_ML_KEM_512_K) {
+        /* Step 22: c_1 <- ByteEncode_d_u(Compress_d_u(u)) */
+        mlkem_vec_compress_10(c1, u, k);
+        /* Step 23: c_2 <- ByteEncode_d_v(Compress_d_v(v)) */
+        mlkem_compress_4(c2, v);
+        /* Step 24: return c <- (c_1||c_2) */
+    }
+#endif
+#if defined(WOLFSSL_KYBER768) || defined(WOLFSSL_WC_ML_KEM_768)
+    if (k == WC_ML_KEM_768_K) {
+        /* Step 22: c_1 <- ByteEncode_d_u(Compress_d_u(u)) */
+        mlkem_vec_compress_10(c1, u, k);
+        /* Step 23: c_2 <- ByteEncode_d_v(Compress_d_v(v)) */
+        mlkem_compress_4(c2, v);
+        /* Step 24: return c <- (c_1||c_2) */
+    }
+#endif
+#if defined(WOLFSSL_KYBER1024) || defined(WOLFSSL_WC_ML_KEM_1024)
+    if (k == WC_ML_KEM_1024_K) {
+        /* Step 22: c_1 <- ByteEncode_d_u(Compress_d_u(u)) */
+        mlkem_vec_compress_11(c1, u);
+        /* Step 23: c_2 <- ByteEncode_d_v(Compress_d_v(v)) */
+        mlkem_compress_5(c2, v);
+        /* Step 24: return c <- (c_1||c_2) */
+    }
+#endif
+}
+
 /* Encapsulate data and derive secret.
  *
  * FIPS 203, Algorithm 14: K-PKE.Encrypt(ek_PKE, m, r)
@@ -867,10 +1119,22 @@ static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c)
     }
     else
     #endif /* WOLFSSL_MLKEM_CACHE_A */
+    #ifdef WOLFSSL_MLKEM_MATRIX_CACHE
+    if ((ret == 0) && mlkem_matrix_cache_get(key->pubSeed, k, a)) {
+        /* Transposed matrix already generated for this public seed.
+         *   Step 4-8: generate matrix A_hat */
+    }
+    else
+    #endif /* WOLFSSL_MLKEM_MATRIX_CACHE */
     if (ret == 0) {
         /* Generate the transposed matrix.
          *   Step 4-8: generate matrix A_hat */
         ret = mlkem_gen_matrix(&key->prf, a, k, key->pubSeed, 1);
+    #ifdef WOLFSSL_MLKEM_MATRIX_CACHE
+        if (ret == 0) {
+            mlkem_matrix_cache_put(key->pubSeed, k, a);
+        }
+    #endif
     }
     if (ret == 0) {
         /* Assign remaining allocated dynamic memory to pointers.
@@ -909,36 +1173,7 @@ static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c)
 #endif /* WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM */
 
     if (ret == 0) {
-        byte* c1 = c;
-        byte* c2 = c + compVecSz;
-
-    #if defined(WOLFSSL_KYBER512) || defined(WOLFSSL_WC_ML_KEM_512)
-        if (k == WC_ML_KEM_512_K) {
-            /* Step 22: c_1 <- ByteEncode_d_u(Compress_d_u(u)) */
-            mlkem_vec_compress_10(c1, u, k);
-            /* Step 23: c_2 <- ByteEncode_d_v(Compress_d_v(v)) */
-            mlkem_compress_4(c2, v);
-            /* Step 24: return c <- (c_1||c_2) */
-        }
-    #endif
-    #if defined(WOLFSSL_KYBER768) || defined(WOLFSSL_WC_ML_KEM_768)
-        if (k == WC_ML_KEM_768_K) {
-            /* Step 22: c_1 <- ByteEncode_d_u(Compress_d_u(u)) */
-            mlkem_vec_compress_10(c1, u, k);
-            /* Step 23: c_2 <- ByteEncode_d_v(Compress_d_v(v)) */
-            mlkem_compress_4(c2, v);
-            /* Step 24: return c <- (c_1||c_2) */
-        }
-    #endif
-    #if defined(WOLFSSL_KYBER1024) || defined(WOLFSSL_WC_ML_KEM_1024)
-        if (k == WC_ML_KEM_1024_K) {
-            /* Step 22: c_1 <- ByteEncode_d_u(Compress_d_u(u)) */
-            mlkem_vec_compress_11(c1, u);
-            /* Step 23: c_2 <- ByteEncode_d_v(Compress_d_v(v)) */
-            mlkem_compress_5(c2, v);
-            /* Step 24: return c <- (c_1||c_2) */
-        }
-    #endif
+        mlkemkey_encode_ct(c, u, v, k, compVecSz);
     }
 
 #ifndef WOLFSSL_NO_MALLOC
@@ -1361,6 +1596,236 @@ static MLKEM_NOINLINE int mlkemkey_decapsulate(MlKemKey* key, byte* m,
     return ret;
 }
 
+#ifdef WOLFSSL_MLKEM_NONBLOCK
+/* Steps of a non-blocking decapsulation. */
+enum {
+    MLKEM_NB_IDLE = 0,
+    MLKEM_NB_MATRIX,
+    MLKEM_NB_NOISE,
+    MLKEM_NB_ENCRYPT,
+    MLKEM_NB_ENCODE
+};
+
+/* Dispose of the in-progress decapsulation of a non-blocking context.
+ *
+ * @param  [in, out]  nb  Non-blocking context.
+ */
+static void mlkem_nb_reset(MlKemNbCtx* nb)
+{
+    XFREE(nb->y, nb->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    nb->y = NULL;
+    ForceZero(nb->msg, sizeof(nb->msg));
+    ForceZero(nb->kr, sizeof(nb->kr));
+    nb->state = MLKEM_NB_IDLE;
+}
+
+/* Decrypt and re-encrypt the cipher text one step at a time.
+ *
+ * Steps: decrypt and hash, one vector of the transposed matrix A each,
+ * generate noise, one polynomial of u each, v and encoding.
+ * Working memory is the same as for a blocking encapsulation and is kept in
+ * the context between calls. With WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM the
+ * re-encryption is one step.
+ *
+ * A decapsulation is identified by the hash of the public key and the hash of
+ * the cipher text. Calling with other data abandons the decapsulation in
+ * progress.
+ *
+ * @param  [in]   key  Kyber key object.
+ * @param  [out]  msg  Message that was encapsulated.
+ * @param  [out]  kr   Seed derived from message.
+ * @param  [in]   ct   Cipher text.
+ * @param  [in]   len  Length of cipher text.
+ * @param  [out]  cmp  Cipher text from re-encrypting message.
+ * @return  0 when msg, kr and cmp are set.
+ * @return  MP_WOULDBLOCK when the decapsulation is not finished.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ * @return  Other negative when an error occurs.
+ */
+static int mlkemkey_decapsulate_nb(MlKemKey* key, byte* msg, byte* kr,
+    const byte* ct, word32 len, byte* cmp)
+{
+    int ret;
+    MlKemNbCtx* nb = key->nb;
+    byte id[WC_ML_KEM_SYM_SZ];
+#ifndef WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM
+    /* Dimension of matrix: 2, 3 or 4. */
+    unsigned int k = (unsigned int)(key->type & ~MLKEM_KYBER) + 2;
+    sword16* y = NULL;
+    sword16* a = NULL;
+    sword16* mu = NULL;
+    sword16* e1 = NULL;
+    sword16* e2 = NULL;
+    sword16* u = NULL;
+    sword16* v = NULL;
+#endif
+    int more;
+#ifdef WC_NONBLOCK_CYCLES
+    word64 start = WC_NONBLOCK_CYCLES();
+#endif
+
+    ret = mlkem_hash256(&key->hash, ct, len, id);
+    if (ret != 0) {
+        return ret;
+    }
+    if ((nb->state != MLKEM_NB_IDLE) &&
+            ((XMEMCMP(nb->id, id, WC_ML_KEM_SYM_SZ) != 0) ||
+             (XMEMCMP(nb->h, key->h, WC_ML_KEM_SYM_SZ) != 0))) {
+        /* Other key or cipher text - start again. */
+        mlkem_nb_reset(nb);
+    }
+
+    do {
+    #ifndef WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM
+        if (nb->y != NULL) {
+            /* y (v) | a (m) | mu (p) | e1 (v) | e2 (p) | u (v) | v (p) */
+            y  = nb->y;
+            a  = y  + MLKEM_N * k;
+            mu = a  + MLKEM_N * k * k;
+            e1 = mu + MLKEM_N;
+            e2 = e1 + MLKEM_N * k;
+            u  = e2 + MLKEM_N;
+            v  = u  + MLKEM_N * k;
+        }
+    #endif
+        switch (nb->state) {
+            case MLKEM_NB_IDLE:
+                XMEMCPY(nb->id, id, WC_ML_KEM_SYM_SZ);
+                XMEMCPY(nb->h, key->h, WC_ML_KEM_SYM_SZ);
+                nb->heap = key->heap;
+                nb->row = 0;
+                /* Decapsulate the cipher text. */
+                ret = mlkemkey_decapsulate(key, nb->msg, ct);
+                if (ret == 0) {
+                    /* Hash message into seed buffer. */
+                    ret = MLKEM_HASH_G(&key->hash, nb->msg, WC_ML_KEM_SYM_SZ,
+                        key->h, WC_ML_KEM_SYM_SZ, nb->kr);
+                }
+            #ifndef WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM
+                if (ret == 0) {
+                    nb->y = (sword16*)XMALLOC(((k + 3) * k + 3) * MLKEM_N *
+                        sizeof(sword16), nb->heap, DYNAMIC_TYPE_TMP_BUFFER);
+                    if (nb->y == NULL) {
+                        ret = MEMORY_E;
+                    }
+                }
+                if (ret == 0) {
+                    nb->state = MLKEM_NB_MATRIX;
+                #ifdef WOLFSSL_MLKEM_MATRIX_CACHE
+                    if (mlkem_matrix_cache_get(key->pubSeed, k,
+                            nb->y + MLKEM_N * k)) {
+                        /* Transposed matrix already generated. */
+                        nb->state = MLKEM_NB_NOISE;
+                    }
+                #endif
+                }
+            #else
+                /* Matrix generated a row at a time when encrypting. */
+                if (ret == 0) {
+                    nb->state = MLKEM_NB_ENCRYPT;
+                }
+            #endif
+                break;
+        #ifndef WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM
+            case MLKEM_NB_MATRIX:
+                /* Generate a vector of the transposed matrix.
+                 *   Step 4-8: generate matrix A_hat */
+            #ifdef WOLFSSL_MLKEM_CACHE_A
+                if ((key->flags & MLKEM_FLAG_A_SET) != 0) {
+                    unsigned int j;
+                    for (j = 0; j < k; j++) {
+                        XMEMCPY(&a[(nb->row * k + j) * MLKEM_N],
+                                &key->a[(j * k + nb->row) * MLKEM_N],
+                                MLKEM_N * 2);
+                    }
+                }
+                else
+            #endif
+                {
+                    ret = mlkem_gen_matrix_row(&key->prf,
+                        a + nb->row * k * MLKEM_N, (int)k, key->pubSeed,
+                        nb->row);
+                }
+                if ((ret == 0) && (++nb->row == k)) {
+                #ifdef WOLFSSL_MLKEM_MATRIX_CACHE
+                    mlkem_matrix_cache_put(key->pubSeed, k, a);
+                #endif
+                    nb->state = MLKEM_NB_NOISE;
+                }
+                break;
+            case MLKEM_NB_NOISE:
+                /* Step 20: mu <- Decompress_1(ByteDecode_1(m)) */
+                mlkem_from_msg(mu, nb->msg);
+                /* Steps 9-17: generate y, e_1, e_2 */
+                mlkem_prf_init(&key->prf);
+                ret = mlkem_get_noise(&key->prf, (int)k, y, e1, e2,
+                    nb->kr + WC_ML_KEM_SYM_SZ);
+                if (ret == 0) {
+                    mlkem_encapsulate_y(y, (int)k);
+                    nb->row = 0;
+                    nb->state = MLKEM_NB_ENCRYPT;
+                }
+                break;
+            case MLKEM_NB_ENCRYPT:
+                /* Steps 18-19: calculate a polynomial of u */
+                mlkem_encapsulate_u(u + nb->row * MLKEM_N,
+                    a + nb->row * k * MLKEM_N, y, e1 + nb->row * MLKEM_N,
+                    (int)k);
+                if (++nb->row == k) {
+                    nb->state = MLKEM_NB_ENCODE;
+                }
+                break;
+            case MLKEM_NB_ENCODE:
+                /* Step 21: calculate v */
+                mlkem_encapsulate_v(key->pub, v, y, e2, mu, (int)k);
+                /* Steps 22-24: encode cipher text */
+                mlkemkey_encode_ct(cmp, u, v, k,
+                    MLKEM_POLY_VEC_COMPRESSED_SZ(k, (k == 4) ? 11 : 10));
+                XMEMCPY(msg, nb->msg, WC_ML_KEM_SYM_SZ);
+                XMEMCPY(kr, nb->kr, 2 * WC_ML_KEM_SYM_SZ);
+                nb->steps++;
+                mlkem_nb_reset(nb);
+                return 0;
+        #else
+            case MLKEM_NB_ENCRYPT:
+                /* Encapsulate the message. */
+                ret = mlkemkey_encapsulate(key, nb->msg,
+                    nb->kr + WC_ML_KEM_SYM_SZ, cmp);
+                if (ret == 0) {
+                    XMEMCPY(msg, nb->msg, WC_ML_KEM_SYM_SZ);
+                    XMEMCPY(kr, nb->kr, 2 * WC_ML_KEM_SYM_SZ);
+                    nb->steps++;
+                    mlkem_nb_reset(nb);
+                    return 0;
+                }
+                break;
+        #endif
+            default:
+                ret = BAD_STATE_E;
+                break;
+        }
+        nb->steps++;
+    #ifdef WC_NONBLOCK_CYCLES
+        more = (nb->budget != 0) &&
+               ((word64)(WC_NONBLOCK_CYCLES() - start) < nb->budget);
+    #else
+        more = 0;
+    #endif
+    }
+    while ((ret == 0) && more);
+
+    if (ret != 0) {
+        mlkem_nb_reset(nb);
+    }
+    else {
+        nb->yields++;
+        ret = MP_WOULDBLOCK;
+    }
+
+    return ret;
+}
+#endif /* WOLFSSL_MLKEM_NONBLOCK */
+
 /**
  * Decapsulate the cipher text to calculate the shared secret.
  *
@@ -1483,18 +1948,25 @@ int wc_MlKemKey_Decapsulate(MlKemKey* key, unsigned char* ss,
     }
 #endif
 
+#ifdef WOLFSSL_MLKEM_NONBLOCK
+    if ((ret == 0) && (key->nb != NULL)) {
+        /* Decrypt and re-encrypt over a number of calls. */
+        ret = mlkemkey_decapsulate_nb(key, msg, kr, ct, ctSz, cmp);
+    }
+    else
+#endif
     if (ret == 0) {
         /* Decapsulate the cipher text. */
         ret = mlkemkey_decapsulate(key, msg, ct);
-    }
-    if (ret == 0) {
-        /* Hash message into seed buffer. */
-        ret = MLKEM_HASH_G(&key->hash, msg, WC_ML_KEM_SYM_SZ, key->h,
-            WC_ML_KEM_SYM_SZ, kr);
-    }
-    if (ret == 0) {
-        /* Encapsulate the message. */
-        ret = mlkemkey_encapsulate(key, msg, kr + WC_ML_KEM_SYM_SZ, cmp);
+        if (ret == 0) {
+            /* Hash message into seed buffer. */
+            ret = MLKEM_HASH_G(&key->hash, msg, WC_ML_KEM_SYM_SZ, key->h,
+                WC_ML_KEM_SYM_SZ, kr);
+        }
+        if (ret == 0) {
+            /* Encapsulate the message. */
+            ret = mlkemkey_encapsulate(key, msg, kr + WC_ML_KEM_SYM_SZ, cmp);
+        }
     }
     if (ret == 0) {
         /* Compare generated cipher text with that passed in. */
@@ -1543,6 +2015,47 @@ int wc_MlKemKey_Decapsulate(MlKemKey* key, unsigned char* ss,
 
     return ret;
 }
+
+#ifdef WOLFSSL_MLKEM_NONBLOCK
+/**
+ * Set the non-blocking context to decapsulate with.
+ *
+ * The context is owned by the caller and is used by keys decapsulating one
+ * after the other. Passing NULL returns the key to blocking operation.
+ *
+ * @param  [in, out]  key  Kyber key object.
+ * @param  [in]       ctx  Non-blocking context. May be NULL.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when key is NULL.
+ */
+int wc_MlKemKey_SetNonBlock(MlKemKey* key, MlKemNbCtx* ctx)
+{
+    int ret = 0;
+
+    if (key == NULL) {
+        ret = BAD_FUNC_ARG;
+    }
+    else {
+        key->nb = ctx;
+    }
+
+    return ret;
+}
+
+/**
+ * Dispose of the dynamic memory and secrets of a non-blocking context.
+ *
+ * Any decapsulation in progress is abandoned.
+ *
+ * @param  [in, out]  ctx  Non-blocking context.
+ */
+void wc_MlKemKey_FreeNonBlock(MlKemNbCtx* ctx)
+{
+    if (ctx != NULL) {
+        mlkem_nb_reset(ctx);
+    }
+}
+#endif /* WOLFSSL_MLKEM_NONBLOCK */
 #endif /* WOLFSSL_MLKEM_NO_DECAPSULATE */
 
 /******************************************************************************/
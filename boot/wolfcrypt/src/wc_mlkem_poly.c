@@ -56,6 +56,9 @@
  *   Compiles smaller, fast code size with a speed trade-off.
  * WOLFSSL_MLKEM_SMALL                                        Default: OFF
  *   Compiles to small code size with a speed trade-off.
+ * WOLFSSL_MLKEM_NO_GEN_MATRIX_LANES                          Default: OFF
+ *   Generate the matrix one polynomial at a time through the XOF object
+ *   instead of sampling several SHAKE-128 states directly.
  * WOLFSSL_SMALL_STACK                                        Default: OFF
  *   Use less stack by dynamically allocating local variables.
  *
@@ -89,9 +92,13 @@
 #endif
 
 #if defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) || \
-    defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM)
+    defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM) || \
+    defined(WOLFSSL_MLKEM_NONBLOCK)
 static int mlkem_gen_matrix_i(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
     int i, int transposed);
+#endif
+#if defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) || \
+    defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM)
 static int mlkem_get_noise_i(MLKEM_PRF_T* prf, int k, sword16* vec2,
     byte* seed, int i, int make);
 static int mlkem_get_noise_eta2_c(MLKEM_PRF_T* prf, sword16* p,
@@ -139,6 +146,13 @@ static cpuid_flags_t cpuid_flags = WC_CPUID_INITIALIZER;
 /* Number of bytes to generate for matrix. */
 #define GEN_MATRIX_SIZE     GEN_MATRIX_NBLOCKS * XOF_BLOCK_SIZE
 
+#if !defined(WOLFSSL_MLKEM_SMALL) && !defined(BIG_ENDIAN_ORDER) && \
+    !defined(WOLFSSL_MLKEM_NO_GEN_MATRIX_LANES)
+/* Number of SHAKE-128 states squeezed together when generating the matrix in
+ * C. Polynomials are sampled straight out of the Keccak state. */
+#define GEN_MATRIX_LANES    4
+#endif
+
 
 /* Number of random bytes to generate for ETA3. */
 #define ETA3_RAND_SIZE     ((3 * MLKEM_N) / 4)
@@ -189,7 +203,7 @@ const sword16 zetas[MLKEM_N / 2] = {
 };
 
 
-#if !defined(WOLFSSL_ARMASM)
+#if !defined(WOLFSSL_ARMASM) && !defined(USE_RISCV32_MLKEM_SPEEDUP)
 /* Number-Theoretic Transform.
  *
  * FIPS 203, Algorithm 9: NTT(f)
@@ -1235,6 +1249,31 @@ static void mlkem_pointwise_acc_mont(sword16* r, const sword16* a,
 #endif
 }
 
+#if defined(WOLFSSL_BENCH_KERNELS) && !defined(WOLFSSL_ARMASM)
+/* Polynomial kernels exposed for timing by the benchmark firmware. */
+
+/* Forward NTT of one polynomial, see mlkem_ntt(). */
+void mlkem_bench_ntt(sword16* r)
+{
+    mlkem_ntt(r);
+}
+
+#if !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) || \
+    !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
+/* Inverse NTT of one polynomial, see mlkem_invntt(). */
+void mlkem_bench_invntt(sword16* r)
+{
+    mlkem_invntt(r);
+}
+#endif
+
+/* Pointwise multiplication in NTT domain, see mlkem_basemul_mont(). */
+void mlkem_bench_basemul_mont(sword16* r, const sword16* a, const sword16* b)
+{
+    mlkem_basemul_mont(r, a, b);
+}
+#endif /* WOLFSSL_BENCH_KERNELS && !WOLFSSL_ARMASM */
+
 /******************************************************************************/
 
 /* Initialize Kyber implementation.
@@ -1968,6 +2007,76 @@ int mlkem_keygen_seeds(sword16* s, sword16* t, MLKEM_PRF_T* prf,
 #if !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) || \
     !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
 #ifndef WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM
+/* Calculate one polynomial of u when encapsulating.
+ *
+ * @param  [out]  u   Polynomial of u.
+ * @param  [in]   a   Vector of transposed matrix A.
+ * @param  [in]   y   Vector of polynomials in NTT form.
+ * @param  [in]   e1  Error polynomial.
+ * @param  [in]   k   Number of polynomials in vector.
+ */
+static void mlkem_encapsulate_u_c(sword16* u, const sword16* a,
+    const sword16* y, const sword16* e1, int k)
+{
+    unsigned int j;
+
+    /* Multiply at by y into u polynomial. */
+    mlkem_pointwise_acc_mont(u, a, y, k);
+    /* Inverse transform u polynomial. */
+    mlkem_invntt(u);
+    /* Add errors to u and reduce. */
+#if defined(WOLFSSL_MLKEM_SMALL) || defined(WOLFSSL_MLKEM_NO_LARGE_CODE)
+    for (j = 0; j < MLKEM_N; ++j) {
+        sword16 t = u[j] + e1[j];
+        u[j] = MLKEM_BARRETT_RED(t);
+    }
+#else
+    for (j = 0; j < MLKEM_N; j += 8) {
+        sword16 t0 = u[j + 0] + e1[j + 0];
+        sword16 t1 = u[j + 1] + e1[j + 1];
+        sword16 t2 = u[j + 2] + e1[j + 2];
+        sword16 t3 = u[j + 3] + e1[j + 3];
+        sword16 t4 = u[j + 4] + e1[j + 4];
+        sword16 t5 = u[j + 5] + e1[j + 5];
+        sword16 t6 = u[j + 6] + e1[j + 6];
+        sword16 t7 = u[j + 7] + e1[j + 7];
+        u[j + 0] = MLKEM_BARRETT_RED(t0);
+        u[j + 1] = MLKEM_BARRETT_RED(t1);
+        u[j + 2] = MLKEM_BARRETT_RED(t2);
+        u[j + 3] = MLKEM_BARRETT_RED(t3);
+        u[j + 4] = MLKEM_BARRETT_RED(t4);
+        u[j + 5] = MLKEM_BARRETT_RED(t5);
+        u[j + 6] = MLKEM_BARRETT_RED(t6);
+        u[j + 7] = MLKEM_BARRETT_RED(t7);
+    }
+#endif
+}
+
+/* Calculate v when encapsulating.
+ *
+ * @param  [in]   pub  Public key vector of polynomials.
+ * @param  [out]  v    Polynomial.
+ * @param  [in]   y    Vector of polynomials in NTT form.
+ * @param  [in]   e2   Error polynomial.
+ * @param  [in]   m    Message polynomial.
+ * @param  [in]   k    Number of polynomials in vector.
+ */
+static void mlkem_encapsulate_v_c(const sword16* pub, sword16* v,
+    const sword16* y, const sword16* e2, const sword16* m, int k)
+{
+    int i;
+
+    /* Multiply public key by y into v polynomial. */
+    mlkem_pointwise_acc_mont(v, pub, y, k);
+    /* Inverse transform v. */
+    mlkem_invntt(v);
+    /* Add errors and message to v and reduce. */
+    for (i = 0; i < MLKEM_N; ++i) {
+        sword16 t = v[i] + e2[i] + m[i];
+        v[i] = MLKEM_BARRETT_RED(t);
+    }
+}
+
 /* Encapsulate message.
  *
  * @param  [in]   pub  Public key vector of polynomials.
@@ -1994,51 +2103,60 @@ static void mlkem_encapsulate_c(const sword16* pub, sword16* u, sword16* v,
 
     /* For each polynomial in the vectors. */
     for (i = 0; i < k; ++i) {
-        unsigned int j;
-
-        /* Multiply at by y into u polynomial. */
-        mlkem_pointwise_acc_mont(u + i * MLKEM_N, a + i * k * MLKEM_N, y, k);
-        /* Inverse transform u polynomial. */
-        mlkem_invntt(u + i * MLKEM_N);
-        /* Add errors to u and reduce. */
-#if defined(WOLFSSL_MLKEM_SMALL) || defined(WOLFSSL_MLKEM_NO_LARGE_CODE)
-        for (j = 0; j < MLKEM_N; ++j) {
-            sword16 t = u[i * MLKEM_N + j] + e1[i * MLKEM_N + j];
-            u[i * MLKEM_N + j] = MLKEM_BARRETT_RED(t);
-        }
-#else
-        for (j = 0; j < MLKEM_N; j += 8) {
-            sword16 t0 = u[i * MLKEM_N + j + 0] + e1[i * MLKEM_N + j + 0];
-            sword16 t1 = u[i * MLKEM_N + j + 1] + e1[i * MLKEM_N + j + 1];
-            sword16 t2 = u[i * MLKEM_N + j + 2] + e1[i * MLKEM_N + j + 2];
-            sword16 t3 = u[i * MLKEM_N + j + 3] + e1[i * MLKEM_N + j + 3];
-            sword16 t4 = u[i * MLKEM_N + j + 4] + e1[i * MLKEM_N + j + 4];
-            sword16 t5 = u[i * MLKEM_N + j + 5] + e1[i * MLKEM_N + j + 5];
-            sword16 t6 = u[i * MLKEM_N + j + 6] + e1[i * MLKEM_N + j + 6];
-            sword16 t7 = u[i * MLKEM_N + j + 7] + e1[i * MLKEM_N + j + 7];
-            u[i * MLKEM_N + j + 0] = MLKEM_BARRETT_RED(t0);
-            u[i * MLKEM_N + j + 1] = MLKEM_BARRETT_RED(t1);
-            u[i * MLKEM_N + j + 2] = MLKEM_BARRETT_RED(t2);
-            u[i * MLKEM_N + j + 3] = MLKEM_BARRETT_RED(t3);
-            u[i * MLKEM_N + j + 4] = MLKEM_BARRETT_RED(t4);
-            u[i * MLKEM_N + j + 5] = MLKEM_BARRETT_RED(t5);
-            u[i * MLKEM_N + j + 6] = MLKEM_BARRETT_RED(t6);
-            u[i * MLKEM_N + j + 7] = MLKEM_BARRETT_RED(t7);
-        }
-#endif
+        mlkem_encapsulate_u_c(u + i * MLKEM_N, a + i * k * MLKEM_N, y,
+            e1 + i * MLKEM_N, k);
     }
 
-    /* Multiply public key by y into v polynomial. */
-    mlkem_pointwise_acc_mont(v, pub, y, k);
-    /* Inverse transform v. */
-    mlkem_invntt(v);
-    /* Add errors and message to v and reduce. */
-    for (i = 0; i < MLKEM_N; ++i) {
-        sword16 t = v[i] + e2[i] + m[i];
-        v[i] = MLKEM_BARRETT_RED(t);
+    mlkem_encapsulate_v_c(pub, v, y, e2, m, k);
+}
+
+#ifdef WOLFSSL_MLKEM_NONBLOCK
+/* Transform y before calculating u and v a part at a time.
+ *
+ * @param  [in, out]  y  Vector of polynomials.
+ * @param  [in]       k  Number of polynomials in vector.
+ */
+void mlkem_encapsulate_y(sword16* y, int k)
+{
+    int i;
+
+    for (i = 0; i < k; ++i) {
+        mlkem_ntt(y + i * MLKEM_N);
     }
 }
 
+/* Calculate one polynomial of u when encapsulating.
+ *
+ * @param  [out]  u   Polynomial of u.
+ * @param  [in]   a   Vector of transposed matrix A.
+ * @param  [in]   y   Vector of polynomials transformed by
+ *                    mlkem_encapsulate_y().
+ * @param  [in]   e1  Error polynomial.
+ * @param  [in]   k   Number of polynomials in vector.
+ */
+void mlkem_encapsulate_u(sword16* u, const sword16* a, const sword16* y,
+    const sword16* e1, int k)
+{
+    mlkem_encapsulate_u_c(u, a, y, e1, k);
+}
+
+/* Calculate v when encapsulating.
+ *
+ * @param  [in]   pub  Public key vector of polynomials.
+ * @param  [out]  v    Polynomial.
+ * @param  [in]   y    Vector of polynomials transformed by
+ *                     mlkem_encapsulate_y().
+ * @param  [in]   e2   Error polynomial.
+ * @param  [in]   m    Message polynomial.
+ * @param  [in]   k    Number of polynomials in vector.
+ */
+void mlkem_encapsulate_v(const sword16* pub, sword16* v, const sword16* y,
+    const sword16* e2, const sword16* m, int k)
+{
+    mlkem_encapsulate_v_c(pub, v, y, e2, m, k);
+}
+#endif
+
 /* Encapsulate message.
  *
  * @param  [in]   pub  Public key vector of polynomials.
@@ -2863,7 +2981,11 @@ static int mlkem_gen_matrix_k4_aarch64(sword16* a, byte* seed, int transposed)
 #endif
 #endif /* USE_INTEL_SPEEDUP */
 
-#if !(defined(WOLFSSL_ARMASM) && defined(__aarch64__))
+#if !(defined(WOLFSSL_ARMASM) && defined(__aarch64__)) && \
+    (!defined(GEN_MATRIX_LANES) || \
+     defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) || \
+     defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM) || \
+     defined(WOLFSSL_MLKEM_NONBLOCK))
 /* Absorb the seed data for squeezing out pseudo-random data.
  *
  * FIPS 203, Section 4.1:
@@ -3413,6 +3535,96 @@ static unsigned int mlkem_rej_uniform_c(sword16* p, unsigned int len,
  * @return  MEMORY_E when dynamic memory allocation fails. Only possible when
  * WOLFSSL_SMALL_STACK is defined.
  */
+#ifdef GEN_MATRIX_LANES
+static int mlkem_gen_matrix_c(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
+    int transposed)
+{
+#if defined(WOLFSSL_SMALL_STACK) && !defined(WOLFSSL_NO_MALLOC)
+    word64* state;
+#else
+    word64 state[GEN_MATRIX_LANES * 25];
+#endif
+    unsigned int ctr[GEN_MATRIX_LANES];
+    int ret = 0;
+    int e;
+
+    (void)prf;
+
+#if defined(WOLFSSL_SMALL_STACK) && !defined(WOLFSSL_NO_MALLOC)
+    /* One allocation holds the Keccak state of every lane. The random bytes
+     * are sampled from the rate part of each state so no other buffer is
+     * needed. */
+    state = (word64*)XMALLOC(GEN_MATRIX_LANES * 25 * sizeof(word64), NULL,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    if (state == NULL) {
+        ret = MEMORY_E;
+    }
+#endif
+
+    /* Generate the k x k polynomials, up to GEN_MATRIX_LANES at a time.
+     * Alg 13, Step 3-4. Alg 14, Step 4-5. */
+    for (e = 0; (ret == 0) && (e < k * k); e += GEN_MATRIX_LANES) {
+        int n = k * k - e;
+        int done;
+        int l;
+
+        if (n > GEN_MATRIX_LANES) {
+            n = GEN_MATRIX_LANES;
+        }
+
+        /* Absorb the index specific seed into each lane's state.
+         * Alg 7, Step 1-2 */
+        for (l = 0; l < n; l++) {
+            word64* s = state + l * 25;
+            int i = (e + l) / k;
+            int j = (e + l) % k;
+
+            readUnalignedWords64(s, seed, 4);
+            if (transposed) {
+                /* Alg 14, Step 6: .. rho||i||j ... */
+                s[4] = 0x1f0000 + ((word64)j << 8) + (word64)i;
+            }
+            else {
+                /* Alg 13, Step 5: .. rho||j||i ... */
+                s[4] = 0x1f0000 + ((word64)i << 8) + (word64)j;
+            }
+            XMEMSET(s + 5, 0, sizeof(*s) * (25 - 5));
+            s[20] = W64LIT(0x8000000000000000);
+            /* Alg 7, Step 3 - implicitly counter is 0. */
+            ctr[l] = 0;
+        }
+
+        /* Squeeze a block from each lane that still needs values and sample
+         * it straight out of the state.
+         * Alg 7, Step 4-16. */
+        do {
+            done = 1;
+            for (l = 0; l < n; l++) {
+                if (ctr[l] < MLKEM_N) {
+                    word64* s = state + l * 25;
+
+                    /* Alg 7, Step 5. */
+                    BlockSha3(s);
+                    ctr[l] += mlkem_rej_uniform_c(
+                        a + (e + l) * MLKEM_N + ctr[l], MLKEM_N - ctr[l],
+                        (byte*)s, XOF_BLOCK_SIZE);
+                    if (ctr[l] < MLKEM_N) {
+                        done = 0;
+                    }
+                }
+            }
+        }
+        while (!done);
+    }
+
+#if defined(WOLFSSL_SMALL_STACK) && !defined(WOLFSSL_NO_MALLOC)
+    /* Dispose of temporary buffer. */
+    XFREE(state, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    return ret;
+}
+#else
 static int mlkem_gen_matrix_c(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
     int transposed)
 {
@@ -3498,6 +3710,7 @@ static int mlkem_gen_matrix_c(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
 
     return ret;
 }
+#endif /* GEN_MATRIX_LANES */
 #endif
 
 /* Deterministically generate a matrix (or transpose) of uniform integers mod q.
@@ -3591,7 +3804,8 @@ int mlkem_gen_matrix(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
 #endif
 
 #if defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) || \
-    defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM)
+    defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM) || \
+    defined(WOLFSSL_MLKEM_NONBLOCK)
 
 /* Deterministically generate a matrix (or transpose) of uniform integers mod q.
  *
@@ -3700,6 +3914,27 @@ static int mlkem_gen_matrix_i(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
     return ret;
 }
 
+#ifdef WOLFSSL_MLKEM_NONBLOCK
+/* Deterministically generate one vector of the transposed matrix A.
+ *
+ * Vector i is the same as generated by mlkem_gen_matrix() with transposed set.
+ *
+ * @param  [in]   prf   XOF object.
+ * @param  [out]  a     Vector of k polynomials.
+ * @param  [in]   k     Number of dimensions. k x k polynomials.
+ * @param  [in]   seed  Bytes to seed XOF generation.
+ * @param  [in]   i     Index of vector to generate.
+ * @return  0 on success.
+ * @return  MEMORY_E when dynamic memory allocation fails. Only possible when
+ * WOLFSSL_SMALL_STACK is defined.
+ */
+int mlkem_gen_matrix_row(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
+    int i)
+{
+    return mlkem_gen_matrix_i(prf, a, k, seed, i, 1);
+}
+#endif
+
 #endif
 
 
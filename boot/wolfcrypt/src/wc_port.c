@@ -35,6 +35,10 @@
 #ifdef WOLFSSL_ASYNC_CRYPT
     #include <wolfssl/wolfcrypt/async.h>
 #endif
+#if defined(WOLFSSL_HAVE_MLKEM) && defined(WOLFSSL_WC_MLKEM) && \
+    defined(WOLFSSL_MLKEM_MATRIX_CACHE)
+    #include <wolfssl/wolfcrypt/mlkem.h>
+#endif
 
 #ifdef FREESCALE_LTC_TFM
     #include <wolfssl/wolfcrypt/port/nxp/ksdk_port.h>
@@ -444,6 +448,14 @@ int wolfCrypt_Init(void)
             return ret;
         }
 #endif
+
+#if defined(WOLFSSL_HAVE_MLKEM) && defined(WOLFSSL_WC_MLKEM) && \
+    defined(WOLFSSL_MLKEM_MATRIX_CACHE)
+        if ((ret = wc_MlKemMatrixCache_Init()) != 0) {
+            WOLFSSL_MSG("Error creating ML-KEM matrix cache");
+            return ret;
+        }
+#endif
     }
     initRefCount++;
 
@@ -490,6 +502,11 @@ int wolfCrypt_Cleanup(void)
     #endif
 #endif /* HAVE_ECC */
 
+    #if defined(WOLFSSL_HAVE_MLKEM) && defined(WOLFSSL_WC_MLKEM) && \
+        defined(WOLFSSL_MLKEM_MATRIX_CACHE)
+        wc_MlKemMatrixCache_Free();
+    #endif
+
     #if defined(OPENSSL_EXTRA) || defined(DEBUG_WOLFSSL_VERBOSE)
         ret = wc_LoggingCleanup();
     #endif
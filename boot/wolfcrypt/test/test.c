@@ -44864,6 +44864,114 @@ out:
 #endif /* !WOLFSSL_NO_KYBER1024 && !WOLFSSL_NO_ML_KEM_1024 */
 #endif /* WOLFSSL_WC_MLKEM */
 
+#if defined(WOLFSSL_WC_MLKEM) && defined(WOLFSSL_MLKEM_NONBLOCK) && \
+    !defined(WOLFSSL_MLKEM_NO_MAKE_KEY) && \
+    !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) && \
+    !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
+/* Decapsulate one step per call, as a handshake called back does, and compare
+ * with the encapsulated secret and with a blocking decapsulation of a
+ * ciphertext that fails the re-encryption check.
+ */
+static wc_test_ret_t mlkem_nonblock_test(int type, WC_RNG* rng)
+{
+    wc_test_ret_t ret;
+#if defined(WOLFSSL_SMALL_STACK) && !defined(WOLFSSL_NO_MALLOC)
+    MlKemKey* key = NULL;
+    byte* ct = NULL;
+    MlKemNbCtx* nb = NULL;
+#else
+    MlKemKey key[1];
+    byte ct[WC_ML_KEM_MAX_CIPHER_TEXT_SIZE];
+    MlKemNbCtx nb[1];
+#endif
+    byte ss[WC_ML_KEM_SS_SZ];
+    byte ss_blk[WC_ML_KEM_SS_SZ];
+    byte ss_nb[WC_ML_KEM_SS_SZ];
+    word32 ctSz = 0;
+    int t;
+    int calls = 0;
+    int key_inited = 0;
+
+#if defined(WOLFSSL_SMALL_STACK) && !defined(WOLFSSL_NO_MALLOC)
+    key = (MlKemKey*)XMALLOC(sizeof(*key), HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    ct = (byte*)XMALLOC(WC_ML_KEM_MAX_CIPHER_TEXT_SIZE, HEAP_HINT,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    nb = (MlKemNbCtx*)XMALLOC(sizeof(*nb), HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    if (key == NULL || ct == NULL || nb == NULL) {
+        ERROR_OUT(WC_TEST_RET_ENC_ERRNO, out);
+    }
+#endif
+    XMEMSET(nb, 0, sizeof(*nb));
+
+    ret = wc_MlKemKey_Init(key, type, HEAP_HINT, devId);
+    if (ret != 0)
+        ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+    key_inited = 1;
+    ret = wc_MlKemKey_MakeKey(key, rng);
+    if (ret != 0)
+        ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+    ret = wc_MlKemKey_CipherTextSize(key, &ctSz);
+    if (ret != 0)
+        ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+    ret = wc_MlKemKey_Encapsulate(key, ct, ss, rng);
+    if (ret != 0)
+        ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+
+    /* Second pass: flipped bit - implicit rejection secret. */
+    for (t = 0; t < 2; t++) {
+        if (t == 1)
+            ct[ctSz / 2] ^= 0x01;
+        ret = wc_MlKemKey_SetNonBlock(key, NULL);
+        if (ret != 0)
+            ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+        ret = wc_MlKemKey_Decapsulate(key, ss_blk, ct, ctSz);
+        if (ret != 0)
+            ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+
+        ret = wc_MlKemKey_SetNonBlock(key, nb);
+        if (ret != 0)
+            ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+        for (calls = 0; calls < 100; calls++) {
+            ret = wc_MlKemKey_Decapsulate(key, ss_nb, ct, ctSz);
+            if (ret != MP_WOULDBLOCK)
+                break;
+        }
+    #if defined(DEBUG_WOLFSSL) || defined(WOLFSSL_DEBUG_NONBLOCK)
+        fprintf(stderr, "ML-KEM non-block decapsulate: %d times\n", calls + 1);
+    #endif
+        if (ret != 0)
+            ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+        if (XMEMCMP(ss_nb, ss_blk, sizeof(ss_nb)) != 0)
+            ERROR_OUT(WC_TEST_RET_ENC_NC, out);
+        if ((t == 0) && (XMEMCMP(ss_nb, ss, sizeof(ss_nb)) != 0))
+            ERROR_OUT(WC_TEST_RET_ENC_NC, out);
+        if ((t == 1) && (XMEMCMP(ss_nb, ss, sizeof(ss_nb)) == 0))
+            ERROR_OUT(WC_TEST_RET_ENC_NC, out);
+    #ifndef WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM
+        /* Decrypt, two or more vectors of A, noise, two or more polynomials
+         * of u, then v. */
+        if (calls + 1 < 7)
+            ERROR_OUT(WC_TEST_RET_ENC_NC, out);
+    #else
+        if (calls + 1 < 2)
+            ERROR_OUT(WC_TEST_RET_ENC_NC, out);
+    #endif
+    }
+
+out:
+    if (key_inited) {
+        wc_MlKemKey_Free(key);
+        wc_MlKemKey_FreeNonBlock(nb);
+    }
+#if defined(WOLFSSL_SMALL_STACK) && !defined(WOLFSSL_NO_MALLOC)
+    XFREE(nb, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(ct, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(key, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+    return ret;
+}
+#endif
+
 WOLFSSL_TEST_SUBROUTINE wc_test_ret_t mlkem_test(void)
 {
     wc_test_ret_t ret;
@@ -45063,6 +45171,21 @@ WOLFSSL_TEST_SUBROUTINE wc_test_ret_t mlkem_test(void)
 #endif
     }
 
+#if defined(WOLFSSL_WC_MLKEM) && defined(WOLFSSL_MLKEM_NONBLOCK) && \
+    !defined(WOLFSSL_MLKEM_NO_MAKE_KEY) && \
+    !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) && \
+    !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
+#ifndef WOLFSSL_NO_ML_KEM_512
+    ret = mlkem_nonblock_test(WC_ML_KEM_512, &rng);
+#elif !defined(WOLFSSL_NO_ML_KEM_768)
+    ret = mlkem_nonblock_test(WC_ML_KEM_768, &rng);
+#else
+    ret = mlkem_nonblock_test(WC_ML_KEM_1024, &rng);
+#endif
+    if (ret != 0)
+        goto out;
+#endif
+
     wc_FreeRng(&rng);
 
 #ifdef WOLFSSL_WC_MLKEM
@@ -48361,6 +48484,108 @@ out:
 }
 #endif
 
+#if defined(WOLFSSL_WC_DILITHIUM) && defined(WC_DILITHIUM_NONBLOCK) && \
+    !defined(WOLFSSL_DILITHIUM_NO_MAKE_KEY) && \
+    !defined(WOLFSSL_DILITHIUM_NO_SIGN) && \
+    !defined(WOLFSSL_DILITHIUM_NO_VERIFY)
+/* Verify a two certificate chain in steps the way a TLS handshake does when
+ * called back: every call starts again at the first signature of the chain.
+ */
+static wc_test_ret_t dilithium_nonblock_chain_test(int param, WC_RNG* rng)
+{
+    wc_test_ret_t ret;
+#if defined(WOLFSSL_SMALL_STACK) && !defined(WOLFSSL_NO_MALLOC)
+    dilithium_key* key = NULL;
+    byte* sig = NULL;
+    dilithium_nb_ctx* nb = NULL;
+#else
+    dilithium_key  key[2];
+    byte sig[2 * DILITHIUM_MAX_SIG_SIZE];
+    dilithium_nb_ctx nb[1];
+#endif
+    word32 sigLen[2];
+    byte msg[2][8] = {
+        { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 },
+        { 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f }
+    };
+    int res[2];
+    int i;
+    int calls;
+    int keys = 0;
+
+#if defined(WOLFSSL_SMALL_STACK) && !defined(WOLFSSL_NO_MALLOC)
+    key = (dilithium_key*)XMALLOC(2 * sizeof(*key), HEAP_HINT,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    sig = (byte*)XMALLOC(2 * DILITHIUM_MAX_SIG_SIZE, HEAP_HINT,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    nb = (dilithium_nb_ctx*)XMALLOC(sizeof(*nb), HEAP_HINT,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    if (key == NULL || sig == NULL || nb == NULL) {
+        ERROR_OUT(WC_TEST_RET_ENC_ERRNO, out);
+    }
+#endif
+    XMEMSET(nb, 0, sizeof(*nb));
+
+    /* Key 0 signs for the intermediate, key 1 for the leaf. */
+    for (i = 0; i < 2; i++) {
+        ret = wc_dilithium_init(&key[i]);
+        if (ret != 0)
+            ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+        keys++;
+        ret = wc_dilithium_set_level(&key[i], param);
+        if (ret != 0)
+            ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+        ret = wc_dilithium_make_key(&key[i], rng);
+        if (ret != 0)
+            ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+        sigLen[i] = DILITHIUM_MAX_SIG_SIZE;
+        ret = wc_dilithium_sign_msg(msg[i], (word32)sizeof(msg[i]),
+            sig + i * DILITHIUM_MAX_SIG_SIZE, &sigLen[i], &key[i], rng);
+        if (ret != 0)
+            ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+        ret = wc_dilithium_set_nonblock(&key[i], nb);
+        if (ret != 0)
+            ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+    }
+
+    /* One step per call - the intermediate must not be verified again once
+     * the leaf is in progress. */
+    for (calls = 0; calls < 1000; calls++) {
+        for (i = 0; i < 2; i++) {
+            res[i] = 0;
+            ret = wc_dilithium_verify_msg(sig + i * DILITHIUM_MAX_SIG_SIZE,
+                sigLen[i], msg[i], (word32)sizeof(msg[i]), &res[i], &key[i]);
+            if (ret != 0)
+                break;
+        }
+        if (ret != MP_WOULDBLOCK)
+            break;
+    }
+#if defined(DEBUG_WOLFSSL) || defined(WOLFSSL_DEBUG_NONBLOCK)
+    fprintf(stderr, "ML-DSA non-block chain verify: %d times\n", calls + 1);
+#endif
+    if (ret != 0)
+        ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+    if ((res[0] != 1) || (res[1] != 1))
+        ERROR_OUT(WC_TEST_RET_ENC_NC, out);
+    /* Each verification was done in more than one call. */
+    if (nb->yields < 2)
+        ERROR_OUT(WC_TEST_RET_ENC_NC, out);
+
+out:
+    for (i = 0; i < keys; i++)
+        wc_dilithium_free(&key[i]);
+    if (keys > 0)
+        wc_dilithium_free_nonblock(nb);
+#if defined(WOLFSSL_SMALL_STACK) && !defined(WOLFSSL_NO_MALLOC)
+    XFREE(nb, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(sig, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(key, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+    return ret;
+}
+#endif
+
 
 #if (defined(WOLFSSL_DILITHIUM_PRIVATE_KEY) && \
      !defined(WOLFSSL_DILITHIUM_NO_SIGN)) || \
@@ -48657,6 +48882,21 @@ WOLFSSL_TEST_SUBROUTINE wc_test_ret_t dilithium_test(void)
 #endif
 #endif
 
+#if defined(WOLFSSL_WC_DILITHIUM) && defined(WC_DILITHIUM_NONBLOCK) && \
+    !defined(WOLFSSL_DILITHIUM_NO_MAKE_KEY) && \
+    !defined(WOLFSSL_DILITHIUM_NO_SIGN) && \
+    !defined(WOLFSSL_DILITHIUM_NO_VERIFY)
+#ifndef WOLFSSL_NO_ML_DSA_44
+    ret = dilithium_nonblock_chain_test(WC_ML_DSA_44, &rng);
+#elif !defined(WOLFSSL_NO_ML_DSA_65)
+    ret = dilithium_nonblock_chain_test(WC_ML_DSA_65, &rng);
+#else
+    ret = dilithium_nonblock_chain_test(WC_ML_DSA_87, &rng);
+#endif
+    if (ret != 0)
+        ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+#endif
+
 #if (defined(WOLFSSL_DILITHIUM_PRIVATE_KEY) && \
      !defined(WOLFSSL_DILITHIUM_NO_SIGN)) || \
     (defined(WOLFSSL_DILITHIUM_PUBLIC_KEY) && \
@@ -2352,6 +2352,9 @@ typedef struct {
     word32 bufferSize;   /* current buffer size */
     byte   dynamicFlag;  /* dynamic memory currently in use */
     byte   offset;       /* alignment offset attempt */
+#if defined(WOLFSSL_ZERO_COPY_RX) || defined(WOLFSSL_ZERO_COPY_TX)
+    byte   borrowed;     /* buffer is lent by the I/O layer, not heap */
+#endif
 } bufferStatic;
 
 /* Cipher Suites holder */
@@ -2606,6 +2609,34 @@ struct WOLFSSL_CRL {
     #define TP_TABLE_SIZE 11
 #endif
 
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+#if defined(NO_SHA256) || defined(NO_HMAC)
+    #error "WOLFSSL_VERIFIED_CERT_CACHE requires SHA-256 and HMAC"
+#endif
+#ifndef WOLFSSL_VERIFIED_CERT_CACHE_SZ
+    #define WOLFSSL_VERIFIED_CERT_CACHE_SZ 4
+#endif
+
+/* Peer certificate whose signature has been checked against a CA. */
+typedef struct VerifiedCert {
+    byte   certHash[WC_SHA256_DIGEST_SIZE]; /* SHA-256 of DER certificate */
+    byte   caHash[SIGNER_DIGEST_SIZE];      /* key id hash of signing CA */
+    word32 created;                         /* LowResTimer() when verified */
+    byte   mac[WC_SHA256_DIGEST_SIZE];      /* HMAC-SHA256 of above fields */
+} VerifiedCert;
+
+#ifdef WOLFSSL_PQC_NONBLOCK
+/* Cache lookup of a certificate in a Certificate message that is processed
+ * again after WC_PENDING_E. */
+typedef struct VerifiedCertLookup {
+    byte   certHash[WC_SHA256_DIGEST_SIZE]; /* SHA-256 of DER certificate */
+    byte   caHash[SIGNER_DIGEST_SIZE];      /* key id hash of signing CA */
+    byte   set;                             /* looked up in this message */
+    byte   cached;                          /* found in the cache */
+} VerifiedCertLookup;
+#endif
+#endif
+
 /* wolfSSL Certificate Manager */
 struct WOLFSSL_CERT_MANAGER {
     Signer*         caTable[CA_TABLE_SIZE]; /* the CA signer table */
@@ -2668,6 +2699,15 @@ struct WOLFSSL_CERT_MANAGER {
 #ifdef HAVE_CRL_UPDATE_CB
     CbUpdateCRL    cbUpdateCRL; /* notify thru cb that crl has updated */
 #endif
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+    VerifiedCert    verified[WOLFSSL_VERIFIED_CERT_CACHE_SZ]; /* newest 1st */
+    word32          verifiedCnt;        /* number of cached certificates */
+    word32          verifiedMaxAge;     /* seconds, 0 disables the cache */
+    word32          verifiedHits;       /* signature checks skipped */
+    word32          verifiedMisses;     /* lookups that needed a check */
+    byte            verifiedKey[WC_SHA256_DIGEST_SIZE]; /* entry MAC key */
+    byte            verifiedKeySz;      /* bytes of verifiedKey, 0 unset */
+#endif
 };
 
 WOLFSSL_LOCAL int CM_SaveCertCache(WOLFSSL_CERT_MANAGER* cm,
@@ -2681,6 +2721,14 @@ WOLFSSL_LOCAL int CM_MemRestoreCertCache(WOLFSSL_CERT_MANAGER* cm,
 WOLFSSL_LOCAL int CM_GetCertCacheMemSize(WOLFSSL_CERT_MANAGER* cm);
 WOLFSSL_LOCAL int CM_VerifyBuffer_ex(WOLFSSL_CERT_MANAGER* cm, const byte* buff,
                                      long sz, int format, int prev_err);
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+WOLFSSL_LOCAL int CM_VerifiedCertFind(WOLFSSL_CERT_MANAGER* cm,
+                                      const byte* certHash, byte* caHash);
+WOLFSSL_LOCAL int CM_VerifiedCertAdd(WOLFSSL_CERT_MANAGER* cm,
+                                     const byte* certHash, const byte* caHash);
+WOLFSSL_LOCAL void CM_VerifiedCertRemove(WOLFSSL_CERT_MANAGER* cm,
+                                         const byte* certHash);
+#endif
 
 
 #ifndef NO_CERTS
@@ -3599,6 +3647,15 @@ WOLFSSL_LOCAL int TLSX_KeyShare_Parse(WOLFSSL* ssl, const byte* input,
         word16 length, byte msgType);
 WOLFSSL_LOCAL int TLSX_KeyShare_Parse_ClientHello(const WOLFSSL* ssl,
         const byte* input, word16 length, TLSX** extensions);
+#ifdef WOLFSSL_MLKEM_KEY_REUSE
+WOLFSSL_LOCAL void TLSX_KeyShare_FreeMlKemReuse(WOLFSSL_CTX* ctx);
+#endif
+#ifdef WOLFSSL_MLKEM_KEY_POOL
+WOLFSSL_LOCAL void TLSX_KeyShare_FreeMlKemPool(WOLFSSL_CTX* ctx);
+#endif
+#ifdef WOLFSSL_PQC_NONBLOCK
+WOLFSSL_LOCAL void TLSX_FreePqcNonBlock(WOLFSSL* ssl);
+#endif
 #ifdef WOLFSSL_DUAL_ALG_CERTS
 WOLFSSL_LOCAL int TLSX_CKS_Parse(WOLFSSL* ssl, byte* input,
                                  word16 length, TLSX** extensions);
@@ -3752,6 +3809,53 @@ typedef struct {
 } StaticKeyExchangeInfo_t;
 #endif /* WOLFSSL_STATIC_EPHEMERAL */
 
+#ifdef WOLFSSL_MLKEM_KEY_REUSE
+/* Client ML-KEM key pair kept by the context for use in more than one
+ * handshake. See wolfSSL_CTX_SetMlKemKeyReuse(). */
+typedef struct MlKemKeyReuse {
+    byte*  pubKey;          /* Encoded public key, NULL when none cached */
+    byte*  privKey;         /* Encoded private key */
+    word32 pubKeyLen;
+    word32 privKeyLen;
+    word32 created;         /* LowResTimer() when the pair was generated */
+    word32 uses;            /* Handshakes that have used the pair */
+    word32 maxUses;         /* Handshakes per pair, 0 or 1 disables reuse */
+    word32 maxAge;          /* Seconds a pair may be used, 0 for no limit */
+    word32 generated;       /* Statistics: key pairs generated */
+    word32 reused;          /* Statistics: key shares from a cached pair */
+    word16 group;           /* Named group of the cached pair */
+} MlKemKeyReuse;
+#endif /* WOLFSSL_MLKEM_KEY_REUSE */
+
+#ifdef WOLFSSL_MLKEM_KEY_POOL
+#ifndef WOLFSSL_MLKEM_KEY_POOL_SZ
+    #define WOLFSSL_MLKEM_KEY_POOL_SZ   2
+#endif
+/* Client ML-KEM key pair generated ahead of the handshake.
+ * See wolfSSL_CTX_MlKemKeyPool_Generate(). */
+typedef struct MlKemPoolKey {
+    byte*  pubKey;          /* Encoded public key */
+    byte*  privKey;         /* Encoded private key */
+    word32 pubKeyLen;
+    word32 privKeyLen;
+    word16 group;           /* Named group of the key pair */
+} MlKemPoolKey;
+#endif /* WOLFSSL_MLKEM_KEY_POOL */
+
+#ifdef WOLFSSL_PQC_NONBLOCK
+    #if !defined(WC_DILITHIUM_NONBLOCK) || !defined(WOLFSSL_MLKEM_NONBLOCK)
+        #error "WOLFSSL_PQC_NONBLOCK requires WC_DILITHIUM_NONBLOCK and" \
+               " WOLFSSL_MLKEM_NONBLOCK"
+    #endif
+    #if !defined(WOLFSSL_DTLS13) || defined(WOLFSSL_ASYNC_CRYPT) || \
+        defined(WOLFSSL_TLSX_PQC_MLKEM_STORE_OBJ)
+        /* Pending handshake messages are processed again from the DTLS
+         * message list, decoding keys again. */
+        #error "WOLFSSL_PQC_NONBLOCK requires WOLFSSL_DTLS13, no" \
+               " WOLFSSL_ASYNC_CRYPT and no WOLFSSL_TLSX_PQC_MLKEM_STORE_OBJ"
+    #endif
+#endif
+
 
 /* wolfSSL context type */
 struct WOLFSSL_CTX {
@@ -3881,6 +3985,12 @@ struct WOLFSSL_CTX {
 #if defined(WOLFSSL_STATIC_EPHEMERAL) && !defined(SINGLE_THREADED)
     byte        staticKELockInit:1;
 #endif
+#if defined(WOLFSSL_MLKEM_KEY_REUSE) && !defined(SINGLE_THREADED)
+    byte        mlkemReuseLockInit:1;
+#endif
+#if defined(WOLFSSL_MLKEM_KEY_POOL) && !defined(SINGLE_THREADED)
+    byte        mlkemPoolLockInit:1;
+#endif
 #if defined(WOLFSSL_DTLS) && defined(WOLFSSL_SCTP)
     byte        dtlsSctp:1;         /* DTLS-over-SCTP mode */
 #endif
@@ -3944,6 +4054,14 @@ struct WOLFSSL_CTX {
 #endif /* WOLFSSL_WOLFSENTRY_HOOKS */
     CallbackIORecv CBIORecv;
     CallbackIOSend CBIOSend;
+#ifdef WOLFSSL_ZERO_COPY_RX
+    CallbackIORecvZeroCopy CBIORecvZeroCopy; /* lend a whole datagram */
+    CallbackIORecvRelease  CBIORecvRelease;  /* take a lent datagram back */
+#endif
+#ifdef WOLFSSL_ZERO_COPY_TX
+    CallbackIOSendGetBuffer CBIOSendGetBuffer; /* lend the next TX buffer */
+    CallbackIOSendRelease   CBIOSendRelease;   /* take a lent buffer back */
+#endif
 #ifdef WOLFSSL_DTLS
     CallbackGenCookie CBIOCookie;       /* gen cookie callback */
 #endif /* WOLFSSL_DTLS */
@@ -4179,6 +4297,26 @@ struct WOLFSSL_CTX {
     wolfSSL_Mutex staticKELock;
     #endif
 #endif
+#ifdef WOLFSSL_MLKEM_KEY_REUSE
+    MlKemKeyReuse mlkemReuse;
+    #ifndef SINGLE_THREADED
+    wolfSSL_Mutex mlkemReuseLock;
+    #endif
+#endif
+#ifdef WOLFSSL_MLKEM_KEY_POOL
+    MlKemPoolKey mlkemPool[WOLFSSL_MLKEM_KEY_POOL_SZ]; /* oldest first */
+    int          mlkemPoolCnt;
+    #ifndef SINGLE_THREADED
+    wolfSSL_Mutex mlkemPoolLock;
+    #endif
+#endif
+#if defined(WOLFSSL_DTLS13) && defined(WOLFSSL_DTLS13_RTT)
+    /* Latest round trip estimate of any connection, new connections start
+     * their retransmission timer from it instead of DTLS13_RTO_INIT_MS */
+    word32       dtls13Srtt;
+    word32       dtls13Rttvar;
+    byte         dtls13RttValid;
+#endif
 #ifdef WOLFSSL_QUIC
     struct {
         const WOLFSSL_QUIC_METHOD *method;
@@ -5759,6 +5897,21 @@ typedef struct Dtls13RecordNumber {
     w64wrapper seq;
 } Dtls13RecordNumber;
 
+#ifdef WOLFSSL_DTLS13_RTT
+/* Retransmission timeout bounds in milliseconds, see RFC 6298 and RFC 9147
+ * section 5.8.2. The minimum is below RFC 6298's one second as the timer runs
+ * on WOLFSSL_DTLS13_TIMER_MS() instead of LowResTimer(). */
+#ifndef DTLS13_RTO_INIT_MS
+    #define DTLS13_RTO_INIT_MS 1000
+#endif
+#ifndef DTLS13_RTO_MIN_MS
+    #define DTLS13_RTO_MIN_MS 50
+#endif
+#ifndef DTLS13_RTO_MAX_MS
+    #define DTLS13_RTO_MAX_MS 60000
+#endif
+#endif /* WOLFSSL_DTLS13_RTT */
+
 typedef struct Dtls13Rtx {
 #ifdef WOLFSSL_RW_THREADED
     wolfSSL_Mutex mutex;
@@ -5768,6 +5921,17 @@ typedef struct Dtls13Rtx {
     Dtls13RtxRecord **rtxRecordTailPtr;
     Dtls13RecordNumber *seenRecords;
     word32 lastRtx;
+#ifdef WOLFSSL_DTLS13_RTT
+    word32 srtt;        /* smoothed round trip time in ms, 0 = no sample yet */
+    word32 rttvar;      /* round trip time variation in ms */
+    word32 rto;         /* retransmission timeout in ms */
+    word32 flightSent;  /* when the unacknowledged flight was first sent */
+    word32 timerStart;  /* when the retransmission timer was last armed */
+    word32 rttSamples;  /* round trip times measured */
+    word32 timeouts;    /* expired retransmission timers */
+    byte rttValid;      /* srtt and rttvar hold an estimate */
+    byte rttPending;    /* flightSent may be sampled (not retransmitted) */
+#endif
     byte triggeredRtxs; /* Unused? */
     byte sendAcks;
     byte retransmit;
@@ -5851,6 +6015,14 @@ struct WOLFSSL {
 #endif /* WOLFSSL_WOLFSENTRY_HOOKS */
     CallbackIORecv  CBIORecv;
     CallbackIOSend  CBIOSend;
+#ifdef WOLFSSL_ZERO_COPY_RX
+    CallbackIORecvZeroCopy CBIORecvZeroCopy;
+    CallbackIORecvRelease  CBIORecvRelease;
+#endif
+#ifdef WOLFSSL_ZERO_COPY_TX
+    CallbackIOSendGetBuffer CBIOSendGetBuffer;
+    CallbackIOSendRelease   CBIOSendRelease;
+#endif
 #ifdef WOLFSSL_STATIC_MEMORY
     WOLFSSL_HEAP_HINT heap_hint;
 #endif
@@ -5999,6 +6171,13 @@ struct WOLFSSL {
     dilithium_key*  peerDilithiumKey;
     byte            peerDilithiumKeyPresent;
 #endif
+#ifdef WOLFSSL_PQC_NONBLOCK
+    dilithium_nb_ctx*   dilithiumNb;    /* ML-DSA verify over many calls */
+    struct MlKemNbCtx*  mlkemNb;        /* ML-KEM decaps over many calls */
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+    VerifiedCertLookup* verifiedLookup; /* per cert of message, one lookup */
+#endif
+#endif
 #ifdef HAVE_LIBZ
     z_stream        c_stream;           /* compression   stream */
     z_stream        d_stream;           /* decompression stream */
@@ -6698,6 +6877,9 @@ WOLFSSL_LOCAL WC_RNG* WOLFSSL_RSA_GetRNG(WOLFSSL_RSA *rsa, WC_RNG **tmpRNG,
     #if !defined(NO_SKID) && !defined(GetCAByName)
         WOLFSSL_LOCAL Signer* GetCAByName(void* vp, byte* hash);
     #endif
+    #ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+        WOLFSSL_LOCAL int PrepareMlDsaSigners(WOLFSSL_CERT_MANAGER* cm);
+    #endif
 #endif /* !NO_CERTS */
 WOLFSSL_LOCAL int  BuildTlsHandshakeHash(WOLFSSL* ssl, byte* hash,
                                    word32* hashLen);
@@ -7090,6 +7272,9 @@ WOLFSSL_LOCAL int Dtls13HashHandshake(WOLFSSL* ssl, const byte* input,
 WOLFSSL_LOCAL int Dtls13HashClientHello(const WOLFSSL* ssl, byte* hash,
         int* hashSz, const byte* body, word32 length, CipherSpecs* specs);
 WOLFSSL_LOCAL void Dtls13FreeFsmResources(WOLFSSL* ssl);
+#ifdef WOLFSSL_DTLS13_RTT
+WOLFSSL_LOCAL void Dtls13RttInit(WOLFSSL* ssl);
+#endif
 WOLFSSL_LOCAL void Dtls13RtxFlushBuffered(WOLFSSL* ssl,
         byte keepNewSessionTicket);
 WOLFSSL_LOCAL int Dtls13RtxTimeout(WOLFSSL* ssl);
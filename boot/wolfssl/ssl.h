@@ -4254,6 +4254,14 @@ WOLFSSL_API void wolfSSL_CTX_SetPerformTlsRecordProcessingCb(WOLFSSL_CTX* ctx,
                                 WOLFSSL_CERT_MANAGER* cm, byte type);
     WOLFSSL_API int wolfSSL_CertManagerUnloadIntermediateCerts(
         WOLFSSL_CERT_MANAGER* cm);
+#ifdef WOLFSSL_VERIFIED_CERT_CACHE
+    WOLFSSL_API int wolfSSL_CertManagerSetVerifiedCertCacheKey(
+        WOLFSSL_CERT_MANAGER* cm, const byte* key, word32 keySz);
+    WOLFSSL_API int wolfSSL_CertManagerSetVerifiedCertCache(
+        WOLFSSL_CERT_MANAGER* cm, word32 maxAge);
+    WOLFSSL_API int wolfSSL_CertManagerGetVerifiedCertCacheStats(
+        WOLFSSL_CERT_MANAGER* cm, word32* hits, word32* misses);
+#endif
 #ifdef WOLFSSL_TRUST_PEER_CERT
     WOLFSSL_API int wolfSSL_CertManagerUnload_trust_peers(
         WOLFSSL_CERT_MANAGER* cm);
@@ -4704,6 +4712,28 @@ WOLFSSL_API int wolfSSL_UseKeyShare(WOLFSSL* ssl, word16 group);
 WOLFSSL_API int wolfSSL_NoKeyShares(WOLFSSL* ssl);
 #endif
 
+#ifdef WOLFSSL_MLKEM_KEY_REUSE
+WOLFSSL_API int wolfSSL_CTX_SetMlKemKeyReuse(WOLFSSL_CTX* ctx, word32 maxUses,
+    word32 maxAge);
+WOLFSSL_API int wolfSSL_CTX_GetMlKemKeyReuseStats(WOLFSSL_CTX* ctx,
+    word32* generated, word32* reused);
+#endif
+#ifdef WOLFSSL_MLKEM_KEY_POOL
+WOLFSSL_API int wolfSSL_CTX_MlKemKeyPool_Generate(WOLFSSL_CTX* ctx,
+    word16 group);
+WOLFSSL_API int wolfSSL_CTX_MlKemKeyPool_Count(WOLFSSL_CTX* ctx);
+#endif
+#ifdef WOLFSSL_PQC_NONBLOCK
+WOLFSSL_API int wolfSSL_UsePqcNonBlock(WOLFSSL* ssl, word32 cycles);
+WOLFSSL_API int wolfSSL_GetPqcNonBlockStats(WOLFSSL* ssl, word32* steps,
+    word32* yields);
+#endif
+#if defined(WOLFSSL_DTLS13) && defined(WOLFSSL_DTLS13_RTT)
+WOLFSSL_API int wolfSSL_dtls13_rtx_timer_expired(WOLFSSL* ssl);
+WOLFSSL_API int wolfSSL_GetDtls13RttStats(WOLFSSL* ssl, word32* srtt,
+    word32* rttvar, word32* rto, word32* samples, word32* timeouts);
+#endif
+
 #ifdef WOLFSSL_DUAL_ALG_CERTS
 #define WOLFSSL_CKS_SIGSPEC_NATIVE      0x0001
 #define WOLFSSL_CKS_SIGSPEC_ALTERNATIVE 0x0002
@@ -1462,6 +1462,12 @@ struct SignatureCtx {
     int typeH;
     int digestSz;
     word32 keyOID;
+#ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+    struct dilithium_key* caDilithium; /* prepared CA key, owned by signer */
+#endif
+#ifdef WC_DILITHIUM_NONBLOCK
+    struct dilithium_nb_ctx* dilithiumNb; /* verify ML-DSA in steps */
+#endif
 #ifdef WOLFSSL_ASYNC_CRYPT
     WC_ASYNC_DEV* asyncDev;
     void* asyncCtx;
@@ -1984,6 +1990,9 @@ struct Signer {
     byte*   sapkiDer;
     int     sapkiLen;
 #endif /* WOLFSSL_DUAL_ALG_CERTS */
+#ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+    struct dilithium_key* mldsaKey;  /* public key with A, t1 and tr cached */
+#endif
     byte type;
 
     Signer* next;
@@ -2141,6 +2150,10 @@ WOLFSSL_LOCAL int CheckCertSignaturePubKey(const byte* cert, word32 certSz,
     WOLFSSL_API int wc_CheckCertSigPubKey(const byte* cert, word32 certSz,
                                         void* heap, const byte* pubKey,
                                         word32 pubKeySz, int pubKeyOID);
+    #ifdef WC_DILITHIUM_NONBLOCK
+    WOLFSSL_LOCAL int CheckCertSignatureNonBlock(const byte* cert,
+        word32 certSz, void* heap, void* cm, struct dilithium_nb_ctx* nb);
+    #endif
 #endif /* OPENSSL_EXTRA || WOLFSSL_SMALL_CERT_VERIFY */
 
 #if (defined(HAVE_ED25519) && defined(HAVE_ED25519_KEY_IMPORT) || \
@@ -2198,6 +2211,9 @@ WOLFSSL_LOCAL void    FreeSigner(Signer* signer, void* heap);
 WOLFSSL_LOCAL void    FreeSignerTable(Signer** table, int rows, void* heap);
 WOLFSSL_LOCAL void    FreeSignerTableType(Signer** table, int rows, byte type,
                                           void* heap);
+#ifdef WOLFSSL_MLDSA_CA_PRECOMPUTE
+WOLFSSL_LOCAL int     PrepareSignerMlDsaKey(Signer* signer, void* heap);
+#endif
 #ifdef WOLFSSL_TRUST_PEER_CERT
 WOLFSSL_LOCAL void    FreeTrustedPeer(TrustedPeerCert* tp, void* heap);
 WOLFSSL_LOCAL void    FreeTrustedPeerTable(TrustedPeerCert** table, int rows,
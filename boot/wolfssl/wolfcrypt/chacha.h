@@ -72,6 +72,10 @@ Block counter is located at index 12.
     #ifndef NO_CHACHA_ASM
         #define USE_ARM_CHACHA_SPEEDUP
     #endif
+#elif defined(WOLFSSL_RISCV32_ASM)
+    #ifndef NO_CHACHA_ASM
+        #define USE_RISCV32_CHACHA_SPEEDUP
+    #endif
 #endif
 
 enum {
@@ -87,7 +91,7 @@ typedef struct ChaCha {
 #endif
     word32 left;                            /* number of bytes leftover */
 #if defined(USE_INTEL_CHACHA_SPEEDUP) || defined(USE_ARM_CHACHA_SPEEDUP) || \
-    defined(WOLFSSL_RISCV_ASM)
+    defined(WOLFSSL_RISCV_ASM) || defined(USE_RISCV32_CHACHA_SPEEDUP)
     word32 over[CHACHA_CHUNK_WORDS];
 #endif
 } ChaCha;
@@ -123,6 +127,13 @@ WOLFSSL_LOCAL void wc_chacha_crypt_bytes(ChaCha* ctx, byte* c, const byte* m,
 
 #endif
 
+#if defined(USE_RISCV32_CHACHA_SPEEDUP)
+
+WOLFSSL_LOCAL void wc_chacha_riscv32_crypt_bytes(ChaCha* ctx, byte* c,
+    const byte* m, word32 len);
+
+#endif
+
 
 #ifdef __cplusplus
     } /* extern "C" */
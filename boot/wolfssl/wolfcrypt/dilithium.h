@@ -88,6 +88,15 @@
         !defined(WC_DILITHIUM_CACHE_MATRIX_A)
     #define WC_DILITHIUM_CACHE_MATRIX_A
 #endif
+#if defined(WOLFSSL_DILITHIUM_VERIFY_FUSED) && \
+        !defined(WOLFSSL_DILITHIUM_VERIFY_SMALL_MEM)
+    #define WOLFSSL_DILITHIUM_VERIFY_SMALL_MEM
+#endif
+
+#if defined(WOLFSSL_RISCV32_ASM) && !defined(WC_MLDSA_NO_ASM) && \
+        !defined(WOLFSSL_DILITHIUM_SMALL)
+    #define USE_RISCV32_MLDSA_SPEEDUP
+#endif
 
 #ifdef __cplusplus
     extern "C" {
@@ -665,6 +674,49 @@ typedef struct wc_dilithium_params {
 } wc_dilithium_params;
 #endif
 
+#if defined(WOLFSSL_WC_DILITHIUM) && defined(WC_DILITHIUM_NONBLOCK)
+/* Number of finished verifications a non-blocking context remembers.
+ * Must be at least the number of signatures in the longest certificate chain
+ * verified with one context. */
+#ifndef WC_DILITHIUM_NB_DONE_CNT
+    #define WC_DILITHIUM_NB_DONE_CNT    4
+#endif
+/* Size of the hash of the signature identifying a verification. */
+#define DILITHIUM_NB_SIG_HASH_SZ    32
+/* mu and hash of signature identify a verification. */
+#define DILITHIUM_NB_ID_SZ          (DILITHIUM_MU_SZ + DILITHIUM_NB_SIG_HASH_SZ)
+
+/* State of a verification performed in steps.
+ *
+ * Outlives the key objects used to verify so that a caller can import the
+ * key again each time it is called back. */
+typedef struct dilithium_nb_ctx {
+    /* Cycles to spend in each call, 0 for one step per call. */
+    word32 budget;
+    /* Verification being performed. */
+    byte id[DILITHIUM_NB_ID_SZ];
+    byte state;
+    byte r;
+    byte s;
+    byte valid;
+    /* Seed with room for the column and row of matrix A. */
+    byte seed[DILITHIUM_PUB_SEED_SZ + 2];
+    /* z | c | w | a | block */
+    sword32* buf;
+    void* heap;
+    /* Results of the last verifications finished, oldest overwritten. */
+    struct {
+        byte id[DILITHIUM_NB_ID_SZ];
+        byte res;
+        byte set;
+    } done[WC_DILITHIUM_NB_DONE_CNT];
+    byte doneIdx;
+    /* Number of steps performed and of calls that returned before done. */
+    word32 steps;
+    word32 yields;
+} dilithium_nb_ctx;
+#endif
+
 struct dilithium_key {
     byte pubKeySet;
     byte prvKeySet;
@@ -730,6 +782,10 @@ struct dilithium_key {
     byte pubVecSet;
 #endif
 #endif
+#ifdef WC_DILITHIUM_CACHE_PUB_VECTORS
+    byte tr[DILITHIUM_TR_SZ];
+    byte trSet;
+#endif
 #if defined(WOLFSSL_DILITHIUM_VERIFY_NO_MALLOC) && \
     defined(WOLFSSL_DILITHIUM_VERIFY_SMALL_MEM)
     sword32 z[DILITHIUM_MAX_L_VECTOR_COUNT];
@@ -744,6 +800,9 @@ struct dilithium_key {
     byte block[DILITHIUM_GEN_C_BLOCK_BYTES];
 #endif /* WOLFSSL_DILITHIUM_VERIFY_NO_MALLOC &&
         * WOLFSSL_DILITHIUM_VERIFY_SMALL_MEM */
+#ifdef WC_DILITHIUM_NONBLOCK
+    dilithium_nb_ctx* nb;
+#endif
 #endif /* WOLFSSL_WC_DILITHIUM */
 };
 
@@ -816,6 +875,13 @@ int wc_dilithium_init_label(dilithium_key* key, const char* label, void* heap,
 
 WOLFSSL_API
 int wc_dilithium_set_level(dilithium_key* key, byte level);
+#if defined(WOLFSSL_WC_DILITHIUM) && defined(WC_DILITHIUM_NONBLOCK) && \
+    !defined(WOLFSSL_DILITHIUM_NO_VERIFY)
+WOLFSSL_API
+int wc_dilithium_set_nonblock(dilithium_key* key, dilithium_nb_ctx* ctx);
+WOLFSSL_API
+void wc_dilithium_free_nonblock(dilithium_nb_ctx* ctx);
+#endif
 WOLFSSL_API
 int wc_dilithium_get_level(dilithium_key* key, byte* level);
 WOLFSSL_API
@@ -878,6 +944,11 @@ int wc_dilithium_export_key(dilithium_key* key, byte* priv, word32 *privSz,
 WOLFSSL_LOCAL int dilithium_get_oid_sum(dilithium_key* key, int* keyFormat);
 #endif /* WOLFSSL_DILITHIUM_NO_ASN1 */
 
+#ifdef WOLFSSL_BENCH_KERNELS
+WOLFSSL_LOCAL void dilithium_bench_ntt(sword32* r);
+WOLFSSL_LOCAL void dilithium_bench_invntt(sword32* r);
+#endif
+
 #ifndef WOLFSSL_DILITHIUM_NO_ASN1
 #if defined(WOLFSSL_DILITHIUM_PRIVATE_KEY)
 WOLFSSL_API int wc_Dilithium_PrivateKeyDecode(const byte* input,
@@ -977,6 +1048,11 @@ WOLFSSL_LOCAL void wc_mldsa_poly_sub_avx2(sword32* r, const sword32* a);
 WOLFSSL_LOCAL void wc_mldsa_poly_make_pos_avx2(sword32* a);
 #endif
 
+#ifdef USE_RISCV32_MLDSA_SPEEDUP
+WOLFSSL_LOCAL void wc_mldsa_ntt_riscv32(sword32* r);
+WOLFSSL_LOCAL void wc_mldsa_invntt_riscv32(sword32* r);
+#endif
+
 
 #define WC_ML_DSA_DRAFT         10
 
@@ -261,6 +261,14 @@ WOLFSSL_API void wolfSSL_SetLoggingPrefix(const char* prefix);
     #define WOLFSSL_TIME(n)  WC_DO_NOTHING
 #endif
 
+/* Named spans around the main handshake stages. The user maps them onto a
+ * tracer by defining WOLFSSL_TRACE_BEGIN(span), which returns a token, and
+ * WOLFSSL_TRACE_END(token), e.g. in user_settings.h. */
+#ifndef WOLFSSL_TRACE_BEGIN
+    #define WOLFSSL_TRACE_BEGIN(span)   0
+    #define WOLFSSL_TRACE_END(token)    (void)(token)
+#endif
+
 /* Certificate Debugging: WOLFSSL_MSG_CERT */
 #if defined(XVSNPRINTF) && !defined(NO_WOLFSSL_DEBUG_CERTS) && \
    (defined(DEBUG_WOLFSSL) || defined(WOLFSSL_DEBUG_CERTS))
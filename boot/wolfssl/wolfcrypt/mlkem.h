@@ -307,6 +307,9 @@ enum {
 
 /* Different structures for different implementations. */
 typedef struct MlKemKey MlKemKey;
+#ifdef WOLFSSL_MLKEM_NONBLOCK
+typedef struct MlKemNbCtx MlKemNbCtx;
+#endif
 
 
 #ifdef __cplusplus
@@ -346,6 +349,17 @@ WOLFSSL_API int wc_MlKemKey_EncodePrivateKey(MlKemKey* key, unsigned char* out,
 WOLFSSL_API int wc_MlKemKey_EncodePublicKey(MlKemKey* key, unsigned char* out,
     word32 len);
 
+#if defined(WOLFSSL_MLKEM_NONBLOCK) && !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
+WOLFSSL_API int wc_MlKemKey_SetNonBlock(MlKemKey* key, MlKemNbCtx* ctx);
+WOLFSSL_API void wc_MlKemKey_FreeNonBlock(MlKemNbCtx* ctx);
+#endif
+
+#ifdef WOLFSSL_MLKEM_MATRIX_CACHE
+WOLFSSL_API int wc_MlKemMatrixCache_Init(void);
+WOLFSSL_API void wc_MlKemMatrixCache_Free(void);
+WOLFSSL_API int wc_MlKemMatrixCache_GetStats(word32* hits, word32* misses);
+#endif
+
 
 #define KyberKey            MlKemKey
 
@@ -55,6 +55,10 @@
 #endif
 #endif
 
+#if defined(WOLFSSL_RISCV32_ASM) && !defined(NO_POLY1305_ASM)
+    #define USE_RISCV32_POLY1305_SPEEDUP
+#endif
+
 #if defined(USE_INTEL_POLY1305_SPEEDUP)
 #elif (defined(WC_HAS_SIZEOF_INT128_64BIT) || defined(WC_HAS_MSVC_64BIT) ||  \
        defined(WC_HAS_GCC_4_4_64BIT)) && !defined(WOLFSSL_W64_WRAPPER_TEST)
@@ -199,6 +203,11 @@ void poly1305_blocks_riscv64(Poly1305* ctx, const unsigned char *m,
 void poly1305_block_riscv64(Poly1305* ctx, const unsigned char *m);
 #endif
 
+#if defined(USE_RISCV32_POLY1305_SPEEDUP)
+void poly1305_blocks_riscv32(Poly1305* ctx, const unsigned char *m,
+    size_t bytes);
+#endif
+
 #ifdef __cplusplus
     } /* extern "C" */
 #endif
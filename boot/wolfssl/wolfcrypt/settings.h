@@ -4277,7 +4277,10 @@ extern void uITRON4_free(void *p) ;
 #if defined(NO_ASN_TIME) && !defined(WOLFSSL_NO_DEF_TICKET_ENC_CB)
     #define WOLFSSL_NO_DEF_TICKET_ENC_CB
 #endif
-#if defined(NO_ASN_TIME) && defined(HAVE_SESSION_TICKET)
+/* Tickets need a clock for their age, without ASN time the application has
+ * to supply TimeNowInMilliseconds() and define WOLFSSL_TICKET_USER_TIME */
+#if defined(NO_ASN_TIME) && defined(HAVE_SESSION_TICKET) && \
+    !defined(WOLFSSL_TICKET_USER_TIME)
     #undef HAVE_SESSION_TICKET
 #endif
 
@@ -782,7 +782,13 @@ enum {
             #define XREALLOC(p, n, h, t) ((void)(h), (void)(t), \
                 wolfSSL_Realloc((p), (n), __func__, __LINE__))
         #else
-            #define XMALLOC(s, h, t)     ((void)(h), (void)(t), \
+            /* Tells an allocator installed with wolfSSL_SetAllocators() the
+             * DYNAMIC_TYPE_* of the next block, e.g. to place it by lifetime.
+             */
+            #ifndef WOLFSSL_MEM_TYPE
+                #define WOLFSSL_MEM_TYPE(t)  (void)(t)
+            #endif
+            #define XMALLOC(s, h, t)     ((void)(h), WOLFSSL_MEM_TYPE(t), \
                 wolfSSL_Malloc((s)))
             #ifdef WOLFSSL_XFREE_NO_NULLNESS_CHECK
                 #define XFREE(p, h, t)   do { (void)(h); (void)(t); \
@@ -791,7 +797,7 @@ enum {
                 #define XFREE(p, h, t)   do { void* xp = (p); (void)(h); \
                     (void)(t); if (xp) wolfSSL_Free(xp); } while (0)
             #endif
-            #define XREALLOC(p, n, h, t) ((void)(h), (void)(t), \
+            #define XREALLOC(p, n, h, t) ((void)(h), WOLFSSL_MEM_TYPE(t), \
                 wolfSSL_Realloc((p), (n)))
         #endif /* WOLFSSL_DEBUG_MEMORY */
     #endif /* WOLFSSL_STATIC_MEMORY */
@@ -154,6 +154,83 @@
 #define NO_CODING     
 #define WOLFSSL_NO_PEM
 
+/* 
+ * 8. Zero-copy I/O
+ */
+#define WOLFSSL_ZERO_COPY_RX    // Decrypt in place from the ethmac RX slot
+#define WOLFSSL_ZERO_COPY_TX    // Build DTLS records in the ethmac TX slot
+
+/* 
+ * 9. RV32 assembly (ChaCha20-Poly1305 record protection, ML-KEM/ML-DSA NTT)
+ */
+#if defined(__riscv) && (__riscv_xlen == 32) && defined(__riscv_mul)
+#define WOLFSSL_RISCV32_ASM     // port/riscv/riscv-32-{chacha,poly1305,mlkem,mldsa}.c
+#endif
+
+/* 
+ * 10. Non-blocking PQC (make PQC_NONBLOCK=<cycles>)
+ */
+#ifdef WOLFSSL_PQC_NONBLOCK
+#define WC_DILITHIUM_NONBLOCK   // ML-DSA verify in slices
+#define WOLFSSL_MLKEM_NONBLOCK  // ML-KEM decapsulation in slices
+#include <stdint.h>
+extern uint64_t read_cycle64(void);
+#define WC_NONBLOCK_CYCLES()    read_cycle64()
+#endif
+
+/* 
+ * 11. Session resumption (make RESUME=1)
+ */
+#ifdef SESSION_RESUME
+#define WOLFSSL_TICKET_USER_TIME // TimeNowInMilliseconds() in main.c
+#endif
+
+/* 
+ * 12. DTLS Connection ID (make DTLS_CID=1)
+ */
+#ifdef DTLS_CID
+#define WOLFSSL_DTLS_CID        // RFC 9146/9147 connection_id extension
+#endif
+
+/* 
+ * 13. DTLS retransmission timer (make DTLS_RTT=1)
+ */
+#ifdef DTLS_RTT
+#define WOLFSSL_DTLS13_RTT      // RFC 6298 SRTT/RTTVAR retransmission timeout
+extern unsigned int DtlsTimerMs(void);
+#define WOLFSSL_DTLS13_TIMER_MS()   DtlsTimerMs()
+#endif
+
+/* 
+ * 14. Cycle tracing (make TRACE=1)
+ */
+#ifdef CYCLE_TRACE
+#include "trace.h"                  // Span ids and the ring in boot/trace.c
+#define WOLFSSL_TRACE_BEGIN(span)   trace_begin(span)
+#define WOLFSSL_TRACE_END(token)    trace_end(token)
+#endif
+
+/* 
+ * 15. Heap profile (make MEM_PROFILE=1)
+ */
+#ifdef MEM_PROFILE
+extern void *mem_call_site;         // Read by the allocators in mem_profile.c
+#define WOLFSSL_MEM_CALL_SITE(ra)   (mem_call_site = (ra))
+#endif
+
+/* 
+ * 16. ML-DSA verify (certificate chain and CertificateVerify)
+ */
+#define WOLFSSL_DILITHIUM_VERIFY_FUSED  // One row of A at a time, w1 streamed
+
+/* 
+ * 17. Heap arenas (make HEAP_ARENAS=1)
+ */
+#ifdef HEAP_ARENAS
+extern int mem_alloc_type;          // Read by ArenaMalloc() in mem_profile.c
+#define WOLFSSL_MEM_TYPE(t)         (mem_alloc_type = (t))
+#endif
+
 /* 
  * RNG Hook
  */
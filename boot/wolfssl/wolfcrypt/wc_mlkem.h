@@ -44,6 +44,10 @@
     #define WOLFSSL_MLKEM_NO_DECAPSULATE
 #endif
 
+#if defined(WOLFSSL_RISCV32_ASM) && !defined(WC_MLKEM_NO_ASM)
+    #define USE_RISCV32_MLKEM_SPEEDUP
+#endif
+
 #ifdef noinline
     #define MLKEM_NOINLINE noinline
 #elif defined(_MSC_VER)
@@ -108,6 +112,32 @@ enum {
 /* The data type of the pseudo-random function. */
 #define MLKEM_PRF_T     wc_Shake
 
+#ifdef WOLFSSL_MLKEM_NONBLOCK
+/* State of a decapsulation performed over a number of calls. */
+struct MlKemNbCtx {
+    /* Cycles to spend per call. 0 means one step per call. */
+    word32 budget;
+    /* Step to perform next. */
+    byte state;
+    /* Hash of the cipher text being decapsulated. */
+    byte id[WC_ML_KEM_SYM_SZ];
+    /* Hash of the public key decapsulating with. */
+    byte h[WC_ML_KEM_SYM_SZ];
+    /* Decrypted message and seed derived from it. */
+    byte msg[WC_ML_KEM_SYM_SZ];
+    byte kr[2 * WC_ML_KEM_SYM_SZ];
+    /* Re-encryption working memory: y, transposed A, mu, e1, e2, u and v. */
+    sword16* y;
+    /* Vector of A or polynomial of u to calculate next. */
+    byte row;
+    /* Dynamic memory allocation hint. */
+    void* heap;
+    /* Steps performed and calls that returned before the end. */
+    word32 steps;
+    word32 yields;
+};
+#endif
+
 /* ML-KEM key. */
 struct MlKemKey {
     /* Type of key: WC_ML_KEM_512, WC_ML_KEM_768, WC_ML_KEM_1024 */
@@ -140,6 +170,10 @@ struct MlKemKey {
     /* A matrix from key generation. */
     sword16 a[WC_ML_KEM_MAX_K * WC_ML_KEM_MAX_K * MLKEM_N];
 #endif
+#ifdef WOLFSSL_MLKEM_NONBLOCK
+    /* Context to decapsulate over a number of calls. */
+    MlKemNbCtx* nb;
+#endif
 };
 
 #ifdef __cplusplus
@@ -163,6 +197,16 @@ WOLFSSL_LOCAL
 void mlkem_encapsulate(const sword16* pub, sword16* bp, sword16* v,
     const sword16* at, sword16* sp, const sword16* ep, const sword16* epp,
     const sword16* m, int kp);
+#ifdef WOLFSSL_MLKEM_NONBLOCK
+WOLFSSL_LOCAL
+void mlkem_encapsulate_y(sword16* sp, int kp);
+WOLFSSL_LOCAL
+void mlkem_encapsulate_u(sword16* bp, const sword16* at, const sword16* sp,
+    const sword16* ep, int kp);
+WOLFSSL_LOCAL
+void mlkem_encapsulate_v(const sword16* pub, sword16* v, const sword16* sp,
+    const sword16* epp, const sword16* m, int kp);
+#endif
 #else
 WOLFSSL_LOCAL
 int mlkem_encapsulate_seeds(const sword16* pub, MLKEM_PRF_T* prf, sword16* bp,
@@ -176,6 +220,20 @@ void mlkem_decapsulate(const sword16* priv, sword16* mp, sword16* bp,
 WOLFSSL_LOCAL
 int mlkem_gen_matrix(MLKEM_PRF_T* prf, sword16* a, int kp, byte* seed,
     int transposed);
+#ifdef WOLFSSL_MLKEM_NONBLOCK
+WOLFSSL_LOCAL
+int mlkem_gen_matrix_row(MLKEM_PRF_T* prf, sword16* a, int kp, byte* seed,
+    int i);
+#endif
+
+#ifdef WOLFSSL_BENCH_KERNELS
+WOLFSSL_LOCAL
+void mlkem_bench_ntt(sword16* r);
+WOLFSSL_LOCAL
+void mlkem_bench_invntt(sword16* r);
+WOLFSSL_LOCAL
+void mlkem_bench_basemul_mont(sword16* r, const sword16* a, const sword16* b);
+#endif
 WOLFSSL_LOCAL
 int mlkem_get_noise(MLKEM_PRF_T* prf, int kp, sword16* vec1, sword16* vec2,
     sword16* poly, byte* seed);
@@ -359,6 +417,18 @@ WOLFSSL_LOCAL void mlkem_arm32_basemul_mont_add(sword16* r, const sword16* a,
 WOLFSSL_LOCAL void mlkem_arm32_csubq(sword16* p);
 WOLFSSL_LOCAL unsigned int mlkem_arm32_rej_uniform(sword16* p, unsigned int len,
     const byte* r, unsigned int rLen);
+#elif defined(USE_RISCV32_MLKEM_SPEEDUP)
+#define mlkem_ntt                   mlkem_riscv32_ntt
+#define mlkem_invntt                mlkem_riscv32_invntt
+#define mlkem_basemul_mont          mlkem_riscv32_basemul_mont
+#define mlkem_basemul_mont_add      mlkem_riscv32_basemul_mont_add
+
+WOLFSSL_LOCAL void mlkem_riscv32_ntt(sword16* r);
+WOLFSSL_LOCAL void mlkem_riscv32_invntt(sword16* r);
+WOLFSSL_LOCAL void mlkem_riscv32_basemul_mont(sword16* r, const sword16* a,
+    const sword16* b);
+WOLFSSL_LOCAL void mlkem_riscv32_basemul_mont_add(sword16* r, const sword16* a,
+    const sword16* b);
 #endif
 
 #ifdef __cplusplus
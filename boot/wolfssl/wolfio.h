@@ -736,6 +736,28 @@ WOLFSSL_API void wolfSSL_SSLSetIORecv(WOLFSSL *ssl, CallbackIORecv CBIORecv);
 WOLFSSL_API void wolfSSL_SSLSetIOSend(WOLFSSL *ssl, CallbackIOSend CBIOSend);
 WOLFSSL_API void wolfSSL_SSLDisableRead(WOLFSSL *ssl);
 WOLFSSL_API void wolfSSL_SSLEnableRead(WOLFSSL *ssl);
+#ifdef WOLFSSL_ZERO_COPY_RX
+/* Zero-copy DTLS receive: the I/O layer lends one whole datagram in *buf and
+ * returns its length (or a WOLFSSL_CBIO_ERR_* code). wolfSSL decrypts it in
+ * place and hands it back through the release callback once consumed. */
+typedef int  (*CallbackIORecvZeroCopy)(WOLFSSL *ssl, byte **buf, void *ctx);
+typedef void (*CallbackIORecvRelease)(WOLFSSL *ssl, byte *buf, void *ctx);
+WOLFSSL_API void wolfSSL_CTX_SetIORecvZeroCopy(WOLFSSL_CTX *ctx,
+    CallbackIORecvZeroCopy CBIORecvZeroCopy,
+    CallbackIORecvRelease CBIORecvRelease);
+#endif /* WOLFSSL_ZERO_COPY_RX */
+#ifdef WOLFSSL_ZERO_COPY_TX
+/* Zero-copy DTLS send: the I/O layer lends the buffer the next datagram will
+ * be sent from and stores its capacity in *sz, or returns NULL. Records are
+ * then built in place and the send callback is called with that same buffer.
+ * The release callback is called when wolfSSL stops using a lent buffer,
+ * whether it was sent or not. */
+typedef byte* (*CallbackIOSendGetBuffer)(WOLFSSL *ssl, int *sz, void *ctx);
+typedef void  (*CallbackIOSendRelease)(WOLFSSL *ssl, byte *buf, void *ctx);
+WOLFSSL_API void wolfSSL_CTX_SetIOSendZeroCopy(WOLFSSL_CTX *ctx,
+    CallbackIOSendGetBuffer CBIOSendGetBuffer,
+    CallbackIOSendRelease CBIOSendRelease);
+#endif /* WOLFSSL_ZERO_COPY_TX */
 /* deprecated old name */
 #define wolfSSL_SetIORecv wolfSSL_CTX_SetIORecv
 #define wolfSSL_SetIOSend wolfSSL_CTX_SetIOSend
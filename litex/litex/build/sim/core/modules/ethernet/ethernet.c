@@ -10,28 +10,39 @@
 #include "tapcfg.h"
 #include "modules.h"
 
+/* Frames read from the tap wait in a fixed ring, filled by event_handler()
+   and drained by ethernet_tick(). A full ring drops the frame, like a MAC
+   without free slots would. */
+#define ETH_RING_SIZE 64
+
 struct eth_packet_s {
   char data[2000];
   size_t len;
-  struct eth_packet_s *next;
 };
 
 struct session_s {
-  char *tx;
+  void *tx;
   char *tx_valid;
   char *tx_ready;
-  char *rx;
+  char *tx_last;
+  char *tx_last_be;
+  void *rx;
   char *rx_valid;
   char *rx_ready;
+  char *rx_last;
+  char *rx_last_be;
   char *sys_clk;
+  int dw;              /* bytes per clock: 1 (eth), 4 (eth32) or 8 (eth64) */
   tapcfg_t *tapcfg;
   int fd;
   char databuf[2000];
   int datalen;
-  char inbuf[2000];
-  int inlen;
-  int insent;
-  struct eth_packet_s *ethpack;
+  struct eth_packet_s ring[ETH_RING_SIZE];
+  unsigned int ring_head;   /* next entry event_handler() fills */
+  unsigned int ring_tail;   /* entry being sent to the MAC */
+  size_t insent;
+  int rx_active;            /* byte mode: ring_tail is being sent */
+  unsigned long dropped;
   struct event *ev;
 };
 
@@ -108,21 +119,27 @@ void event_handler(int fd, short event, void *arg)
 {
   struct  session_s *s = (struct session_s*)arg;
   struct eth_packet_s *ep;
-  struct eth_packet_s *tep;
+  char scratch[2000];
+  int len;
 
   if (event & EV_READ) {
-    ep = malloc(sizeof(struct eth_packet_s));
-    memset(ep, 0, sizeof(struct eth_packet_s));
-    ep->len = tapcfg_read(s->tapcfg, ep->data, 2000);
-    if(ep->len < 60)
-      ep->len = 60;
-
-    if(!s->ethpack)
-      s->ethpack = ep;
-    else {
-      for(tep=s->ethpack; tep->next; tep=tep->next);
-      tep->next = ep;
+    if(s->ring_head - s->ring_tail == ETH_RING_SIZE) {
+      tapcfg_read(s->tapcfg, scratch, sizeof(scratch));
+      if(!s->dropped++)
+        eprintf("[ethernet] RX ring full, dropping frames\n");
+      return;
+    }
+    ep = &s->ring[s->ring_head % ETH_RING_SIZE];
+    len = tapcfg_read(s->tapcfg, ep->data, sizeof(ep->data));
+    if(len <= 0)
+      return;
+    /* Runt frames are zero padded to the Ethernet minimum */
+    if(len < 60) {
+      memset(ep->data + len, 0, 60 - len);
+      len = 60;
     }
+    ep->len = len;
+    s->ring_head++;
   }
 }
 
@@ -146,6 +163,7 @@ static int ethernet_new(void **sess, char *args)
     goto out;
   }
   memset(s, 0, sizeof(struct session_s));
+  s->dw = 1;
 
   ret = litex_sim_module_get_args(args, "interface", &c_tap);
   {
@@ -185,13 +203,21 @@ static int ethernet_add_pads(void *sess, struct pad_list_s *plist)
     goto out;
   }
   pads = plist->pads;
-  if(!strcmp(plist->name, "eth")) {
+  if(!strcmp(plist->name, "eth") || !strcmp(plist->name, "eth32") || !strcmp(plist->name, "eth64")) {
+    if(!strcmp(plist->name, "eth32"))
+      s->dw = 4;
+    else if(!strcmp(plist->name, "eth64"))
+      s->dw = 8;
     litex_sim_module_pads_get(pads, "sink_data", (void**)&s->rx);
     litex_sim_module_pads_get(pads, "sink_valid", (void**)&s->rx_valid);
     litex_sim_module_pads_get(pads, "sink_ready", (void**)&s->rx_ready);
+    litex_sim_module_pads_get(pads, "sink_last", (void**)&s->rx_last);
+    litex_sim_module_pads_get(pads, "sink_last_be", (void**)&s->rx_last_be);
     litex_sim_module_pads_get(pads, "source_data", (void**)&s->tx);
     litex_sim_module_pads_get(pads, "source_valid", (void**)&s->tx_valid);
     litex_sim_module_pads_get(pads, "source_ready", (void**)&s->tx_ready);
+    litex_sim_module_pads_get(pads, "source_last", (void**)&s->tx_last);
+    litex_sim_module_pads_get(pads, "source_last_be", (void**)&s->tx_last_be);
   }
   if(!strcmp(plist->name, "sys_clk"))
     litex_sim_module_pads_get(pads, "sys_clk", (void**)&s->sys_clk);
@@ -200,21 +226,84 @@ out:
   return ret;
 }
 
+/* Wide data pads are Verilator IData/QData, byte 0 in the low bits */
+static uint64_t eth_word_read(const struct session_s *s, const void *sig)
+{
+  if(s->dw == 8)
+    return *(const uint64_t *)sig;
+  return *(const uint32_t *)sig;
+}
+
+static void eth_word_write(const struct session_s *s, void *sig, uint64_t v)
+{
+  if(s->dw == 8)
+    *(uint64_t *)sig = v;
+  else
+    *(uint32_t *)sig = (uint32_t)v;
+}
+
+/* One MAC word per clock: frames end on last, last_be marks the final byte */
+static void ethernet_tick_wide(struct session_s *s)
+{
+  struct eth_packet_s *ep;
+  uint64_t word;
+  int i, n;
+
+  *s->tx_ready = 1;
+  if(*s->tx_valid) {
+    word = eth_word_read(s, s->tx);
+    n = s->dw;
+    if(*s->tx_last && *s->tx_last_be)
+      for(n = 1; !((*s->tx_last_be >> (n - 1)) & 1); n++);
+    for(i = 0; i < n && s->datalen < sizeof(s->databuf); i++)
+      s->databuf[s->datalen++] = (char)(word >> (8 * i));
+    if(*s->tx_last) {
+      tapcfg_write(s->tapcfg, s->databuf, s->datalen);
+      s->datalen = 0;
+    }
+  }
+
+  *s->rx_valid = 0;
+  *s->rx_last = 0;
+  *s->rx_last_be = 0;
+  if(s->ring_tail == s->ring_head)
+    return;
+  ep = &s->ring[s->ring_tail % ETH_RING_SIZE];
+  n = ep->len - s->insent;
+  if(n > s->dw)
+    n = s->dw;
+  word = 0;
+  for(i = 0; i < n; i++)
+    word |= (uint64_t)(uint8_t)ep->data[s->insent + i] << (8 * i);
+  eth_word_write(s, s->rx, word);
+  *s->rx_valid = 1;
+  s->insent += n;
+  if(s->insent == ep->len) {
+    *s->rx_last = 1;
+    *s->rx_last_be = 1 << (n - 1);
+    s->insent = 0;
+    s->ring_tail++;
+  }
+}
+
 static int ethernet_tick(void *sess, uint64_t time_ps)
 {
   static clk_edge_state_t edge;
-  char c;
   struct session_s *s = (struct session_s*)sess;
-  struct eth_packet_s *pep;
+  struct eth_packet_s *ep;
 
   if(!clk_pos_edge(&edge, *s->sys_clk)) {
     return RC_OK;
   }
 
+  if(s->dw > 1) {
+    ethernet_tick_wide(s);
+    return RC_OK;
+  }
+
   *s->tx_ready = 1;
   if(*s->tx_valid == 1) {
-    c = *s->tx;
-    s->databuf[s->datalen++]=c;
+    s->databuf[s->datalen++] = *(char *)s->tx;
   } else {
     if(s->datalen) {
       tapcfg_write(s->tapcfg, s->databuf, s->datalen);
@@ -222,22 +311,20 @@ static int ethernet_tick(void *sess, uint64_t time_ps)
     }
   }
 
+  /* A frame goes out on consecutive clocks, the idle clock between two
+     frames (rx_valid low) marks the end of the first to LiteEthPHYModel */
   *s->rx_valid=0;
-  if(s->inlen) {
+  if(s->rx_active) {
+    ep = &s->ring[s->ring_tail % ETH_RING_SIZE];
     *s->rx_valid=1;
-    *s->rx = s->inbuf[s->insent++];
-    if(s->insent == s->inlen) {
-      s->insent =0;
-      s->inlen = 0;
-    }
-  } else {
-    if(s->ethpack) {
-      memcpy(s->inbuf, s->ethpack->data, s->ethpack->len);
-      s->inlen = s->ethpack->len;
-      pep=s->ethpack->next;
-      free(s->ethpack);
-      s->ethpack=pep;
+    *(char *)s->rx = ep->data[s->insent++];
+    if(s->insent == ep->len) {
+      s->insent = 0;
+      s->rx_active = 0;
+      s->ring_tail++;
     }
+  } else if(s->ring_tail != s->ring_head) {
+    s->rx_active = 1;
   }
   return RC_OK;
 }
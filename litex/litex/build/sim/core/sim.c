@@ -167,18 +167,27 @@ int litex_sim_sort_session()
   return RC_OK;
 }
 
-struct event *ev;
+/* Ticks run between two rounds of trace flushing and polling the module
+   fds, as many as the libevent timer callback used to run */
+#ifndef SIM_BATCH
+#define SIM_BATCH 1000
+#endif
 
-static void cb(int sock, short which, void *arg)
+/* Lets the modules read their sockets, tap and console, returns 1 once the
+   event loop was told to exit */
+static int litex_sim_poll(void)
+{
+  event_base_loop(base, EVLOOP_NONBLOCK);
+  return event_base_got_exit(base) || event_base_got_break(base);
+}
+
+/* Returns 1 once the simulation has finished */
+static int litex_sim_run(void *vsim, int ticks)
 {
   struct session_list_s *s;
-  void *vsim=arg;
-  struct timeval tv;
-  tv.tv_sec = 0;
-  tv.tv_usec = 0;
   int i;
 
-  for(i = 0; i < 1000; i++)
+  for(i = 0; i < ticks; i++)
   {
     for(s = sesslist; s; s=s->next)
     {
@@ -197,22 +206,26 @@ static void cb(int sock, short which, void *arg)
 
     sim_time_ps += timebase_ps;
 
-    if (litex_sim_got_finish()) {
-        event_base_loopbreak(base);
-        break;
-    }
+    if (litex_sim_got_finish())
+      return 1;
   }
+  return 0;
+}
+
+static void litex_sim_loop(void *vsim)
+{
+  while(!litex_sim_run(vsim, SIM_BATCH))
+  {
+    litex_sim_tracer_flush();
 
-  if (!evtimer_pending(ev, NULL)) {
-    event_del(ev);
-    evtimer_add(ev, &tv);
+    if(litex_sim_poll())
+      break;
   }
 }
 
 int main(int argc, char *argv[])
 {
   void *vsim=NULL;
-  struct timeval tv;
 
   int ret;
 
@@ -241,11 +254,7 @@ int main(int argc, char *argv[])
     goto out;
   }
 
-  tv.tv_sec = 0;
-  tv.tv_usec = 0;
-  ev = event_new(base, -1, EV_PERSIST, cb, vsim);
-  event_add(ev, &tv);
-  event_base_dispatch(base);
+  litex_sim_loop(vsim);
 #if VM_COVERAGE
   litex_sim_coverage_dump();
 #endif
@@ -125,11 +125,16 @@ extern "C" void litex_sim_tracer_dump()
 extern "C" int litex_sim_got_finish()
 {
   int finished;
-  tfp->flush();
   if((finished = Verilated::gotFinish())) {
     tfp->close();
   }
-  return Verilated::gotFinish();
+  return finished;
+}
+
+/* Called between tick batches rather than on every tick */
+extern "C" void litex_sim_tracer_flush()
+{
+  tfp->flush();
 }
 
 #if VM_COVERAGE
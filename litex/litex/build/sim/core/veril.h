@@ -11,6 +11,7 @@ extern "C" void litex_sim_eval(void *vsim, uint64_t time_ps);
 extern "C" void litex_sim_init_tracer(void *vsim, long start, long end,long load_start, long save_start);
 extern "C" void litex_sim_tracer_dump();
 extern "C" int litex_sim_got_finish();
+extern "C" void litex_sim_tracer_flush();
 #if VM_COVERAGE
 extern "C" void litex_sim_coverage_dump();
 #endif
@@ -19,6 +20,7 @@ void litex_sim_eval(void *vsim, uint64_t time_ps);
 void litex_sim_init_tracer(void *vsim);
 void litex_sim_tracer_dump();
 int litex_sim_got_finish();
+void litex_sim_tracer_flush();
 void litex_sim_init_cmdargs(int argc, char *argv[]);
 #if VM_COVERAGE
 void litex_sim_coverage_dump();
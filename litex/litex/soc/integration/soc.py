@@ -1896,6 +1896,7 @@ class LiteXSoC(SoC):
         ntxslots                = 2, txslots_write_only = False,
         full_memory_we          = False,
         with_timestamp          = False,
+        with_preamble_crc       = None,
         with_timing_constraints = True,
         local_ip                = None,
         remote_ip               = None,
@@ -1910,6 +1911,8 @@ class LiteXSoC(SoC):
         self.check_if_exists(name)
         if with_timestamp:
             self.timer0.add_uptime()
+        if with_preamble_crc is None:
+            with_preamble_crc = not software_debug
         ethmac = LiteEthMAC(
             phy               = phy,
             dw                = {8: 32, 32: 32, 64: 64}[data_width],
@@ -1919,7 +1922,7 @@ class LiteXSoC(SoC):
             ntxslots          = ntxslots, txslots_write_only = txslots_write_only,
             timestamp         = None if not with_timestamp else self.timer0.uptime_cycles,
             full_memory_we    = full_memory_we,
-            with_preamble_crc = not software_debug,
+            with_preamble_crc = with_preamble_crc,
             with_sys_datapath = with_sys_datapath)
         if not with_sys_datapath:
             # Use PHY's eth_tx/eth_rx clock domains.
@@ -1979,6 +1982,10 @@ class LiteXSoC(SoC):
             add_mac_address_constants(self, "MACADDR", mac_address)
         
 
+        # Software Preamble/CRC: firmware computes the FCS of every frame, use the faster CRC32.
+        if not with_preamble_crc:
+            self.add_constant("CRC32_SLICE_BY_8")
+
         # Software Debug
         if software_debug:
             self.add_constant("ETH_UDP_TX_DEBUG")
@@ -149,6 +149,33 @@ static ethernet_buffer *rxbuffer;
 static uint32_t txslot;
 static uint32_t txlen;
 static ethernet_buffer *txbuffer;
+static int tx_reserved;
+
+/* TX ring: frames are handed to the reader in slot order, the tx_inflight
+   slots just before txslot are still queued or being sent. The reader pops
+   its command FIFO once a frame is out, so its level tells how many remain. */
+static uint32_t tx_inflight;
+static udp_tx_callback tx_callback;
+
+/* Retire the frames the reader is done with, returns the number of free slots */
+static uint32_t tx_reap(void)
+{
+	uint32_t level = ethmac_sram_reader_level_read();
+
+	if(level < tx_inflight) {
+		uint32_t done = tx_inflight - level;
+		tx_inflight = level;
+		if(tx_callback)
+			tx_callback(done);
+	}
+	return ETHMAC_TX_SLOTS - tx_inflight;
+}
+
+/* Wait until the slot at txslot may be written */
+static void tx_wait_slot(void)
+{
+	while(tx_reap() == 0);
+}
 
 static void send_packet(void)
 {
@@ -179,6 +206,8 @@ static void send_packet(void)
 	ethmac_sram_reader_length_write(txlen);
 	ethmac_sram_reader_start_write(1);
 
+	tx_inflight++;
+
 	/* update txslot / txbuffer */
 	txslot = (txslot+1)%ETHMAC_TX_SLOTS;
 	txbuffer = (ethernet_buffer *)(ETHMAC_BASE + ETHMAC_SLOT_SIZE * (ETHMAC_RX_SLOTS + txslot));
@@ -238,6 +267,9 @@ static void process_arp(void)
 		return;
 	}
 	if(ntohs(rx_arp->opcode) == ARP_OPCODE_REQUEST) {
+		/* TX slot is being filled by the application or all slots are
+		   in flight, peer will ask again */
+		if(tx_reserved || !tx_reap()) return;
 		if(ntohl(rx_arp->target_ip) == my_ip) {
 			int i;
 
@@ -284,6 +316,7 @@ int udp_arp_resolve(uint32_t ip)
 
 	for(tries=0;tries<8;tries++) {
 		/* Send an ARP request */
+		tx_wait_slot();
 		fill_eth_header(&txbuffer->frame.eth_header,
 				broadcast,
 				my_mac,
@@ -342,9 +375,56 @@ static uint16_t ip_checksum(uint32_t r, void *buffer, uint32_t length, int compl
 
 void *udp_get_tx_buffer(void)
 {
+	tx_wait_slot();
+	return txbuffer->frame.contents.udp.payload;
+}
+
+/* Non-blocking udp_get_tx_buffer(): NULL while all TX slots are in flight */
+void *udp_try_tx_buffer(void)
+{
+	if(!tx_reap())
+		return NULL;
+	return txbuffer->frame.contents.udp.payload;
+}
+
+/* Like udp_try_tx_buffer(), but the slot is kept for the next udp_send(): ARP/ICMP
+   replies from udp_service() are dropped meanwhile so the payload can be built in place. */
+void *udp_reserve_tx_buffer(void)
+{
+	if(!tx_reap())
+		return NULL;
+	tx_reserved = 1;
 	return txbuffer->frame.contents.udp.payload;
 }
 
+/* Drop a reservation whose payload will not be sent. A no-op once udp_send()
+   has used it, or when buf is not the reserved slot. */
+void udp_unreserve_tx_buffer(const void *buf)
+{
+	if(tx_reserved && buf == txbuffer->frame.contents.udp.payload)
+		tx_reserved = 0;
+}
+
+/* Frames handed to the MAC and not sent yet */
+uint32_t udp_tx_pending(void)
+{
+	tx_reap();
+	return tx_inflight;
+}
+
+/* cb is called with the number of frames sent, from udp_service() when the
+   sram_reader event is enabled or from any call that looks for a free slot */
+void udp_set_tx_callback(udp_tx_callback callback)
+{
+	tx_callback = callback;
+}
+
+/* Payload room in a TX slot, keeping space for the CRC and the odd-length pad byte */
+uint32_t udp_get_tx_buffer_size(void)
+{
+	return ETHMAC_SLOT_SIZE - sizeof(struct ethernet_header) - sizeof(struct udp_frame) - 4 - 1;
+}
+
 struct pseudo_header {
 	uint32_t src_ip;
 	uint32_t dst_ip;
@@ -359,8 +439,10 @@ int udp_send(uint16_t src_port, uint16_t dst_port, uint32_t length)
 	uint32_t r;
 
 	if((cached_mac[0] == 0) && (cached_mac[1] == 0) && (cached_mac[2] == 0)
-		&& (cached_mac[3] == 0) && (cached_mac[4] == 0) && (cached_mac[5] == 0))
+		&& (cached_mac[3] == 0) && (cached_mac[4] == 0) && (cached_mac[5] == 0)) {
+		tx_reserved = 0;
 		return 0;
+	}
 
 	txlen = length + sizeof(struct ethernet_header) + sizeof(struct udp_frame);
 	if(txlen < ARP_PACKET_LENGTH) txlen = ARP_PACKET_LENGTH;
@@ -399,6 +481,7 @@ int udp_send(uint16_t src_port, uint16_t dst_port, uint32_t length)
 	txbuffer->frame.contents.udp.udp.checksum = htons(r);
 
 	send_packet();
+	tx_reserved = 0;
 
 	return 1;
 }
@@ -412,6 +495,7 @@ int send_ping(uint32_t ip, unsigned short payload_length)
 		printf("ARP failed");
 		return -1;
 	}
+	tx_wait_slot();
 
 	fill_eth_header(
 		&txbuffer->frame.eth_header,
@@ -485,6 +569,7 @@ static void process_icmp(void)
 	unsigned short length = ntohs(rx_icmp->ip.total_length) - sizeof(struct icmp_frame);
 
 	if(rx_icmp->icmp.type == ICMP_ECHO) {
+		if(tx_reserved || !tx_reap()) return;
 		fill_eth_header(
 			&txbuffer->frame.eth_header,
 			rxbuffer->frame.eth_header.srcmac,
@@ -557,6 +642,8 @@ static void process_icmp(void)
 }
 
 static udp_callback rx_callback;
+static udp_zc_callback zc_callback;
+static int rx_held;
 #ifdef ETH_UDP_BROADCAST
 static udp_callback bx_callback;
 #endif /* ETH_UDP_BROADCAST */
@@ -584,7 +671,11 @@ static void process_udp(void)
 		return;
 	}
 
-	if(rx_callback) {
+	if(zc_callback) {
+		/* Frame stays in its slot (writer event not acknowledged) until udp_rx_release() */
+		rx_held = zc_callback(ntohl(udp_ip->ip.src_ip), ntohs(udp_ip->udp.src_port), ntohs(udp_ip->udp.dst_port),
+				rxslot, udp_ip->payload, ntohs(udp_ip->udp.length)-sizeof(struct udp_header));
+	} else if(rx_callback) {
 		rx_callback(ntohl(udp_ip->ip.src_ip), ntohs(udp_ip->udp.src_port), ntohs(udp_ip->udp.dst_port),
 				udp_ip->payload, ntohs(udp_ip->udp.length)-sizeof(struct udp_header));
 #ifdef ETH_UDP_BROADCAST
@@ -600,6 +691,41 @@ void udp_set_callback(udp_callback callback)
 	rx_callback = callback;
 }
 
+void udp_set_zc_callback(udp_zc_callback callback)
+{
+	zc_callback = callback;
+}
+
+int udp_rx_held(void)
+{
+	return rx_held;
+}
+
+void udp_rx_release(void)
+{
+	if(!rx_held)
+		return;
+	rx_held = 0;
+	ethmac_sram_writer_ev_pending_write(ETHMAC_EV_SRAM_WRITER);
+}
+
+/* Un-hold the frame without acknowledging it, the next udp_service() hands
+   it to the callback again. For callbacks that hold a frame as backpressure. */
+void udp_rx_retry(void)
+{
+	rx_held = 0;
+}
+
+/* Frames the MAC dropped because every RX slot was full */
+uint32_t udp_rx_dropped(void)
+{
+#ifdef CSR_ETHMAC_SRAM_WRITER_ERRORS_ADDR
+	return ethmac_sram_writer_errors_read();
+#else
+	return 0;
+#endif
+}
+
 #ifdef ETH_UDP_BROADCAST
 void udp_set_broadcast_callback(udp_callback callback)
 {
@@ -667,12 +793,17 @@ void udp_start(const uint8_t *macaddr, uint32_t ip)
 		cached_mac[i] = 0;
 
 	txslot = 0;
+	tx_reserved = 0;
+	tx_inflight = 0;
+	tx_callback = (udp_tx_callback)0;
 	ethmac_sram_reader_slot_write(txslot);
 	txbuffer = (ethernet_buffer *)(ETHMAC_BASE + ETHMAC_SLOT_SIZE * (ETHMAC_RX_SLOTS + txslot));
 
 	rxslot = 0;
 	rxbuffer = (ethernet_buffer *)(ETHMAC_BASE + ETHMAC_SLOT_SIZE * rxslot);
 	rx_callback = (udp_callback)0;
+	zc_callback = (udp_zc_callback)0;
+	rx_held = 0;
 #ifdef ETH_UDP_BROADCAST
 	bx_callback = (udp_callback)0;
 #endif /* ETH_UDP_BROADCAST */
@@ -680,13 +811,41 @@ void udp_start(const uint8_t *macaddr, uint32_t ip)
 
 void udp_service(void)
 {
+	if(ethmac_sram_reader_ev_pending_read() & ETHMAC_EV_SRAM_READER) {
+		ethmac_sram_reader_ev_pending_write(ETHMAC_EV_SRAM_READER);
+		tx_reap();
+	}
+	/* A held frame is the head of the writer FIFO, nothing behind it is visible yet */
+	if(rx_held)
+		return;
 	if(ethmac_sram_writer_ev_pending_read() & ETHMAC_EV_SRAM_WRITER) {
 		rxslot = ethmac_sram_writer_slot_read();
 		rxbuffer = (ethernet_buffer *)(ETHMAC_BASE + ETHMAC_SLOT_SIZE * rxslot);
 		rxlen = ethmac_sram_writer_length_read();
 		process_frame();
-		ethmac_sram_writer_ev_pending_write(ETHMAC_EV_SRAM_WRITER);
+		if(!rx_held)
+			ethmac_sram_writer_ev_pending_write(ETHMAC_EV_SRAM_WRITER);
+	}
+}
+
+/* udp_service() until no received frame is pending or one is held, returns the
+   number of RX frames acknowledged. A held frame is not counted here, it is
+   handed out again by udp_rx_retry() or acknowledged by udp_rx_release(). */
+int udp_drain(void)
+{
+	int n = 0;
+	int serviced = 0;
+
+	while(!rx_held && (ethmac_sram_writer_ev_pending_read() & ETHMAC_EV_SRAM_WRITER)) {
+		udp_service();
+		serviced = 1;
+		if(!rx_held)
+			n++;
 	}
+	/* TX completions only, nothing received */
+	if(!serviced)
+		udp_service();
+	return n;
 }
 
 void eth_init(void)
@@ -702,6 +861,19 @@ void eth_init(void)
 #endif
 }
 
+/* Non-zero when the MAC adds and checks the preamble and FCS itself, zero when
+   send_packet/process_frame compute the CRC in software. */
+int eth_hw_crc(void)
+{
+#if defined(CSR_ETHMAC_PREAMBLE_CRC_ADDR)
+	return ethmac_preamble_crc_read();
+#elif defined(HW_PREAMBLE_CRC)
+	return 1;
+#else
+	return 0;
+#endif
+}
+
 #ifdef CSR_ETHPHY_MODE_DETECTION_MODE_ADDR
 void eth_mode(void)
 {
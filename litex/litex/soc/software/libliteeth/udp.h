@@ -15,6 +15,10 @@ extern "C" {
 #define UDP_BUFSIZE (5*1532)
 
 typedef void (*udp_callback)(uint32_t src_ip, uint16_t src_port, uint16_t dst_port, void *data, uint32_t length);
+/* Zero-copy RX: return non-zero to keep the frame in its ethmac RX slot until udp_rx_release(). */
+typedef int (*udp_zc_callback)(uint32_t src_ip, uint16_t src_port, uint16_t dst_port, uint32_t slot, void *data, uint32_t length);
+/* TX completion: frames is the number of queued frames the MAC has sent since the last call. */
+typedef void (*udp_tx_callback)(uint32_t frames);
 
 void udp_set_ip(uint32_t ip);
 uint32_t udp_get_ip(void);
@@ -22,17 +26,30 @@ void udp_set_mac(const uint8_t *macaddr);
 void udp_start(const uint8_t *macaddr, uint32_t ip);
 int udp_arp_resolve(uint32_t ip);
 void *udp_get_tx_buffer(void);
+void *udp_try_tx_buffer(void);
+void *udp_reserve_tx_buffer(void);
+void udp_unreserve_tx_buffer(const void *buf);
+uint32_t udp_get_tx_buffer_size(void);
+uint32_t udp_tx_pending(void);
+void udp_set_tx_callback(udp_tx_callback callback);
 int udp_send(uint16_t src_port, uint16_t dst_port, uint32_t length);
 void udp_set_callback(udp_callback callback);
+void udp_set_zc_callback(udp_zc_callback callback);
+int udp_rx_held(void);
+void udp_rx_release(void);
+void udp_rx_retry(void);
+uint32_t udp_rx_dropped(void);
 #ifdef ETH_UDP_BROADCAST
 void udp_set_broadcast_callback(udp_callback callback);
 void udp_set_broadcast(void);
 #endif /* ETH_UDP_BROADCAST */
 void udp_service(void);
+int udp_drain(void);
 
 int send_ping(uint32_t ip, unsigned short payload_length);
 
 void eth_init(void);
+int eth_hw_crc(void);
 void eth_mode(void);
 
 #ifdef __cplusplus
@@ -31,7 +31,7 @@ from litex.soc.cores.video   import VideoGenericPHY
 from liteeth.common             import *
 from liteeth.phy.gmii           import LiteEthPHYGMII
 from liteeth.phy.xgmii          import LiteEthPHYXGMII
-from liteeth.phy.model          import LiteEthPHYModel
+from liteeth.phy.model          import LiteEthPHYModel, LiteEthPHYModelCRG
 from liteeth.mac                import LiteEthMAC
 from liteeth.core.arp           import LiteEthARP
 from liteeth.core.ip            import LiteEthIP
@@ -73,6 +73,32 @@ _io = [
         Subsignal("sink_data",    Pins(8)),
     ),
 
+    # Ethernet (Wide Stream Endpoint, 32/64-bit per clock).
+    ("eth32", 0,
+        Subsignal("source_valid",   Pins(1)),
+        Subsignal("source_ready",   Pins(1)),
+        Subsignal("source_data",    Pins(32)),
+        Subsignal("source_last",    Pins(1)),
+        Subsignal("source_last_be", Pins(4)),
+
+        Subsignal("sink_valid",     Pins(1)),
+        Subsignal("sink_data",      Pins(32)),
+        Subsignal("sink_last",      Pins(1)),
+        Subsignal("sink_last_be",   Pins(4)),
+    ),
+    ("eth64", 0,
+        Subsignal("source_valid",   Pins(1)),
+        Subsignal("source_ready",   Pins(1)),
+        Subsignal("source_data",    Pins(64)),
+        Subsignal("source_last",    Pins(1)),
+        Subsignal("source_last_be", Pins(8)),
+
+        Subsignal("sink_valid",     Pins(1)),
+        Subsignal("sink_data",      Pins(64)),
+        Subsignal("sink_last",      Pins(1)),
+        Subsignal("sink_last_be",   Pins(8)),
+    ),
+
     # Ethernet (XGMII).
     ("xgmii_eth", 0,
         Subsignal("rx_data",      Pins(64)),
@@ -148,6 +174,36 @@ class Platform(SimPlatform):
     def __init__(self):
         SimPlatform.__init__(self, "SIM", _io)
 
+# Wide Ethernet PHY Model -------------------------------------------------------------------------
+
+class SimEthPHYWide(LiteEthPHYModel):
+    """LiteEthPHYModel moving a whole 32/64-bit word per clock instead of a byte.
+
+    Subclassed so the MAC still leaves preamble and CRC out, frames go to the tap as-is.
+    """
+    def __init__(self, pads):
+        self.dw     = len(pads.sink_data)
+        self.crg    = LiteEthPHYModelCRG()
+        self.sink   = sink   = stream.Endpoint(eth_phy_description(self.dw))
+        self.source = source = stream.Endpoint(eth_phy_description(self.dw))
+
+        # TX: MAC -> tap.
+        self.comb += [
+            pads.source_valid.eq(sink.valid),
+            pads.source_data.eq(sink.data),
+            pads.source_last.eq(sink.last),
+            pads.source_last_be.eq(sink.last_be),
+            sink.ready.eq(pads.source_ready),
+        ]
+
+        # RX: tap -> MAC.
+        self.sync += [
+            source.valid.eq(pads.sink_valid),
+            source.data.eq(pads.sink_data),
+            source.last.eq(pads.sink_last),
+            source.last_be.eq(pads.sink_last_be),
+        ]
+
 # Simulation SoC -----------------------------------------------------------------------------------
 
 class SimSoC(SoCCore):
@@ -158,6 +214,8 @@ class SimSoC(SoCCore):
         ethernet_phy_model     = "sim",
         ethernet_local_ip      = "192.168.1.50",
         ethernet_remote_ip     = "192.168.1.100",
+        ethernet_rx_slots      = 2,
+        ethernet_tx_slots      = 2,
         with_etherbone         = False,
         with_analyzer          = False,
         sdram_module           = "MT48LC16M16",
@@ -240,6 +298,9 @@ class SimSoC(SoCCore):
             if ethernet_phy_model == "sim":
                 self.ethphy = LiteEthPHYModel(self.platform.request("eth", 0))
                 self.add_constant("HW_PREAMBLE_CRC");
+            elif ethernet_phy_model in ["sim32", "sim64"]:
+                self.ethphy = SimEthPHYWide(self.platform.request("eth" + ethernet_phy_model[3:], 0))
+                self.add_constant("HW_PREAMBLE_CRC");
             elif ethernet_phy_model == "xgmii":
                 self.ethphy = LiteEthPHYXGMII(None, self.platform.request("xgmii_eth", 0), model=True)
             elif ethernet_phy_model == "gmii":
@@ -267,9 +328,13 @@ class SimSoC(SoCCore):
             # Ethernet MAC
             self.ethmac = ethmac = LiteEthMAC(
                 phy        = self.ethphy,
-                dw         = 64 if ethernet_phy_model == "xgmii" else 32,
+                dw         = 64 if ethernet_phy_model in ["xgmii", "sim64"] else 32,
                 interface  = "wishbone",
-                endianness = self.cpu.endianness
+                endianness = self.cpu.endianness,
+                nrxslots   = ethernet_rx_slots,
+                ntxslots   = ethernet_tx_slots,
+                # RX slots writable so firmware can decrypt received datagrams in place (zero-copy RX).
+                rxslots_read_only = False,
             )
             ethmac_rx_region_size = ethmac.rx_slots.constant*ethmac.slot_size.constant
             ethmac_tx_region_size = ethmac.tx_slots.constant*ethmac.slot_size.constant
@@ -437,10 +502,12 @@ def sim_args(parser):
 
     # Ethernet /Etherbone.
     parser.add_argument("--with-ethernet",        action="store_true",     help="Enable Ethernet support.")
-    parser.add_argument("--ethernet-phy-model",   default="sim",           help="Ethernet PHY to simulate (sim, xgmii or gmii).")
+    parser.add_argument("--ethernet-phy-model",   default="sim",           help="Ethernet PHY to simulate (sim, sim32, sim64, xgmii or gmii).")
     parser.add_argument("--with-etherbone",       action="store_true",     help="Enable Etherbone support.")
     parser.add_argument("--local-ip",             default="192.168.1.50",  help="Local IP address of SoC.")
     parser.add_argument("--remote-ip",            default="192.168.1.100", help="Remote IP address of TFTP server.")
+    parser.add_argument("--ethernet-rx-slots",    default=2,               help="Number of Ethernet MAC RX slots.")
+    parser.add_argument("--ethernet-tx-slots",    default=2,               help="Number of Ethernet MAC TX slots.")
 
     # SDCard.
     parser.add_argument("--with-sdcard",          action="store_true",     help="Enable SDCard support.")
@@ -534,6 +601,8 @@ def main():
     if args.with_ethernet or args.with_etherbone:
         if args.ethernet_phy_model == "sim":
             sim_config.add_module("ethernet", "eth", args={"interface": "tap0", "ip": args.remote_ip})
+        elif args.ethernet_phy_model in ["sim32", "sim64"]:
+            sim_config.add_module("ethernet", "eth" + args.ethernet_phy_model[3:], args={"interface": "tap0", "ip": args.remote_ip})
         elif args.ethernet_phy_model == "xgmii":
             sim_config.add_module("xgmii_ethernet", "xgmii_eth", args={"interface": "tap0", "ip": args.remote_ip})
         elif args.ethernet_phy_model == "gmii":
@@ -562,6 +631,8 @@ def main():
         ethernet_phy_model     = args.ethernet_phy_model,
         ethernet_local_ip      = args.local_ip,
         ethernet_remote_ip     = args.remote_ip,
+        ethernet_rx_slots      = int(args.ethernet_rx_slots),
+        ethernet_tx_slots      = int(args.ethernet_tx_slots),
         with_etherbone         = args.with_etherbone,
         with_analyzer          = args.with_analyzer,
         with_i2c               = args.with_i2c,
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Compare the results of two benchmark runs (bench/bench.c output).
+
+    ./bench-compare.py base.log new.log [--threshold 5]
+
+Each argument is a UART log or the output of bench-host. Prints per_op for
+both runs and the change in percent, marks changes beyond the threshold and
+exits with 1 if any benchmark got slower by more than that, so it can gate
+a build. --json prints the parsed results of a single log instead.
+"""
+
+import argparse
+import json
+import sys
+
+BEGIN_MARK = "=== BENCH JSON ==="
+END_MARK = "=== BENCH END ==="
+
+
+def read_results(path):
+    header, results, inside = {}, {}, False
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.strip()
+            if line == BEGIN_MARK:
+                header, results, inside = {}, {}, True
+            elif line == END_MARK:
+                inside = False
+            elif inside and line.startswith("{"):
+                obj = json.loads(line)
+                if "name" in obj:
+                    results[obj["name"]] = obj
+                else:
+                    header = obj
+    if not header:
+        sys.exit("%s: no benchmark output found" % path)
+    return header, results
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("base")
+    ap.add_argument("new", nargs="?")
+    ap.add_argument("--threshold", type=float, default=5.0,
+                    help="percent change to flag (default 5)")
+    ap.add_argument("--json", action="store_true",
+                    help="print the results of base as one JSON object")
+    args = ap.parse_args()
+
+    base_hdr, base = read_results(args.base)
+    if args.json or args.new is None:
+        json.dump({"header": base_hdr, "results": base}, sys.stdout, indent=1)
+        print()
+        return 0
+
+    new_hdr, new = read_results(args.new)
+    if base_hdr.get("unit") != new_hdr.get("unit"):
+        print("warning: comparing %s with %s" % (base_hdr.get("unit"),
+                                                 new_hdr.get("unit")))
+    print("base: %s %s" % (base_hdr.get("target"), base_hdr.get("flags")))
+    print("new:  %s %s" % (new_hdr.get("target"), new_hdr.get("flags")))
+    print("%-28s %12s %12s %8s" % ("benchmark", "base", "new", "change"))
+
+    slower = 0
+    for name in list(base) + [n for n in new if n not in base]:
+        a, b = base.get(name), new.get(name)
+        if a is None or b is None or "per_op" not in a or "per_op" not in b:
+            print("%-28s %12s %12s" % (name,
+                                       a.get("per_op", "error") if a else "-",
+                                       b.get("per_op", "error") if b else "-"))
+            continue
+        change = 100.0 * (b["per_op"] - a["per_op"]) / max(a["per_op"], 1)
+        mark = ""
+        if change > args.threshold:
+            mark, slower = " slower", slower + 1
+        elif change < -args.threshold:
+            mark = " faster"
+        print("%-28s %12d %12d %+7.1f%%%s" % (name, a["per_op"], b["per_op"],
+                                              change, mark))
+    return 1 if slower else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,29 @@
+#!/bin/bash
+# ./scripts/bench.sh [log]: run bench/bench.bin in the simulator, save the
+# UART output to log (default bench.log) and stop at the end of the results.
+# Compare two logs with ./scripts/bench-compare.py old.log new.log
+
+LOGFILE=${1:-bench.log}
+END_WORD="=== BENCH END ==="
+
+echo "Running benchmark..."
+
+. ./litex-env/bin/activate
+
+# litex_sim requires tty so using script
+script -q -c "
+    litex_sim --csr-json csr.json \
+              --cpu-type=vexriscv \
+              --cpu-variant=full \
+              --integrated-main-ram-size=0x06400000 \
+              --ram-init=bench/bench.bin \
+              --sys-clk-freq 100000000
+" /dev/null | tee "$LOGFILE" | while read -r line; do
+    echo "$line"
+    case "$line" in
+        *"$END_WORD"*)
+            pkill -x litex_sim
+            exit 0
+            ;;
+    esac
+done
@@ -7,5 +7,5 @@ git clone https://github.com/wolfSSL/wolfssl
 cd wolfssl/
 git checkout v5.8.4-stable
 ./autogen.sh
-./configure --enable-dtls --enable-dtls13 --enable-kyber --enable-ipv6=no --enable-dtls-frag-ch --enable-dilithium
+./configure --enable-dtls --enable-dtls13 --enable-kyber --enable-ipv6=no --enable-dtls-frag-ch --enable-dilithium --enable-session-ticket --enable-dtlscid
 make
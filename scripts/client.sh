@@ -4,4 +4,4 @@ echo "Running server..."
 
 . ./litex-env/bin/activate
 
-litex_sim --csr-json csr.json --cpu-type=vexriscv --cpu-variant=full --integrated-main-ram-size=0x06400000 --ram-init=boot.bin --with-ethernet --sys-clk-freq 100000000
+litex_sim --csr-json csr.json --cpu-type=vexriscv --cpu-variant=full --integrated-main-ram-size=0x06400000 --ram-init=boot.bin --with-ethernet --ethernet-rx-slots 16 --ethernet-tx-slots 4 --sys-clk-freq 100000000
@@ -17,6 +17,8 @@ script -q -c "
               --cpu-variant=full \
               --integrated-main-ram-size=0x06400000 \
               --with-ethernet \
+              --ethernet-rx-slots 16 \
+              --ethernet-tx-slots 4 \
               --sys-clk-freq 100000000
 " $LOGFILE &
 SCRIPT_PID=$!
@@ -1,6 +1,16 @@
 #!/bin/bash
 
+# ./scripts/server.sh [n]: n servers on ports 4444..4444+n-1 (make SESSIONS=n)
+# RESUME=1 ./scripts/server.sh: keep serving for the reconnect (make RESUME=1)
+# DTLS_CID=1 ./scripts/server.sh: offer a connection ID (make DTLS_CID=1)
+COUNT=${1:-1}
+LOOP=${RESUME:+-i}
+CID=${DTLS_CID:+--dtlsCID}
+
 echo "Running server..."
 
 cd wolfssl
-./examples/server/server -u -v 4 -p 4444 --pqc ML_KEM_512 -b -k ../boot/certs/server.key.pem -c ../boot/certs/server.pem -d
+for ((i = 1; i < COUNT; i++)); do
+    ./examples/server/server -u -v 4 -p $((4444 + i)) --pqc ML_KEM_512 -b -k ../boot/certs/server.key.pem -c ../boot/certs/server.pem -d $LOOP $CID &
+done
+./examples/server/server -u -v 4 -p 4444 --pqc ML_KEM_512 -b -k ../boot/certs/server.key.pem -c ../boot/certs/server.pem -d $LOOP $CID
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""Turn the span dump of a `make TRACE=1` client into a flame graph.
+
+Reads the UART log (file or stdin), takes the JSON between
+"=== TRACE JSON ===" and "=== TRACE END ===" and prints folded stacks
+("handshake;ProcessPeerCerts;DoTls13CertificateVerify 12345"), one line per
+stack with its self time in cycles. Feed them to flamegraph.pl or open them
+in speedscope:
+
+    ./trace2flame.py boot.log > hs.folded
+    flamegraph.pl --countname cycles hs.folded > hs.svg
+
+--chrome writes the Chrome trace-event format instead (chrome://tracing,
+Perfetto), --summary prints total/self time and heap growth per span name.
+"""
+
+import argparse
+import json
+import sys
+
+BEGIN_MARK = "=== TRACE JSON ==="
+END_MARK = "=== TRACE END ==="
+
+
+def read_dump(f):
+    text, inside = [], False
+    for line in f:
+        line = line.strip()
+        if line == BEGIN_MARK:
+            text, inside = [], True
+        elif line == END_MARK and inside:
+            inside = False
+        elif inside:
+            text.append(line)
+    if not text:
+        sys.exit("no trace dump found (built with make TRACE=1?)")
+    return json.loads("".join(text))  # The last dump in the log wins
+
+
+def build_tree(dump):
+    """Nests the spans by depth in start order. Returns the root nodes."""
+    names = dump["names"]
+    spans = sorted(dump["spans"], key=lambda s: (s[2], s[1]))
+    roots, stack = [], []
+    for sid, depth, start, end, heap in spans:
+        node = {"name": names[sid], "start": start, "end": end,
+                "heap": heap, "children": []}
+        # Parent is the innermost open span one level up that still covers us
+        while stack and (len(stack) > depth or stack[-1]["end"] < start):
+            stack.pop()
+        if stack:
+            stack[-1]["children"].append(node)
+        else:
+            roots.append(node)  # Parent dropped from the ring, or a root
+        stack.append(node)
+    return roots
+
+
+def self_time(node):
+    inner = sum(c["end"] - c["start"] for c in node["children"])
+    return max(node["end"] - node["start"] - inner, 0)
+
+
+def folded(roots):
+    stacks = {}
+
+    def walk(node, path):
+        path = path + [node["name"]]
+        key = ";".join(path)
+        stacks[key] = stacks.get(key, 0) + self_time(node)
+        for c in node["children"]:
+            walk(c, path)
+
+    for r in roots:
+        walk(r, [])
+    return stacks
+
+
+def chrome(dump, roots):
+    us = 1e6 / dump["hz"]
+    events = []
+
+    def walk(node):
+        events.append({"name": node["name"], "ph": "X", "pid": 0, "tid": 0,
+                       "ts": node["start"] * us,
+                       "dur": (node["end"] - node["start"]) * us,
+                       "args": {"heap_delta": node["heap"]}})
+        for c in node["children"]:
+            walk(c)
+
+    for r in roots:
+        walk(r)
+    return {"traceEvents": events, "displayTimeUnit": "ms"}
+
+
+def summary(dump, roots):
+    rows = {}
+
+    def walk(node):
+        r = rows.setdefault(node["name"], [0, 0, 0, 0])
+        r[0] += 1
+        r[1] += node["end"] - node["start"]
+        r[2] += self_time(node)
+        r[3] = max(r[3], node["heap"])
+        for c in node["children"]:
+            walk(c)
+
+    for r in roots:
+        walk(r)
+    ms = 1000.0 / dump["hz"]
+    print("%-32s %6s %12s %12s %10s" % ("span", "calls", "total ms", "self ms",
+                                        "heap max"))
+    for name, (calls, total, own, heap) in sorted(rows.items(),
+                                                  key=lambda kv: -kv[1][1]):
+        print("%-32s %6d %12.2f %12.2f %10d" % (name, calls, total * ms,
+                                               own * ms, heap))
+    if dump["dropped"]:
+        print("(%d older spans were overwritten in the ring)" % dump["dropped"])
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("log", nargs="?", help="UART log (default: stdin)")
+    ap.add_argument("--chrome", action="store_true",
+                    help="write Chrome trace-event JSON")
+    ap.add_argument("--summary", action="store_true",
+                    help="print a table per span name")
+    args = ap.parse_args()
+
+    if args.log:
+        with open(args.log, errors="replace") as f:
+            dump = read_dump(f)
+    else:
+        dump = read_dump(sys.stdin)
+    roots = build_tree(dump)
+
+    if args.summary:
+        summary(dump, roots)
+    elif args.chrome:
+        json.dump(chrome(dump, roots), sys.stdout)
+    else:
+        for stack, cycles in folded(roots).items():
+            print("%s %d" % (stack, cycles))
+
+
+if __name__ == "__main__":
+    main()